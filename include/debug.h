@@ -6,18 +6,23 @@
 #ifndef DEBUG_H
 #define DEBUG_H
 
-#include <proto/exec.h>
-
 /* Global Debug Switch */
 #define DEBUG_ENABLED 0
 
 /* Debug Macro - Filtered to diskinfo modules */
-#if DEBUG_ENABLED
+#if DEBUG_ENABLED && defined(__amigaos4__)
+#include <proto/exec.h>
 #include <string.h>
 #define LOG_DEBUG(fmt, ...)                                                                                            \
     do {                                                                                                               \
         IExec->DebugPrintF("[ADB] %s:%d: " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__);                               \
     } while (0)
+#elif DEBUG_ENABLED
+#include <stdio.h>
+#define LOG_DEBUG(fmt, ...)                                                                                            \
+    do {                                                                                                               \
+        fprintf(stderr, "[ADB] %s:%d: " fmt "\n", __FILE__, __LINE__, ##__VA_ARGS__);                                  \
+    } while (0)
 #else
 #define LOG_DEBUG(fmt, ...)                                                                                            \
     do {                                                                                                               \
@@ -6,9 +6,8 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include "platform.h"
 #include "version.h"
-#include <dos/dos.h>
-#include <exec/types.h>
 #include <math.h>
 
 /* Averaging Methods for Pass Results */
@@ -19,9 +18,77 @@ typedef enum
 {
     AVERAGE_ALL_PASSES = 0,    /**< Simple average of all passes */
     AVERAGE_TRIMMED_MEAN = 1,  /**< Exclude best and worst results */
-    AVERAGE_MEDIAN = 2         /**< Single median value from sorted results */
+    AVERAGE_MEDIAN = 2,        /**< Single median value from sorted results */
+    AVERAGE_ADAPTIVE = 3       /**< Mean of as many passes as the 95% CI stopping rule needs */
 } AveragingMethod;
 
+/**
+ * @brief Offset distributions for the random-I/O workloads.
+ */
+typedef enum
+{
+    ACCESS_UNIFORM = 0, /**< Every aligned offset equally likely */
+    ACCESS_ZIPF = 1,    /**< Zipfian block popularity, skew set by zipf_theta */
+    ACCESS_HOTCOLD = 2, /**< hot_ops_pct of I/Os land in hot_data_pct of the file */
+    ACCESS_STRIDED = 3, /**< Fixed stride through the file, wrapping at the end */
+    ACCESS_COUNT
+} AccessPattern;
+
+/**
+ * @brief Filesystem cache handling between passes (see engine_cache.h).
+ */
+typedef enum
+{
+    CACHE_MODE_NORMAL = 0, /**< Passes run back-to-back (optional flush before the job only) */
+    CACHE_MODE_COLD = 1,   /**< The read cache is evicted before every pass */
+    CACHE_MODE_PAIRED = 2, /**< Each cold pass is followed by a warm rerun; both are reported */
+    CACHE_MODE_COUNT
+} CacheMode;
+
+/**
+ * @brief How the read cache is evicted in the cold modes.
+ */
+typedef enum
+{
+    EVICT_FILE = 0,       /**< Read an eviction file larger than free memory through the same filesystem */
+    EVICT_INHIBIT = 1,    /**< Inhibit and uninhibit the device so the filesystem drops its buffers */
+    EVICT_FILESYSTEM = 2, /**< Filesystem-specific drop (buffer shrink on AmigaOS, page cache on a host) */
+    EVICT_COUNT
+} EvictStrategy;
+
+/* Memory for a workload's transfer buffers (engine_buffer.h) */
+typedef enum {
+    BUFFER_MEM_DEFAULT = 0, /**< PlatAlloc as always, no alignment asked for */
+    BUFFER_MEM_SHARED = 1,  /**< MEMF_SHARED at the chosen offset */
+    BUFFER_MEM_PRIVATE = 2, /**< MEMF_PRIVATE at the chosen offset */
+    BUFFER_MEM_LOCKED = 3,  /**< Contiguous, locked MEMF_SHARED at the chosen offset */
+    BUFFER_MEM_COUNT
+} BufferMem;
+
+/**
+ * @brief Metadata operation classes timed on their own (see engine_metaops.h).
+ */
+typedef enum
+{
+    META_OP_CREATE = 0, /**< Create a file (open new, close; Profiler also writes 20 bytes) */
+    META_OP_LOOKUP,     /**< Lock an existing entry by name */
+    META_OP_SCAN,       /**< One entry returned while examining the directory */
+    META_OP_RENAME,     /**< Rename within the same directory */
+    META_OP_DELETE,     /**< Delete a file */
+    META_OP_MKDIR,      /**< Create a directory */
+    META_OP_RMDIR,      /**< Delete an empty directory */
+    META_OP_COUNT
+} MetaOp;
+
+/* One metadata operation class of a result, summed over all passes */
+typedef struct
+{
+    uint32 count; /* 0 = not performed by the test */
+    float secs;
+    float p50_us; /* Per-operation latency percentiles */
+    float p99_us;
+} MetaOpResult;
+
 /* Test types */
 /**
  * @brief Enumeration of available benchmark test types.
@@ -38,6 +105,17 @@ typedef enum
     TEST_SEQUENTIAL_READ,  /**< Professional: Pure Sequential I/O (Read) */
     TEST_RANDOM_READ,      /**< Professional: Random I/O (Read) */
     TEST_MIXED_RW_70_30,   /**< Professional: Mixed Read/Write 70/30 */
+    TEST_TRACE_REPLAY,     /**< Professional: Replay of a recorded I/O trace */
+    TEST_RAW_SEQ_READ,     /**< Professional: Raw device sequential read (no filesystem) */
+    TEST_RAW_RANDOM_READ,  /**< Professional: Raw device random read (no filesystem) */
+    TEST_CACHE_SWEEP,      /**< Professional: Re-read bandwidth of a growing working set (cache cliffs) */
+    TEST_DIR_SCALING,      /**< Professional: Metadata rates as one directory grows to 50k entries */
+    TEST_COMMIT_LOG,       /**< Professional: Durable appends to a log file (commit latency) */
+    TEST_RAW_ZONE_SCAN,    /**< Professional: Raw device throughput at evenly spaced LBA positions */
+    TEST_RAW_SEEK_PROFILE, /**< Professional: Raw device read latency against seek distance */
+    TEST_RAW_QUEUE_DEPTH,  /**< Professional: Raw device random reads with N requests in flight */
+    TEST_READ_AHEAD,       /**< Professional: Strided reads revealing the read-ahead window */
+    TEST_BUFFERED_IO,      /**< Professional: Small records through unbuffered and buffered DOS calls */
     TEST_COUNT             /**< Total number of test types */
 } BenchTestType;
 
@@ -50,7 +128,31 @@ typedef struct
 
 #define MAX_SAMPLES 1024
 #define MAX_PASSES 20
+
+/* Adaptive pass count (AVERAGE_ADAPTIVE) */
+#define ADAPTIVE_MIN_PASSES 3
+#define ADAPTIVE_MAX_PASSES 200
+#define ADAPTIVE_DEFAULT_CI_PCT 2.0f     /* Stop when the 95% CI half-width is within 2% of the mean */
+#define ADAPTIVE_DEFAULT_BUDGET_SECS 600 /* ... or after 10 minutes, cache eviction included */
 #define MAX_PATH_LEN 256
+#define STREAMS_MAX 16 /* Upper bound for BenchOptions.streams */
+#define STREAMS_MAX_LEVELS 8
+#define CACHE_SWEEP_MAX_LEVELS 16                   /* Working-set sizes in one Cache Sweep */
+#define CACHE_SWEEP_DEFAULT_BYTES (16ULL * 1024 * 1024) /* Working set of a Cache Sweep job outside a sweep */
+#define DIR_SCALING_MAX_LEVELS 8                    /* Directory sizes in one Directory Scaling sweep */
+#define DIR_SCALING_DEFAULT_ENTRIES 1000            /* Directory size of a Directory Scaling job outside a sweep */
+#define COMMIT_MAX_LEVELS 8                         /* Group sizes in one Commit Latency sweep */
+#define ZONE_MAP_MAX 32                             /* LBA positions in a Raw Zone Scan map */
+#define SEEK_PROFILE_MAX 40                         /* Seek distances in a Raw Seek Profile (doubling) */
+#define QUEUE_DEPTH_MAX 32                          /* Upper bound for BenchOptions.queue_depth */
+#define QUEUE_DEPTH_MAX_LEVELS 8                    /* Depths in one Raw Queue Depth sweep */
+#define QUEUE_SATURATION_GAIN_PCT 10                /* Less gain than this from doubling the depth is saturation */
+#define STRIDE_LEVELS_MAX 16                        /* Gap sizes in one Read-Ahead Probe (doubling) */
+#define IO_BUFFER_NONE 1                            /* BenchOptions.io_buffer for plain Read/Write, no buffer */
+#define IO_BUFFER_MAX (1024 * 1024)                 /* Upper bound for an FOpen buffer */
+#define IO_BUFFER_MAX_LEVELS 8                      /* Buffer sizes in one Buffered I/O sweep */
+#define BUFFER_OFFSET_MAX_LEVELS 8                  /* Offsets per memory type in one buffer alignment sweep */
+#define BUFFER_FALLBACK_PCT 10                      /* This much below the aligned rate suggests bounce buffering */
 
 /* Result structure for a single test run */
 typedef struct
@@ -58,7 +160,7 @@ typedef struct
     char result_id[64]; /* Unique ID for retrieval e.g. "20231027103005_A1B2" */
     BenchTestType type;
     uint32 total_bytes;
-    float duration_secs; /* Precision timing from timer.device */
+    double duration_secs; /* Precision timing from the EClock */
     float mb_per_sec;
     uint32 iops; /* Operations per second */
     char volume_name[32];
@@ -85,10 +187,84 @@ typedef struct
     uint32 averaging_method;  /* AveragingMethod enum value */
     float min_mbps; /* Min/Max among non-trimmed passes if trimming active */
     float max_mbps;
-    float total_duration;    /* Cumulative duration across all passes */
+    double total_duration;   /* Cumulative duration across all passes */
     uint64 cumulative_bytes; /* Cumulative bytes across all passes */
     uint32 effective_passes; /* Passes actually included in average */
 
+    /* Per-operation latency in microseconds, merged across passes (0 if not tracked) */
+    float lat_p50_us;
+    float lat_p90_us;
+    float lat_p99_us;
+    float lat_p999_us;
+    float lat_max_us;
+
+    /* Time-bounded passes (0 for fixed-work runs) */
+    uint32 pass_duration_secs; /* Requested length of each pass */
+    float rampup_secs;         /* Mean ramp-up discarded per pass before steady state */
+
+    /* Pass-to-pass spread of MB/s (0 when fewer than 2 passes) */
+    float ci95_pct; /* Half-width of the 95% confidence interval of the mean, % of mean */
+    float cv_pct;   /* Coefficient of variation, % */
+
+    uint64 dataset_bytes; /* Requested data-set size (0 = workload default) */
+    char access_pattern[24]; /* Offset distribution, e.g. "Zipf0.99" (empty if not applicable) */
+
+    /* Concurrent streams (0 for single-stream runs); mb_per_sec and iops are the totals */
+    uint32 streams;
+    float stream_mbps;      /* Mean per stream */
+    uint32 stream_iops;     /* Mean per stream */
+    float slow_stream_mbps; /* Slowest single stream in any pass (fairness) */
+
+    /* Cold-cache runs (empty/0 for normal runs); mb_per_sec is then the cold figure */
+    char cache_mode[20];    /* e.g. "Cold/File", "Paired/Inhibit" */
+    float warm_mbps;        /* Paired mode: mean of the warm reruns */
+    float cache_speedup;    /* Paired mode: warm / cold */
+
+    uint64 working_set_bytes; /* Cache Sweep: bytes re-read by each pass (0 for other tests) */
+
+    /* Verify mode (0 when off or not supported by the workload) */
+    uint64 verify_bytes;      /* Bytes read back and checked, all passes */
+    uint32 verify_errors;     /* 512-byte sectors that did not match */
+    double verify_secs;       /* Stamping and checking, excluded from the pass timings */
+
+    char data_pattern[16];    /* Written data, e.g. "Fill", "Random50" (empty if the test does not write) */
+
+    /* Directory Scaling: entries in the directory, and the rate of each operation class */
+    uint32 dir_entries;
+    MetaOpResult meta_ops[META_OP_COUNT];
+
+    uint32 commit_group; /* Commit Latency: records per flush (0 for other tests); IOPS are commits/s */
+
+    /* Raw Zone Scan: MB/s at zone_count evenly spaced positions, first to last LBA */
+    uint32 zone_count;
+    float zone_mbps[ZONE_MAP_MAX];
+    uint32 zone_weak_mask; /* Bit n: zone n is well below the outer-to-inner trend */
+
+    /* Raw Seek Profile: mean read latency at doubling LBA distances, and the estimates drawn from it */
+    uint32 seek_levels;
+    uint64 seek_dist_bytes[SEEK_PROFILE_MAX];
+    float seek_us[SEEK_PROFILE_MAX];
+    float seek_rotation_us; /* Average rotational latency (half a revolution), 0 if none was seen */
+    float seek_track_us;    /* Shortest seek beyond one track (track-to-track estimate) */
+    float seek_full_us;     /* Full-stroke seek, rotation excluded */
+
+    uint32 queue_depth; /* Raw Queue Depth: requests kept in flight (0 for other tests) */
+
+    /* Read-Ahead Probe: mean latency per gap between strided reads, and the windows inferred from it */
+    uint32 stride_levels;
+    uint32 stride_gap_bytes[STRIDE_LEVELS_MAX];
+    float stride_fwd_us[STRIDE_LEVELS_MAX];
+    float stride_back_us[STRIDE_LEVELS_MAX];
+    float stride_random_us;  /* Uncached reference */
+    uint32 readahead_bytes;  /* Prefetched past a read, 0 if none was seen */
+    uint32 readbehind_bytes; /* Prefetched before a read (backward scans) */
+
+    uint32 io_buffer; /* Buffered I/O: FOpen buffer bytes, IO_BUFFER_NONE for Read/Write (0 for other tests) */
+
+    /* Transfer buffer placement (BUFFER_MEM_DEFAULT: the plain allocation of earlier results) */
+    uint32 buffer_mem;
+    uint32 buffer_offset; /* Bytes past an 8 KB boundary */
+
     /* Comparison data (non-persisted, calculated on load/run) */
     float prev_mbps;
     uint32 prev_iops;
@@ -96,6 +272,51 @@ typedef struct
     char prev_timestamp[32];
 } BenchResult;
 
+/* Run-mode options shared by GUI jobs and RunBenchmark (all-zero = classic fixed-work passes) */
+typedef struct
+{
+    uint32 duration_secs;      /* >0: each pass runs the workload kernel for this long */
+    float adaptive_ci_pct;     /* AVERAGE_ADAPTIVE target CI half-width, % of mean (0 = default) */
+    uint32 adaptive_budget_secs; /* AVERAGE_ADAPTIVE real-time budget for all passes (0 = default) */
+    uint64 dataset_bytes;      /* Test file size for sequential/random workloads (0 = workload default) */
+
+    /* Offset distribution for the random-I/O workloads (all-zero = uniform) */
+    uint32 access_pattern;     /* AccessPattern enum value */
+    float zipf_theta;          /* ACCESS_ZIPF skew in (0, 1) (0 = default 0.99) */
+    uint32 hot_ops_pct;        /* ACCESS_HOTCOLD share of I/Os hitting the hot region (0 = default 80) */
+    uint32 hot_data_pct;       /* ACCESS_HOTCOLD size of the hot region, % of file (0 = default 20) */
+    uint32 stride_bytes;       /* ACCESS_STRIDED step (0 = block size) */
+    uint32 access_seed;        /* Offset PRNG seed (0 = fixed default, repeatable runs) */
+
+    /* I/O traces (see engine_trace.h) */
+    char trace_path[MAX_PATH_LEN]; /* Trace replayed by TEST_TRACE_REPLAY, or written in record mode */
+    BOOL trace_open_loop;      /* Replay at the recorded timing instead of back-to-back */
+    BOOL trace_record;         /* Capture the first pass of a traceable workload to trace_path */
+
+    uint32 streams;            /* Concurrent workload instances, each in its own process (0/1 = single) */
+
+    char raw_image_path[MAX_PATH_LEN]; /* Raw workloads read this image file instead of the volume's device */
+
+    BOOL reuse_fixtures;       /* Keep pre-filled data files for later jobs of a queue (engine_fixture.h) */
+
+    uint32 cache_mode;         /* CacheMode enum value */
+    uint32 evict_strategy;     /* EvictStrategy enum value, for the cold modes */
+
+    uint64 working_set_bytes;  /* TEST_CACHE_SWEEP: part of the file re-read by each pass (0 = default) */
+
+    BOOL verify;               /* Stamp written data and check it on read (engine_verify.h) */
+    uint32 data_random_pct;    /* Share of random bytes in written data, 0-100 (0 = constant fill) */
+
+    uint32 dir_entries;        /* TEST_DIR_SCALING: files in the test directory (0 = default) */
+    uint32 commit_group;       /* TEST_COMMIT_LOG: records appended per flush (0 = default, 1) */
+    uint32 zone_count;         /* TEST_RAW_ZONE_SCAN: LBA positions read, 2 to ZONE_MAP_MAX (0 = default, all) */
+    uint32 queue_depth;        /* TEST_RAW_QUEUE_DEPTH: requests in flight, 1 to QUEUE_DEPTH_MAX (0 = default, 1) */
+    uint32 io_buffer;          /* TEST_BUFFERED_IO: FOpen buffer bytes, or IO_BUFFER_NONE (0 = default, none) */
+    uint32 buffer_mem;         /* BufferMem enum value for transfer buffers (0 = default allocation) */
+    uint32 buffer_offset;      /* Transfer buffer start past an 8 KB boundary, with buffer_mem set */
+    BOOL buffer_sweep;         /* GUI queue: one job per buffer offset and memory type, where supported */
+} BenchOptions;
+
 /* Separate time-series data for graphing (kept out of BenchResult to save ~8KB per history entry) */
 typedef struct
 {
@@ -103,6 +324,15 @@ typedef struct
     uint32 sample_count;
 } BenchSampleData;
 
+/* CSV history header: core columns followed by the extended metric columns */
+#define BENCH_CSV_HEADER                                                                                               \
+    "ID,DateTime,Type,Volume,FS,MB/s,IOPS,Hardware,Unit,AppVersion,Passes,BlockSize,Trimmed,Min,Max,Duration,"         \
+    "TotalBytes,Vendor,Product,Firmware,Serial,LatP50us,LatP90us,LatP99us,LatP999us,LatMaxus,PassSecs,RampUpSecs,"     \
+    "CI95Pct,CVPct,DataSetBytes,Access,Streams,StreamMBps,StreamIOPS,SlowStreamMBps,CacheMode,WarmMBps,"               \
+    "CacheSpeedup,WorkingSet,VerifyBytes,VerifyErrors,VerifySecs,DataPattern,DirEntries,MetaOps,CommitGroup,ZoneMap,"  \
+    "SeekMap,SeekRotationUs,SeekTrackUs,SeekFullUs,QueueDepth,StrideMap,StrideRandomUs,ReadAheadBytes,"                \
+    "ReadBehindBytes,IoBuffer,BufferMem,BufferOffset\n"
+
 /**
  * @brief Get the canonical CSV name for a test type (e.g. "Random4K").
  */
@@ -162,15 +392,124 @@ void CleanupEngine(void);
  * @param block_size Block size to use for I/O operations (in bytes).
  * @param averaging_method Method to use for averaging passes (AveragingMethod enum).
  * @param flush_cache If TRUE, attempt to clear OS buffers before running.
+ * @param options Optional run-mode options (NULL for fixed-work passes).
  * @param progress_cb Optional progress callback for multi-pass updates (may be NULL).
  * @param out_result Pointer to a BenchResult structure to store the results.
  * @param out_samples Optional pointer to a BenchSampleData structure for time-series data (may be NULL).
  * @return TRUE if the benchmark completed successfully, FALSE on error or abort.
  */
 BOOL RunBenchmark(BenchTestType type, const char *target_path, uint32 passes, uint32 block_size, uint32 averaging_method,
-                  BOOL flush_cache, ProgressCallback progress_cb, BenchResult *out_result,
+                  BOOL flush_cache, const BenchOptions *options, ProgressCallback progress_cb, BenchResult *out_result,
                   BenchSampleData *out_samples);
 
+/**
+ * @brief Stream counts of a scaling run, one job per count.
+ *
+ * 1, 2, 4, ... doubling below max_streams, then max_streams itself
+ * (capped at STREAMS_MAX), so the curve starts from a single stream.
+ *
+ * @param max_streams Configured stream count (2 or more).
+ * @param levels Output array of stream counts, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of counts written.
+ */
+uint32 GetStreamLevels(uint32 max_streams, uint32 *levels, uint32 max_levels);
+
+/**
+ * @brief Working-set sizes of a Cache Sweep, one job per size.
+ *
+ * Steps by 4x from 64 KB up to max_bytes, or up to twice the free memory
+ * when max_bytes is 0, so the curve runs past every cache in the path.
+ *
+ * @param target_path Target of the sweep (RAM: is kept small).
+ * @param max_bytes Largest working set (0 = derived from free memory).
+ * @param levels Output array of sizes, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of sizes written.
+ */
+uint32 GetCacheSweepLevels(const char *target_path, uint64 max_bytes, uint64 *levels, uint32 max_levels);
+
+/**
+ * @brief Directory sizes of a Directory Scaling sweep, one job per size.
+ *
+ * 100, 1k, 10k and 50k entries; RAM: stops at 10k.
+ *
+ * @param target_path Target of the sweep.
+ * @param levels Output array of entry counts, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of sizes written.
+ */
+uint32 GetDirScalingLevels(const char *target_path, uint32 *levels, uint32 max_levels);
+
+/**
+ * @brief Group sizes of a Commit Latency sweep, one job per size.
+ *
+ * 1 (a flush per record), 4 and 16 records per flush.
+ *
+ * @param levels Output array of records per flush, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of sizes written.
+ */
+uint32 GetCommitGroupLevels(uint32 *levels, uint32 max_levels);
+
+/**
+ * @brief Depths of a Raw Queue Depth sweep, one job per depth.
+ *
+ * 1, 2, 4, 8, 16 and 32 requests in flight.
+ *
+ * @param levels Output array of depths, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of depths written.
+ */
+uint32 GetQueueDepthLevels(uint32 *levels, uint32 max_levels);
+
+/**
+ * @brief Saturation point of a queue-depth sweep.
+ *
+ * The first depth after which doubling the requests in flight gains less
+ * than QUEUE_SATURATION_GAIN_PCT more IOPS; the deepest level if every step
+ * still gains.
+ *
+ * @param depths Depths of the sweep, ascending.
+ * @param iops IOPS measured at each depth.
+ * @param count Number of depths.
+ * @return The saturation depth, 0 if count is 0.
+ */
+uint32 GetQueueDepthSaturation(const uint32 *depths, const float *iops, uint32 count);
+
+/**
+ * @brief Buffer sizes of a Buffered I/O sweep, one job per size.
+ *
+ * IO_BUFFER_NONE (plain Read/Write) first, then FOpen buffers of 1, 4, 16
+ * and 64 KB read and written with FRead/FWrite.
+ *
+ * @param levels Output array of buffer sizes, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of sizes written.
+ */
+uint32 GetIoBufferLevels(uint32 *levels, uint32 max_levels);
+
+/**
+ * @brief Transfer buffer offsets of a buffer alignment sweep, run once per memory type.
+ *
+ * 0 (8 KB aligned), 4, 16, 32, 64, 512 and 4096 bytes past an 8 KB boundary.
+ *
+ * @param levels Output array of offsets, ascending.
+ * @param max_levels Capacity of levels.
+ * @return Number of offsets written.
+ */
+uint32 GetBufferOffsetLevels(uint32 *levels, uint32 max_levels);
+
+/**
+ * @brief Name of a metadata operation class, as used in the CSV (e.g. "Rename").
+ */
+const char *MetaOpName(MetaOp op);
+
+/**
+ * @brief Operations per second of one class of a result (0 if not performed).
+ */
+float MetaOpRate(const MetaOpResult *m);
+
 /**
  * @brief Identify the filesystem of a given path.
  *
@@ -213,6 +552,29 @@ void ClearHardwareInfoCache(void);
  */
 BOOL SaveResultToCSV(const char *filename, BenchResult *result);
 
+/**
+ * @brief Format the extended metric columns (those following "Serial") of a result.
+ *
+ * The output begins with a comma and has no trailing newline, so it can be
+ * appended directly after the core columns of a CSV record.
+ *
+ * @param result Pointer to the BenchResult to format.
+ * @param buf Output buffer.
+ * @param buf_size Size of the output buffer.
+ * @return TRUE if the columns fit into the buffer, FALSE on truncation.
+ */
+BOOL FormatExtendedCSVFields(const BenchResult *result, char *buf, uint32 buf_size);
+
+/**
+ * @brief Parse the extended metric columns of a CSV record.
+ *
+ * Columns missing from older history files leave the corresponding fields untouched.
+ *
+ * @param fields Text following the "Serial" column (starting with its separating comma), may be NULL.
+ * @param result Pointer to the BenchResult to populate.
+ */
+void ParseExtendedCSVFields(const char *fields, BenchResult *result);
+
 typedef struct
 {
     float avg_mbps;
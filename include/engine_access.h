@@ -0,0 +1,137 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Access-pattern (offset) generator for random-I/O workloads.
+ */
+
+#ifndef ENGINE_ACCESS_H
+#define ENGINE_ACCESS_H
+
+#include "engine.h"
+#include "engine_sampler.h"
+#include "platform.h"
+
+#define ACCESS_DEFAULT_SEED 1985
+#define ACCESS_DEFAULT_ZIPF_THETA 0.99f
+#define ACCESS_DEFAULT_HOT_OPS_PCT 80  /* 80% of I/Os ... */
+#define ACCESS_DEFAULT_HOT_DATA_PCT 20 /* ... hit 20% of the data */
+#define ACCESS_REFILL_CHUNK 65536      /* Offsets drawn at a time once a pass outruns its sequence */
+#define ACCESS_BATCH_MEM_DIV 16        /* A precomputed sequence takes at most 1/16 of free memory */
+
+/**
+ * @brief Seeded xorshift64* generator, much cheaper than rand() and 64 bits wide.
+ */
+typedef struct
+{
+    uint64 state;
+} FastRand;
+
+void FastRandSeed(FastRand *r, uint64 seed);
+uint64 FastRandNext(FastRand *r);
+
+/**
+ * @brief Uniform value in [0, range) (0 if range is 0).
+ */
+uint64 FastRandRange(FastRand *r, uint64 range);
+
+/**
+ * @brief Precomputed offset sequence for one pass.
+ *
+ * Workloads fill the sequence from their PreparePass hook, outside the timed
+ * region, and then only read offsets[] inside Run. A pass that needs more
+ * offsets than the sequence holds (a time-bounded pass, or a fixed one too
+ * large to precompute) draws the next ones in place, excluding that time from
+ * the sampler, so it keeps covering the whole file instead of replaying the
+ * same blocks from cache.
+ */
+typedef struct
+{
+    uint64 *offsets;      /* Sequence for the current pass */
+    uint32 count;         /* Entries in offsets[] */
+    uint32 next;          /* Read cursor; reaching count draws fresh offsets */
+
+    AccessPattern pattern;
+    FastRand rng;
+    uint64 max_offset;    /* Highest legal start offset (file_size - block_size) */
+    uint32 block_size;
+    uint32 align;         /* Offsets are multiples of this (power of two) */
+    uint64 slots;         /* Aligned start positions in [0, max_offset] */
+
+    /* Zipfian over block-sized items (Gray et al. rejection-free method) */
+    uint64 zipf_items;
+    double zipf_theta;
+    double zipf_alpha;
+    double zipf_zetan;
+    double zipf_eta;
+
+    /* Hot/cold split */
+    uint32 hot_ops_pct;
+    uint64 hot_slots;
+
+    /* Strided */
+    uint64 stride;
+    uint64 stride_pos;
+} OffsetGenerator;
+
+/**
+ * @brief Configure a generator from the job options and allocate its sequence buffer.
+ *
+ * @param g Generator to initialise.
+ * @param opts Job options selecting the pattern and its parameters.
+ * @param file_size Size of the file being accessed.
+ * @param block_size Size of each I/O.
+ * @param align Offset alignment in bytes (power of two).
+ * @param count Offsets per pass.
+ * @return TRUE on success, FALSE if the buffer could not be allocated.
+ */
+BOOL OffsetGenInit(OffsetGenerator *g, const BenchOptions *opts, uint64 file_size, uint32 block_size, uint32 align,
+                   uint32 count);
+
+/**
+ * @brief Sequence length for a pass of planned offsets.
+ *
+ * A fixed-work pass is precomputed whole unless it would take more than
+ * 1/ACCESS_BATCH_MEM_DIV of free memory; a time-bounded pass, whose length is
+ * unknown, starts with ACCESS_REFILL_CHUNK offsets.
+ *
+ * @param opts Job options (duration_secs selects a time-bounded pass).
+ * @param planned Offsets used by a fixed-work pass.
+ */
+uint32 OffsetGenBatchSize(const BenchOptions *opts, uint32 planned);
+
+/**
+ * @brief Generate the next pass's offset sequence and rewind the cursor.
+ */
+void OffsetGenPrepare(OffsetGenerator *g);
+
+/**
+ * @brief Draw a fresh sequence mid-pass and leave the time it took out of the sampler.
+ */
+void OffsetGenRefill(OffsetGenerator *g, BenchSampler *sampler);
+
+/**
+ * @brief Next offset of the pass, drawing fresh ones when the sequence runs out.
+ *
+ * @param sampler The pass's sampler (may be NULL), credited with the refill time.
+ */
+static inline uint64 OffsetGenNext(OffsetGenerator *g, BenchSampler *sampler)
+{
+    if (g->next >= g->count)
+        OffsetGenRefill(g, sampler);
+    return g->offsets[g->next++];
+}
+
+/**
+ * @brief Release the sequence buffer.
+ */
+void OffsetGenFree(OffsetGenerator *g);
+
+/**
+ * @brief Short description of the job's access pattern for CSV and reports (e.g. "Zipf0.99").
+ *
+ * @param block_size Block size of the run (the default stride).
+ */
+void FormatAccessPattern(const BenchOptions *opts, uint32 block_size, char *buf, uint32 size);
+
+#endif /* ENGINE_ACCESS_H */
@@ -0,0 +1,159 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Raw block-device access for the filesystem-bypassing workloads.
+ *
+ * The workloads only see a BlockDevice: a read hook plus the geometry. The
+ * exec backend (engine_blockdev_exec.c) issues trackdisk requests to the
+ * volume's device; the file backend here reads an image file through the C
+ * library, so the scheduling and statistics can be run on a host.
+ *
+ * Requests can also be kept in flight: BlockDevQueueInit sets up N slots,
+ * BlockDevSubmit starts a request in a free slot and BlockDevWaitAny returns
+ * the slot of the next one to complete. The exec backend sends them with
+ * SendIO, so a driver with command queueing sees N requests at once; the
+ * file backend completes each request as it is submitted.
+ */
+
+#ifndef ENGINE_BLOCKDEV_H
+#define ENGINE_BLOCKDEV_H
+
+#include "engine_access.h"
+#include "platform.h"
+
+#define BLOCKDEV_NAME_LEN 64
+#define BLOCKDEV_DEFAULT_BLOCK 512 /* Sector size assumed for image files */
+#define BLOCKDEV_MAX_QUEUE 32      /* Requests in flight at most */
+
+struct BlockDevice;
+
+typedef struct
+{
+    /* Read length bytes (a multiple of block_bytes) at a block-aligned byte offset */
+    BOOL (*Read)(struct BlockDevice *dev, uint64 offset, void *buffer, uint32 length);
+    void (*Close)(struct BlockDevice *dev);
+
+    /* Optional: requests in flight. Without them BlockDevSubmit reads synchronously. */
+    BOOL (*QueueInit)(struct BlockDevice *dev, uint32 depth);
+    BOOL (*Submit)(struct BlockDevice *dev, uint32 slot, uint64 offset, void *buffer, uint32 length);
+    int32 (*WaitAny)(struct BlockDevice *dev, BOOL *ok); /* Slot of the next completed request */
+} BlockDeviceOps;
+
+/**
+ * @brief An open device (or stand-in) plus the counters kept by BlockDevRead.
+ */
+typedef struct BlockDevice
+{
+    const BlockDeviceOps *ops;
+    void *handle;                  /* Backend state */
+    char name[BLOCKDEV_NAME_LEN];  /* "a1ide.device/0" or the image path, for logs */
+    uint32 block_bytes;            /* Sector size */
+    uint64 capacity_bytes;         /* Whole LBA range */
+
+    uint64 bytes_read;
+    uint32 reads;
+    uint32 errors;
+
+    /* Request queue (BlockDevQueueInit) */
+    uint32 queue_depth;
+    uint32 in_flight;
+    uint32 slot_length[BLOCKDEV_MAX_QUEUE];
+    uint32 done_slot[BLOCKDEV_MAX_QUEUE]; /* Completed synchronously, oldest first */
+    BOOL done_ok[BLOCKDEV_MAX_QUEUE];
+    uint32 done_head;
+    uint32 done_count;
+} BlockDevice;
+
+/**
+ * @brief Open an exec device unit for 64-bit reads (AmigaOS only).
+ *
+ * Uses NSCMD_TD_READ64 when the device reports it, TD_READ64 otherwise, and
+ * checks the command by reading the first block.
+ *
+ * @return TRUE on success; the device must be released with BlockDevClose.
+ */
+BOOL BlockDevOpenExec(BlockDevice *dev, const char *device_name, uint32 unit);
+
+/**
+ * @brief Open an image file as a stand-in device.
+ *
+ * @param block_bytes Sector size to emulate (0 = BLOCKDEV_DEFAULT_BLOCK). The
+ *                    capacity is the file size rounded down to whole sectors.
+ * @return TRUE on success.
+ */
+BOOL BlockDevOpenFile(BlockDevice *dev, const char *path, uint32 block_bytes);
+
+/**
+ * @brief Read through the backend and update the device counters.
+ *
+ * @return TRUE if the whole range was read.
+ */
+BOOL BlockDevRead(BlockDevice *dev, uint64 offset, void *buffer, uint32 length);
+
+/**
+ * @brief Set up depth request slots (1 to BLOCKDEV_MAX_QUEUE), numbered from 0.
+ *
+ * @return FALSE if the backend cannot keep that many requests.
+ */
+BOOL BlockDevQueueInit(BlockDevice *dev, uint32 depth);
+
+/**
+ * @brief Start a read in a free slot; the buffer must stay untouched until the slot completes.
+ *
+ * @return FALSE (counted as an error) if the request could not be started.
+ */
+BOOL BlockDevSubmit(BlockDevice *dev, uint32 slot, uint64 offset, void *buffer, uint32 length);
+
+/**
+ * @brief Wait for the next request to complete and update the device counters.
+ *
+ * @param ok Set to TRUE if the whole range was read.
+ * @return The slot, now free again, or -1 if no request is in flight.
+ */
+int32 BlockDevWaitAny(BlockDevice *dev, BOOL *ok);
+
+/**
+ * @brief Close the device, first waiting for any requests still in flight.
+ */
+void BlockDevClose(BlockDevice *dev);
+
+/**
+ * @brief Round an I/O size to a whole number of sectors (at least one).
+ */
+uint32 BlockDevIOSize(const BlockDevice *dev, uint32 block_size);
+
+typedef enum
+{
+    RAW_ORDER_SEQUENTIAL = 0,
+    RAW_ORDER_RANDOM
+} RawOrder;
+
+/**
+ * @brief Request scheduler over the whole LBA range.
+ *
+ * Sequential order walks the device from LBA 0 in io_bytes steps; the
+ * position carries over between passes and wraps at the end, so successive
+ * passes cover the whole disk rather than rereading its start. Random order
+ * picks uniformly distributed io_bytes-sized slots.
+ */
+typedef struct
+{
+    RawOrder order;
+    uint32 io_bytes;
+    uint64 slots;  /* io_bytes-sized positions on the device */
+    uint64 next;   /* Next sequential slot */
+    FastRand rng;
+} RawSchedule;
+
+/**
+ * @return FALSE if the device is smaller than one I/O.
+ */
+BOOL RawScheduleInit(RawSchedule *s, const BlockDevice *dev, RawOrder order, uint32 io_bytes, uint64 seed);
+
+/**
+ * @brief Byte offset of the next request.
+ */
+uint64 RawScheduleNext(RawSchedule *s);
+
+#endif /* ENGINE_BLOCKDEV_H */
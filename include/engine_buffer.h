@@ -0,0 +1,42 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Transfer buffers placed for the buffer alignment sweep.
+ *
+ * A driver that DMAs straight into the caller's buffer usually needs it
+ * aligned (and, on AmigaOS, locked and contiguous); anything else is copied
+ * through a bounce buffer, which costs bandwidth on fast devices. With
+ * BenchOptions.buffer_mem set, a workload's read buffer or write data starts
+ * buffer_offset bytes past a BUFFER_BASE_ALIGN boundary in memory of that
+ * type, so offset N is aligned to exactly N bytes and 0 to the full 8 KB.
+ * BUFFER_MEM_DEFAULT keeps the plain PlatAlloc buffers of earlier results.
+ */
+
+#ifndef ENGINE_BUFFER_H
+#define ENGINE_BUFFER_H
+
+#include "engine.h"
+
+#define BUFFER_BASE_ALIGN 8192 /* Twice the largest swept offset, so every offset is a distinct alignment */
+
+typedef struct
+{
+    uint8 *base; /* As allocated (freed) */
+    uint8 *data; /* Where transfers start */
+} XferBuffer;
+
+/**
+ * @brief Allocate size bytes where the job's buffer placement asks for them.
+ * @return FALSE if the memory could not be allocated.
+ */
+BOOL XferBufferAlloc(XferBuffer *b, uint32 size, const BenchOptions *opts);
+
+void XferBufferFree(XferBuffer *b);
+
+/**
+ * @brief Name of a BufferMem value, as in the log and details (e.g. "Locked").
+ */
+const char *BufferMemName(uint32 mem);
+
+#endif /* ENGINE_BUFFER_H */
@@ -0,0 +1,68 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Cold-cache passes: evicting the target's data from the filesystem and OS
+ * caches before each pass, so reads are served by the drive.
+ *
+ * FlushVolume only writes dirty buffers back; clean data the workload has
+ * just written or read stays cached and a "read" benchmark measures memory.
+ * The evictor removes it with one of three strategies:
+ *
+ * EVICT_FILE:       Read an eviction file larger than free memory, pushing
+ *                   everything else out of the cache. Works everywhere, but
+ *                   costs a full read of the file per pass.
+ * EVICT_INHIBIT:    Close the workload's files, inhibit and release the
+ *                   volume. The filesystem revalidates and starts with empty
+ *                   buffers. Needs a workload with SetFilesOpen and no streams.
+ * EVICT_FILESYSTEM: Filesystem-specific: shrink the buffer pool to one buffer
+ *                   and restore it (AmigaOS), drop the page cache (host).
+ *
+ * A strategy that is unavailable falls back to EVICT_FILE with a log line.
+ */
+
+#ifndef ENGINE_CACHE_H
+#define ENGINE_CACHE_H
+
+#include "engine.h"
+#include "workload_interface.h"
+
+#define EVICT_FILE_NAME "adb_evict.tmp"
+#define EVICT_CHUNK (256 * 1024)
+#define EVICT_MIN_BYTES (16ULL * 1024 * 1024)
+#define EVICT_MAX_BYTES (1024ULL * 1024 * 1024) /* Keeps the per-pass eviction read bounded on large hosts */
+#define EVICT_REMOUNT_TRIES 50                   /* 100 ms apart while the volume revalidates */
+
+typedef struct
+{
+    char target[MAX_PATH_LEN];
+    char file_path[MAX_PATH_LEN * 2];
+    const BenchOptions *opts;
+    uint32 strategy;  /* Strategy in effect, after any fallback */
+    uint64 file_bytes;
+    BOOL file_ready;
+    uint8 *buffer;
+} CacheEvictor;
+
+/**
+ * @brief Choose the strategy for this job, falling back to EVICT_FILE if it cannot be used.
+ *
+ * @param streams Concurrent stream count (the workload instances then live in child processes).
+ */
+BOOL EvictorInit(CacheEvictor *ev, const char *target_path, uint32 strategy, const BenchWorkload *workload,
+                 uint32 streams, const BenchOptions *opts);
+
+/**
+ * @brief Evict the target's data from the cache; called before each cold pass, outside the timed region.
+ *
+ * @param data The workload instance (NULL with streams).
+ * @return FALSE if the workload's files could not be reopened after an Inhibit; the job cannot go on.
+ */
+BOOL EvictorRun(CacheEvictor *ev, const BenchWorkload *workload, void *data);
+
+void EvictorFree(CacheEvictor *ev);
+
+const char *EvictStrategyName(uint32 strategy);
+const char *CacheModeName(uint32 mode);
+
+#endif /* ENGINE_CACHE_H */
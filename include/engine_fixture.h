@@ -0,0 +1,75 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Pre-filled data files ("fixtures") kept between the jobs of a queue.
+ *
+ * The random and read workloads need a 64-256 MB file before their first
+ * pass. Within a queue the same files would be rewritten for every block
+ * size, so with BenchOptions.reuse_fixtures set they are left in place and
+ * picked up again by the next job. A cached fixture carries a header,
+ * stored after the data so workload offsets are unchanged, that records its
+ * size, fill pattern and a checksum of sampled blocks; it is reused only if
+ * all three still match. In verify mode the fill is the stamped pattern of
+ * engine_verify.h, recorded together with its seed. The cache is emptied when the queue drains
+ * (FixtureCacheFlush) or when a job targets another volume.
+ */
+
+#ifndef ENGINE_FIXTURE_H
+#define ENGINE_FIXTURE_H
+
+#include "engine.h"
+#include "platform.h"
+
+#define FIXTURE_MAGIC 0x41444246 /* "ADBF" */
+#define FIXTURE_VERSION 2
+#define FIXTURE_FILL_BYTE 0xAA       /* Content written by WriteDummyFile */
+#define FIXTURE_PATTERN_MODIFIED 0x100 /* Overwritten by a write workload: right size, unknown content */
+#define FIXTURE_PATTERN_VERIFY 0x200   /* Stamped sectors (verify mode) */
+#define FIXTURE_SAMPLES 8              /* Blocks read for the checksum, spread over the data */
+#define FIXTURE_SAMPLE_BYTES 512
+#define FIXTURE_MAX_CACHED 8
+
+/**
+ * @brief On-disk header, written directly after the fixture's data.
+ */
+typedef struct
+{
+    uint32 magic;
+    uint32 version;
+    uint64 data_bytes;  /* Size the workload asked for */
+    uint32 pattern;     /* Fill byte, or FIXTURE_PATTERN_MODIFIED */
+    uint32 sample_sum;  /* FNV-1a over the FIXTURE_SAMPLES sampled blocks */
+    uint32 seed;        /* Stamp seed for FIXTURE_PATTERN_VERIFY, else 0 */
+} FixtureHeader;
+
+/**
+ * @brief Provide a filled data file of the given size at file_path.
+ *
+ * Reuses a cached fixture when its header still matches, otherwise writes
+ * the file with WriteDummyFile. Without opts->reuse_fixtures this is a plain
+ * WriteDummyFile and the file is not cached. With opts->verify the content
+ * is stamped for checking, unless any_content is set.
+ *
+ * @param target_path The job's target (a change of volume empties the cache).
+ * @param fill_chunk  Write size used when the file has to be (re)written.
+ * @param any_content TRUE for write workloads that only need the space allocated.
+ * @return TRUE if the file is ready.
+ */
+BOOL FixtureAcquire(const char *target_path, const char *file_path, uint64 size, uint32 fill_chunk,
+                    BOOL any_content, const BenchOptions *opts);
+
+/**
+ * @brief Hand a fixture back after the workload has closed it.
+ *
+ * Cached fixtures stay on disk (modified ones are re-stamped so only
+ * any_content users take them next time); others are deleted as before.
+ */
+void FixtureRelease(const char *file_path, BOOL modified);
+
+/**
+ * @brief Delete every cached fixture (queue drained, volume changed or engine shutdown).
+ */
+void FixtureCacheFlush(void);
+
+#endif /* ENGINE_FIXTURE_H */
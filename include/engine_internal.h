@@ -6,24 +6,18 @@
 #ifndef ENGINE_INTERNAL_H
 #define ENGINE_INTERNAL_H
 
-#include <devices/timer.h>
-#include <dos/dos.h>
-#include <exec/ports.h>
-#include <exec/types.h>
-#include <proto/dos.h>
-#include <proto/exec.h>
-#include <proto/timer.h>
-
 /* Standard C library headers used by all engine modules */
 #include <stdio.h>
 #include <string.h>
+#include <strings.h>
 
 #include "debug.h"
 #include "engine.h"
-
-/* Global library bases and interfaces shared within engine */
-extern struct TimerIFace *IBenchTimer;
-extern struct TimeRequest *BenchTimerReq;
+#include "engine_pattern.h"
+#include "engine_sampler.h"
+#include "engine_timing.h"
+#include "engine_verify.h"
+#include "platform.h"
 
 /* SCSI Inquiry Constants */
 #define SCSI_INQ_STD_LEN 36
@@ -54,27 +48,15 @@ void ClearHardwareInfoCache(void);
  * @brief Create a dummy file of a specified size for testing.
  *
  * @param path Full path to the file to create.
- * @param size Total size of the file in bytes.
+ * @param size Total size of the file in bytes (may exceed 4 GB).
  * @param chunk_size Size of chunks to write (for buffer alignment testing).
+ * @param sampler Throughput sampler updated after each chunk (NULL when not timed).
+ * @param pattern Data to write (NULL for the 0xAA fill); chunk_size must not exceed its max_len.
+ * @param verify Verify mode: stamp each chunk instead (NULL or disabled to write the data as is).
  * @return Total bytes written, or 0 on error.
  */
-uint32 WriteDummyFile(const char *path, uint32 size, uint32 chunk_size);
-
-/**
- * @brief Get the current high-resolution system time (Microseconds).
- *
- * @param tv Pointer to a TimeVal structure to store the result.
- */
-void GetMicroTime(struct TimeVal *tv);
-
-/**
- * @brief Calculate duration between two time values in seconds.
- *
- * @param start Start time.
- * @param end End time.
- * @return Duration in seconds (with fractional part).
- */
-float GetDuration(struct TimeVal *start, struct TimeVal *end);
+uint64 WriteDummyFile(const char *path, uint64 size, uint32 chunk_size, struct BenchSampler *sampler,
+                      DataPattern *pattern, VerifyState *verify);
 
 /**
  * @brief Execute a single iteration of a benchmark test.
@@ -0,0 +1,50 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Per-class metadata operation counters.
+ *
+ * Metadata workloads time each operation class (MetaOp) on its own, so a
+ * result can show that lookups slow down as a directory grows while creates
+ * do not. Counts, times and a latency histogram per class are kept per Run
+ * and merged by the engine into BenchResult.meta_ops.
+ */
+
+#ifndef ENGINE_METAOPS_H
+#define ENGINE_METAOPS_H
+
+#include "engine.h"
+#include "engine_latency.h"
+#include "engine_timing.h"
+
+typedef struct
+{
+    uint32 count[META_OP_COUNT];
+    BenchTicks ticks[META_OP_COUNT];
+    LatencyHistogram latency[META_OP_COUNT];
+} MetaOpStats;
+
+/**
+ * @brief Clear the counters at the start of a pass.
+ */
+void MetaOpsReset(MetaOpStats *m);
+
+/**
+ * @brief Add another instance's counters (streams, passes) to dest.
+ */
+void MetaOpsMerge(MetaOpStats *dest, const MetaOpStats *src);
+
+/**
+ * @brief Count n operations of one class that ran from start until now.
+ *
+ * A batch (n > 1, e.g. one directory scan) records its mean per-operation
+ * latency n times.
+ */
+void MetaOpsRecord(MetaOpStats *m, MetaOp op, uint32 n, BenchTicks start);
+
+/**
+ * @brief Copy the counters and percentiles into a result (count 0 stays 0, as "not performed").
+ */
+void MetaOpsToResult(const MetaOpStats *m, MetaOpResult *out);
+
+#endif /* ENGINE_METAOPS_H */
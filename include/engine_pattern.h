@@ -0,0 +1,65 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Write data with a chosen share of random bytes.
+ *
+ * A constant fill is what compressing and deduplicating layers (network
+ * shares, SSD controllers, emulator host disks) handle best, so it flatters
+ * them. With BenchOptions.data_random_pct above 0 the writers draw their
+ * data from a pool generated at setup:
+ *
+ *   each DATA_SEGMENT_BYTES segment holds pct% random bytes followed by
+ *   zeros, so 50 compresses to about half and 100 not at all;
+ *   every DATA_TAG_SPACING bytes of a write start with a serial number, so
+ *   no two 4 KB blocks of a run are identical.
+ *
+ * Only the tags are written inside the timed loop. 0 keeps the classic
+ * constant fill, comparable with earlier results.
+ */
+
+#ifndef ENGINE_PATTERN_H
+#define ENGINE_PATTERN_H
+
+#include "engine.h"
+#include "engine_buffer.h"
+#include "platform.h"
+
+#define DATA_POOL_BYTES (1024 * 1024) /* Pre-generated data a writer cycles through */
+#define DATA_SEGMENT_BYTES 256        /* Random bytes first, then zeros */
+#define DATA_TAG_SPACING 4096         /* Dedup granularity of common filesystems and controllers */
+#define DATA_ALIGN 512
+
+typedef struct
+{
+    uint32 random_pct;  /* 0 = constant fill */
+    XferBuffer pool_buf; /* Placed as the job's buffer_mem and buffer_offset ask */
+    uint8 *pool;
+    uint32 pool_bytes;
+    uint32 slice_align; /* Writes start this far apart, keeping the pool's placement */
+    uint32 next;        /* Start of the next slice handed out */
+    uint64 serial;      /* Next per-block tag */
+} DataPattern;
+
+/**
+ * @brief Generate the data pool (outside the timed region).
+ *
+ * @param max_len Largest write the workload will ask for.
+ * @param fill Byte used for the constant fill when random_pct is 0.
+ * @return FALSE if the pool could not be allocated.
+ */
+BOOL DataPatternInit(DataPattern *dp, const BenchOptions *opts, uint32 max_len, uint8 fill);
+
+/**
+ * @brief Data for the next write of len bytes (len <= max_len), tagged unless it is the constant fill.
+ */
+uint8 *DataPatternNext(DataPattern *dp, uint32 len);
+
+void DataPatternFree(DataPattern *dp);
+
+/**
+ * @brief Name recorded in BenchResult.data_pattern, e.g. "Fill" or "Random50".
+ */
+void FormatDataPattern(const BenchOptions *opts, char *buf, uint32 size);
+
+#endif /* ENGINE_PATTERN_H */
@@ -0,0 +1,64 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Read-ahead detection from strided reads.
+ *
+ * A read that lands inside data the filesystem, driver or drive prefetched
+ * after (or before) the previous read costs a memory copy; one outside it
+ * costs a full uncached access. The probe reads single blocks separated by
+ * gaps doubling from zero (sequential) upwards, forwards and backwards, plus
+ * uniformly random blocks as the uncached reference. As the gap outgrows the
+ * prefetch window the latency climbs from the sequential floor to the random
+ * level; where it crosses gives the window size.
+ */
+
+#ifndef ENGINE_READAHEAD_H
+#define ENGINE_READAHEAD_H
+
+#include "engine.h"
+#include "engine_latency.h"
+
+typedef struct
+{
+    uint32 levels;
+    uint32 block_bytes;                    /* Size of each read */
+    uint32 gap_bytes[STRIDE_LEVELS_MAX];   /* Skipped between reads */
+    LatencyHistogram forward[STRIDE_LEVELS_MAX];
+    LatencyHistogram backward[STRIDE_LEVELS_MAX];
+    LatencyHistogram random;
+} StrideStats;
+
+/**
+ * @brief Lay out the gaps: none, then block_bytes doubling up to max_gap_bytes.
+ *
+ * @return FALSE if no gap fits.
+ */
+BOOL StrideStatsInit(StrideStats *s, uint32 block_bytes, uint32 max_gap_bytes);
+
+/**
+ * @brief Clear the histograms at the start of a pass (the gaps are kept).
+ */
+void StrideStatsReset(StrideStats *s);
+
+/**
+ * @brief Merge another instance's histograms (streams, passes) into dest, taking its gaps if dest has none.
+ */
+void StrideStatsMerge(StrideStats *dest, const StrideStats *src);
+
+/**
+ * @brief Count one timed read at a gap level, read after a lower (forward) or higher (backward) offset.
+ */
+void StrideStatsRecord(StrideStats *s, uint32 level, BOOL backward, uint32 micros);
+
+/**
+ * @brief Count one timed read at a random offset (the uncached reference).
+ */
+void StrideStatsRecordRandom(StrideStats *s, uint32 micros);
+
+/**
+ * @brief Store the curves in a result and infer (and log) the read-ahead and read-behind windows.
+ */
+void StrideStatsToResult(const StrideStats *s, BenchResult *out);
+
+#endif /* ENGINE_READAHEAD_H */
@@ -0,0 +1,156 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Intra-pass throughput sampling into BenchSampleData.
+ */
+
+#ifndef ENGINE_SAMPLER_H
+#define ENGINE_SAMPLER_H
+
+#include "platform.h"
+
+#include "engine.h"
+#include "engine_timing.h"
+
+#define SAMPLER_INTERVAL_US 100000        /* Initial sample period: 100 ms */
+#define SAMPLER_CHECK_BYTES (256 * 1024)  /* Read the clock at most every 256 KB ... */
+#define SAMPLER_CHECK_OPS 32              /* ... or every 32 operations */
+
+#define SAMPLER_STEADY_WINDOW 10          /* Intervals in the steady-state window */
+#define SAMPLER_STEADY_CV 0.05f           /* Max coefficient of variation across the window */
+#define SAMPLER_STEADY_DRIFT 0.02f        /* Max relative change between the window's halves */
+
+/**
+ * @brief Engine-owned sampling state handed to workloads via SetSampler.
+ *
+ * Workloads report progress with SamplerUpdate() after each operation; the
+ * sampler reads the clock only every SAMPLER_CHECK_BYTES / SAMPLER_CHECK_OPS
+ * and emits one point per elapsed interval. When the sample buffer fills, the
+ * stored points are pairwise averaged and the interval doubled, so a run of
+ * any length is covered end-to-end at uniform resolution.
+ *
+ * For time-bounded passes the sampler also owns the deadline and the
+ * steady-state detector: measurement starts once the last
+ * SAMPLER_STEADY_WINDOW interval rates agree within SAMPLER_STEADY_CV and
+ * show no trend beyond SAMPLER_STEADY_DRIFT, or at
+ * half the duration if the device never settles. Work done before that point
+ * is ramp-up and is excluded from the pass result.
+ */
+typedef struct BenchSampler
+{
+    BenchSampleData *out;       /* Destination buffer (NULL disables sampling) */
+    BOOL use_ops;               /* Report ops/s instead of MB/s */
+    float time_base;            /* Seconds of previously completed passes */
+    BenchTicks pass_start;
+    BenchTicks interval_start;
+    uint64 interval_bytes;      /* Work done in the current interval */
+    uint32 interval_ops;
+    uint64 unchecked_bytes;     /* Work done since the clock was last read */
+    uint32 unchecked_ops;
+    uint32 interval_us;         /* Current sample period, doubled on each decimation */
+    uint64 pass_bytes;          /* Work done in the whole pass */
+    uint32 pass_ops;
+
+    /* Time-bounded passes (duration_us == 0 for fixed-work passes) */
+    uint32 duration_us;
+    BOOL expired;               /* Deadline reached; workloads stop at the next check */
+    BOOL steady;                /* Ramp-up over, measurement window open */
+    float window[SAMPLER_STEADY_WINDOW];
+    uint32 window_count;
+    BenchTicks measure_start;
+    uint64 measure_bytes;       /* Work done since measure_start */
+    uint32 measure_ops;
+    double measure_secs;        /* Length of the measurement window, set by SamplerEndPass */
+    double rampup_secs;         /* Discarded ramp-up of the last pass */
+
+    struct TraceRecorder *recorder; /* Record mode: captures I/O reported via SamplerTraceIO (else NULL) */
+} BenchSampler;
+
+/**
+ * @brief Prepare a sampler for a new benchmark and clear the destination buffer.
+ *
+ * @param s Sampler to initialise.
+ * @param out Destination sample buffer (may be NULL).
+ * @param use_ops TRUE to record ops/s (metadata tests), FALSE for MB/s.
+ */
+void SamplerInit(BenchSampler *s, BenchSampleData *out, BOOL use_ops);
+
+/**
+ * @brief Switch the sampler to time-bounded passes.
+ *
+ * @param duration_secs Length of each pass in seconds (0 restores fixed-work passes).
+ */
+void SamplerSetDuration(BenchSampler *s, uint32 duration_secs);
+
+/**
+ * @brief Start timing a pass. Sample time offsets continue from time_base.
+ */
+void SamplerBeginPass(BenchSampler *s, float time_base);
+
+/**
+ * @brief Report completed work from inside a workload's timed loop.
+ *
+ * Safe to call with a NULL sampler. Does not allocate.
+ */
+void SamplerUpdate(BenchSampler *s, uint32 bytes, uint32 ops);
+
+/**
+ * @brief Log an I/O to the trace recorder just before it is issued.
+ *
+ * A no-op unless the engine is recording this pass, so traceable workloads
+ * (WORKLOAD_F_TRACEABLE) can call it unconditionally.
+ *
+ * @param op TraceOp value.
+ * @param offset File offset of the I/O.
+ * @param length Size of the I/O in bytes.
+ */
+void SamplerTraceIO(BenchSampler *s, uint8 op, uint64 offset, uint32 length);
+
+/**
+ * @brief Leave work done inside the pass out of its timing (e.g. data verification).
+ *
+ * The sample intervals, the measurement window and the deadline of a
+ * time-bounded pass all continue as if the excluded time had not passed.
+ *
+ * @param ticks Time to exclude, just spent by the caller.
+ */
+void SamplerExclude(BenchSampler *s, BenchTicks ticks);
+
+/**
+ * @brief Flush the partial interval at the end of a pass.
+ */
+void SamplerEndPass(BenchSampler *s);
+
+/**
+ * @brief Loop condition for a workload's operation kernel.
+ *
+ * Fixed-work passes (or a NULL sampler) run until done reaches planned;
+ * time-bounded passes ignore the plan and run until the deadline. The
+ * deadline is only re-evaluated inside SamplerUpdate(), so kernels must report
+ * every operation, including failed ones, to be sure of terminating.
+ *
+ * @param s Sampler (may be NULL).
+ * @param done Units of work completed so far in this pass.
+ * @param planned Units of work for a fixed-work pass.
+ */
+BOOL SamplerKeepRunning(const BenchSampler *s, uint64 done, uint64 planned);
+
+/**
+ * @brief TRUE once a time-bounded pass has reached its deadline.
+ */
+BOOL SamplerExpired(const BenchSampler *s);
+
+/**
+ * @brief TRUE when the sampler is running time-bounded passes.
+ */
+BOOL SamplerTimed(const BenchSampler *s);
+
+/**
+ * @brief Append an explicit point (e.g. one per pass for unsampled workloads).
+ *
+ * Applies the same decimation as intra-pass samples when the buffer is full.
+ */
+void SamplerAddPoint(BenchSampler *s, float time_offset, float value);
+
+#endif /* ENGINE_SAMPLER_H */
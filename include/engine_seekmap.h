@@ -0,0 +1,58 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Read latency against seek distance on a raw device.
+ *
+ * The seek profile reads pairs of blocks a known LBA distance apart, the
+ * distance doubling from adjacent blocks up to the full device. Each level
+ * keeps a latency histogram of the second read of its pairs; the mean per
+ * level becomes BenchResult.seek_us. On a mechanical drive the spread within
+ * a long-distance level is one revolution (the sector may be anywhere under
+ * the head), its floor is the pure seek, and the curve flattens into the
+ * full-stroke time at the far end.
+ */
+
+#ifndef ENGINE_SEEKMAP_H
+#define ENGINE_SEEKMAP_H
+
+#include "engine.h"
+#include "engine_latency.h"
+
+#define SEEK_TRACK_DISTANCE (4ULL * 1024 * 1024) /* Pairs at least this far apart are on different tracks */
+
+typedef struct
+{
+    uint32 levels;
+    uint64 distance[SEEK_PROFILE_MAX]; /* Bytes between the two reads of a pair */
+    LatencyHistogram latency[SEEK_PROFILE_MAX];
+} SeekStats;
+
+/**
+ * @brief Lay out the distances: io_bytes doubling while a pair still fits, then the full stroke.
+ *
+ * @return FALSE if the device is too small for two levels.
+ */
+BOOL SeekStatsInit(SeekStats *s, uint64 capacity_bytes, uint32 io_bytes);
+
+/**
+ * @brief Clear the histograms at the start of a pass (the distances are kept).
+ */
+void SeekStatsReset(SeekStats *s);
+
+/**
+ * @brief Add another instance's histograms (streams, passes) to dest, taking its distances if dest has none.
+ */
+void SeekStatsMerge(SeekStats *dest, const SeekStats *src);
+
+/**
+ * @brief Count one timed read at a distance level.
+ */
+void SeekStatsRecord(SeekStats *s, uint32 level, uint32 micros);
+
+/**
+ * @brief Store the curve in a result and estimate (and log) rotation, track-to-track and full-stroke times.
+ */
+void SeekStatsToResult(const SeekStats *s, BenchResult *out);
+
+#endif /* ENGINE_SEEKMAP_H */
@@ -0,0 +1,98 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Concurrent streams: N child processes each running their own workload instance.
+ */
+
+#ifndef ENGINE_STREAMS_H
+#define ENGINE_STREAMS_H
+
+#include "engine_latency.h"
+#include "platform.h"
+#include "workload_interface.h"
+
+#define STREAMS_DIR_NAME "adb_stream" /* Per-stream directory: <target>adb_stream<n>/ */
+#define STREAMS_STACK_SIZE 65536
+
+struct StreamCtx;
+
+/**
+ * @brief A group of streams driven in lock-step by the engine.
+ *
+ * Each stream is a child process owning one workload instance, set up in its
+ * own directory so instances never share files. The processes idle on their
+ * message ports between commands; a pass starts when the engine posts RUN to
+ * every stream back-to-back (the shared start barrier) and ends when the
+ * last one replies.
+ */
+typedef struct StreamGroup
+{
+    const BenchWorkload *workload;
+    PlatPort *reply_port;
+    struct StreamCtx *streams;
+    uint32 count;
+    uint32 started;        /* Streams whose process is running (for teardown) */
+
+    /* Last pass, filled by StreamsRunPass */
+    double pass_secs;      /* Aggregate scoring window: total bytes / sum of stream rates */
+    double rampup_secs;    /* Mean ramp-up discarded per stream (time-bounded passes) */
+    float slowest_mbps;    /* Slowest stream's bytes over pass_secs, comparable with the mean */
+} StreamGroup;
+
+/**
+ * @brief Create the stream directories, spawn the processes and run Setup in each.
+ *
+ * @param count Number of streams (2..STREAMS_MAX).
+ * @return The group, or NULL if any stream failed to start or set up (all are torn down).
+ */
+StreamGroup *StreamsStart(const BenchWorkload *workload, const char *target_path, uint32 block_size,
+                          const BenchOptions *opts, uint32 count);
+
+/**
+ * @brief Run one pass on all streams at once.
+ *
+ * Calls PreparePass for every stream first, then releases them together.
+ *
+ * @param bytes Receives the bytes moved by all streams (measurement windows only, when time-bounded).
+ * @param ops Receives the operations of all streams.
+ * @return TRUE if every stream completed its pass.
+ */
+BOOL StreamsRunPass(StreamGroup *g, uint64 *bytes, uint32 *ops);
+
+/**
+ * @brief Merge the latency histograms of the last pass of every stream.
+ */
+void StreamsMergeLatency(StreamGroup *g, LatencyHistogram *dest);
+
+/**
+ * @brief Add the verify-mode counters of the last pass of every stream to dest.
+ */
+void StreamsMergeVerify(StreamGroup *g, VerifyState *dest);
+
+/**
+ * @brief Add the metadata counters of the last pass of every stream to dest.
+ */
+void StreamsMergeMetaOps(StreamGroup *g, MetaOpStats *dest);
+
+/**
+ * @brief Add the per-zone counters of the last pass of every stream to dest.
+ */
+void StreamsMergeZones(StreamGroup *g, ZoneStats *dest);
+
+/**
+ * @brief Merge the per-distance latencies of the last pass of every stream into dest.
+ */
+void StreamsMergeSeeks(StreamGroup *g, SeekStats *dest);
+
+/**
+ * @brief Merge the per-gap latencies of the last pass of every stream into dest.
+ */
+void StreamsMergeStrides(StreamGroup *g, StrideStats *dest);
+
+/**
+ * @brief Run Cleanup in each stream, end the processes and remove the stream directories.
+ */
+void StreamsStop(StreamGroup *g);
+
+#endif /* ENGINE_STREAMS_H */
@@ -0,0 +1,166 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * I/O trace format, recorder and replay scheduler.
+ *
+ * This module only uses the C library (stdio/malloc), never IExec or IDOS,
+ * so the parser and replay logic can be built and exercised on a host.
+ */
+
+#ifndef ENGINE_TRACE_H
+#define ENGINE_TRACE_H
+
+#include "platform.h"
+
+/*
+ * On-disk format (all fields big-endian):
+ *
+ *   Header, 16 bytes:  magic "ADBT", uint16 version, uint16 reserved,
+ *                      uint32 record count, uint32 reserved
+ *   Record, 20 bytes:  uint8 op, uint8 reserved, uint16 reserved,
+ *                      uint32 length, uint64 offset, uint32 think_us
+ *
+ * think_us is the time from the previous record's issue to this one's, so
+ * the first record's value is the delay after the start of replay.
+ */
+#define TRACE_MAGIC 0x41444254 /* 'ADBT' */
+#define TRACE_VERSION 1
+#define TRACE_HEADER_SIZE 16
+#define TRACE_RECORD_SIZE 20
+
+#define TRACE_MAX_RECORDS (1024 * 1024)        /* Refuse larger traces on load (20 MB) */
+#define TRACE_MAX_IO_LENGTH (16 * 1024 * 1024) /* Largest single I/O accepted */
+#define TRACE_RECORD_CAPACITY 65536            /* Records captured by record mode (~1.3 MB) */
+
+typedef enum
+{
+    TRACE_OP_READ = 0,
+    TRACE_OP_WRITE = 1,
+    TRACE_OP_FLUSH = 2, /* Length and offset are ignored */
+    TRACE_OP_COUNT
+} TraceOp;
+
+typedef struct
+{
+    uint64 offset;
+    uint32 length;
+    uint32 think_us;
+    uint8 op; /* TraceOp */
+} TraceRecord;
+
+/**
+ * @brief An in-memory trace plus the extents derived from it on load.
+ */
+typedef struct
+{
+    TraceRecord *records;
+    uint32 count;
+    uint32 capacity;
+    uint64 span_bytes;   /* Highest offset + length touched (file size needed for replay) */
+    uint32 max_length;   /* Largest single I/O (buffer size needed for replay) */
+    uint64 total_bytes;  /* Bytes read + written by one pass over the trace */
+    uint64 duration_us;  /* Sum of think times (recorded length of the trace) */
+} TraceData;
+
+/**
+ * @brief Allocate an empty trace able to hold capacity records.
+ * @return TRUE on success.
+ */
+BOOL TraceAlloc(TraceData *t, uint32 capacity);
+
+/**
+ * @brief Append a record and update the derived extents.
+ * @return FALSE if the trace is full or the record is invalid.
+ */
+BOOL TraceAppend(TraceData *t, uint8 op, uint64 offset, uint32 length, uint32 think_us);
+
+/**
+ * @brief Release the record array.
+ */
+void TraceFree(TraceData *t);
+
+/**
+ * @brief Decode a trace from a memory buffer holding the complete file.
+ *
+ * @param err Receives a one-line reason on failure (may be NULL).
+ * @return TRUE on success; t is allocated and must be released with TraceFree.
+ */
+BOOL TraceDecode(TraceData *t, const uint8 *buf, uint32 size, char *err, uint32 err_size);
+
+/**
+ * @brief Load and validate a trace file.
+ *
+ * @param err Receives a one-line reason on failure (may be NULL).
+ * @return TRUE on success; t must be released with TraceFree.
+ */
+BOOL TraceLoad(TraceData *t, const char *path, char *err, uint32 err_size);
+
+/**
+ * @brief Write a trace file.
+ * @return TRUE on success.
+ */
+BOOL TraceSave(const TraceData *t, const char *path);
+
+/**
+ * @brief Captures a workload's I/O into a preallocated trace.
+ *
+ * Appending never allocates, so it is safe inside a timed loop. Records past
+ * the capacity are counted in 'dropped' and not stored.
+ */
+typedef struct TraceRecorder
+{
+    TraceData data;
+    uint64 last_us;  /* Issue time of the previous record */
+    BOOL started;
+    uint32 dropped;
+} TraceRecorder;
+
+BOOL TraceRecorderInit(TraceRecorder *r, uint32 capacity);
+
+/**
+ * @brief Log one operation issued at now_us (any monotonic microsecond clock).
+ *
+ * Safe to call with a NULL recorder.
+ */
+void TraceRecorderAdd(TraceRecorder *r, uint8 op, uint64 offset, uint32 length, uint64 now_us);
+
+void TraceRecorderFree(TraceRecorder *r);
+
+/**
+ * @brief Replay scheduler: hands out records and, in open-loop mode, when to issue them.
+ *
+ * Closed-loop replay issues each record as soon as the previous one completes.
+ * Open-loop replay issues record i at start + sum(think_us[0..i]) regardless of
+ * how long earlier I/Os took; when the device falls behind, records are issued
+ * immediately and the lateness is accumulated in the lag counters. The trace
+ * wraps around, with the schedule continuing, so time-bounded passes can run
+ * longer than the recording.
+ */
+typedef struct
+{
+    const TraceData *trace;
+    uint32 next;
+    BOOL open_loop;
+    uint64 due_us;       /* Scheduled issue time of the record returned last */
+    uint32 loops;        /* Completed passes over the trace */
+    uint32 late_ops;     /* Open-loop records issued after their scheduled time */
+    uint64 total_lag_us;
+    uint64 max_lag_us;
+} TraceReplayer;
+
+/**
+ * @brief Start replaying a trace at now_us.
+ */
+void TraceReplayBegin(TraceReplayer *r, const TraceData *t, BOOL open_loop, uint64 now_us);
+
+/**
+ * @brief Next record to issue.
+ *
+ * @param now_us Current time on the clock passed to TraceReplayBegin.
+ * @param wait_us Receives how long to wait before issuing it (always 0 closed-loop).
+ * @return The record, or NULL for an empty trace.
+ */
+const TraceRecord *TraceReplayNext(TraceReplayer *r, uint64 now_us, uint64 *wait_us);
+
+#endif /* ENGINE_TRACE_H */
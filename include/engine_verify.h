@@ -0,0 +1,108 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Verify mode: checking that the data read back is the data written.
+ *
+ * With BenchOptions.verify set, writers stamp every 512-byte sector of the
+ * file with a self-describing pattern instead of the 0xAA fill:
+ *
+ *   magic    "ADBV"
+ *   seed     the job's seed, so data left by another run does not pass
+ *   offset   the sector's own file offset, so a misplaced sector fails
+ *   payload  xorshift stream seeded from seed and offset
+ *   crc      CRC32C of everything before it
+ *
+ * Readers recompute the CRC of each whole sector they read and compare the
+ * tags. The CRC is the table-driven slicing-by-8 form, which consumes eight
+ * bytes per step and keeps the check well below the speed of the I/O.
+ *
+ * Stamping and checking are timed on their own: the time is taken out of
+ * the pass (SamplerExclude) and reported as verify_secs, so throughput is
+ * the same with and without verification.
+ */
+
+#ifndef ENGINE_VERIFY_H
+#define ENGINE_VERIFY_H
+
+#include "engine.h"
+#include "engine_sampler.h"
+#include "platform.h"
+
+#define VERIFY_SECTOR_BYTES 512
+#define VERIFY_MAGIC 0x41444256 /* "ADBV" */
+#define VERIFY_DEFAULT_SEED 0x5EED0001 /* Used when the job has no access_seed */
+
+typedef struct
+{
+    BOOL enabled;
+    uint32 seed;
+    uint64 bytes_checked;     /* Bytes of whole sectors compared */
+    uint32 bad_sectors;
+    uint64 first_bad_offset;  /* File offset of the first bad sector (valid when bad_sectors > 0) */
+    BenchTicks ticks;         /* Time spent stamping and checking */
+    BOOL cache_warned;        /* VerifyFile could not drop the cache and said so (once per job) */
+} VerifyState;
+
+/**
+ * @brief Build the CRC32C tables (called by InitEngine).
+ */
+void VerifyTablesInit(void);
+
+/**
+ * @brief CRC32C (Castagnoli) of a buffer, continuing from crc (0 to start).
+ */
+uint32 Crc32c(uint32 crc, const void *data, uint32 len);
+
+/**
+ * @brief Enable verification as requested by opts and clear the counters.
+ */
+void VerifyInit(VerifyState *v, const BenchOptions *opts);
+
+/**
+ * @brief Clear the counters at the start of a pass (the seed is kept).
+ */
+void VerifyReset(VerifyState *v);
+
+/**
+ * @brief Add another instance's counters (streams, passes) to dest.
+ */
+void VerifyMerge(VerifyState *dest, const VerifyState *src);
+
+/**
+ * @brief Stamp a buffer about to be written at offset.
+ *
+ * Sectors only partly inside the buffer get their part of the stamp, so a
+ * file written in chunks of any size reads back as whole stamped sectors.
+ *
+ * @param s Sampler of the pass, told to leave the time out (may be NULL).
+ */
+void VerifyStamp(VerifyState *v, BenchSampler *s, uint8 *buf, uint32 len, uint64 offset);
+
+/**
+ * @brief Check the whole sectors of a buffer read from offset.
+ *
+ * @param s Sampler of the pass, told to leave the time out (may be NULL).
+ * @return TRUE if every sector matched.
+ */
+BOOL VerifyCheck(VerifyState *v, BenchSampler *s, const uint8 *buf, uint32 len, uint64 offset);
+
+/**
+ * @brief Read a file back after writing it and check every sector.
+ *
+ * The volume is flushed and its cache dropped first, so the data comes from
+ * the medium and corruption on the write path is caught rather than the copy
+ * still in the filesystem's buffers.
+ *
+ * @param volume Target holding the file, whose cache is dropped.
+ * @param chunk Read size.
+ * @return FALSE if the file could not be read or a sector failed.
+ */
+BOOL VerifyFile(VerifyState *v, BenchSampler *s, const char *path, const char *volume, uint64 size, uint32 chunk);
+
+/**
+ * @brief Time spent stamping and checking, in seconds.
+ */
+double VerifySeconds(const VerifyState *v);
+
+#endif /* ENGINE_VERIFY_H */
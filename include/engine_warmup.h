@@ -8,7 +8,7 @@
 #ifndef ENGINE_WARMUP_H
 #define ENGINE_WARMUP_H
 
-#include <exec/types.h>
+#include "platform.h"
 
 /*
  * RunWarmup
@@ -42,5 +42,16 @@ extern const BenchWorkload Workload_Profiler;
 extern const BenchWorkload Workload_SequentialRead;
 extern const BenchWorkload Workload_Random4KRead;
 extern const BenchWorkload Workload_MixedRW;
+extern const BenchWorkload Workload_TraceReplay;
+extern const BenchWorkload Workload_RawSeqRead;
+extern const BenchWorkload Workload_RawRandomRead;
+extern const BenchWorkload Workload_RawZoneScan;
+extern const BenchWorkload Workload_RawSeekProfile;
+extern const BenchWorkload Workload_RawQueueDepth;
+extern const BenchWorkload Workload_CacheSweep;
+extern const BenchWorkload Workload_ReadAhead;
+extern const BenchWorkload Workload_BufferedIo;
+extern const BenchWorkload Workload_DirScaling;
+extern const BenchWorkload Workload_CommitLog;
 
 #endif /* ENGINE_WORKLOADS_H */
@@ -0,0 +1,58 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Throughput map over the LBA range of a raw device.
+ *
+ * A mechanical drive delivers more on its outer tracks (low LBAs) than on
+ * its inner ones. The zone scan reads the same span at evenly spaced
+ * positions from the first to the last LBA; the per-zone rates, summed over
+ * all passes, become BenchResult.zone_mbps. Zones well below the straight
+ * outer-to-inner trend are flagged as possible weak areas.
+ */
+
+#ifndef ENGINE_ZONEMAP_H
+#define ENGINE_ZONEMAP_H
+
+#include "engine.h"
+#include "engine_timing.h"
+
+#define ZONE_WEAK_PCT 25 /* A zone this far below the trend is flagged */
+
+typedef struct
+{
+    uint32 zones;
+    uint64 span_bytes;             /* Read at each position */
+    uint64 offset[ZONE_MAP_MAX];   /* Start of each zone, sector-aligned */
+    uint64 bytes[ZONE_MAP_MAX];
+    BenchTicks ticks[ZONE_MAP_MAX];
+} ZoneStats;
+
+/**
+ * @brief Lay out zones spans of span_bytes evenly over the device, the last ending at its end.
+ *
+ * @return FALSE if the spans do not fit on the device.
+ */
+BOOL ZoneStatsInit(ZoneStats *z, uint64 capacity_bytes, uint32 block_bytes, uint32 zones, uint64 span_bytes);
+
+/**
+ * @brief Clear the counters at the start of a pass (the layout is kept).
+ */
+void ZoneStatsReset(ZoneStats *z);
+
+/**
+ * @brief Add another instance's counters (streams, passes) to dest, taking its layout if dest has none.
+ */
+void ZoneStatsMerge(ZoneStats *dest, const ZoneStats *src);
+
+/**
+ * @brief Count bytes read in one zone from start until now.
+ */
+void ZoneStatsRecord(ZoneStats *z, uint32 zone, uint64 bytes, BenchTicks start);
+
+/**
+ * @brief Store the per-zone rates in a result and flag (and log) the weak zones.
+ */
+void ZoneStatsToResult(const ZoneStats *z, BenchResult *out);
+
+#endif /* ENGINE_ZONEMAP_H */
@@ -54,6 +54,8 @@ typedef struct
     uint32 block_size;
     uint32 averaging_method;  /* AveragingMethod enum value */
     BOOL flush_cache;
+    BenchOptions options;     /* Run mode (time-bounded passes etc.) */
+    BOOL last_in_queue;       /* Nothing queued behind this job: delete cached fixtures afterwards */
     struct MsgPort *reply_port;
 } BenchJob;
 
@@ -198,6 +200,7 @@ typedef struct
     char csv_path[MAX_PATH_LEN];
     BOOL delete_prefs_needed;
     BOOL flush_cache;
+    BenchOptions bench_options; /* Run-mode defaults copied into every job */
     uint32 jobs_pending;
 
     /* Current Benchmark Settings (Decoupled from Gadgets) */
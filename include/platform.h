@@ -0,0 +1,250 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Platform layer for the benchmark engine: file I/O, memory, timing and
+ * processes. The engine and workloads only call these, so the same sources
+ * build for AmigaOS (platform_amiga.c) and for a POSIX host
+ * (platform_posix.c, used by the headless diskbench tool).
+ */
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#ifdef __amigaos4__
+
+#include <devices/timer.h>
+#include <dos/dos.h>
+#include <exec/ports.h>
+#include <exec/types.h>
+#include <proto/dos.h>
+#include <proto/exec.h>
+
+typedef BPTR PlatFile;
+typedef struct MsgPort PlatPort;
+typedef struct Message PlatMsg;
+
+#else /* POSIX host */
+
+#include <stdint.h>
+
+typedef uint8_t uint8;
+typedef int8_t int8;
+typedef uint16_t uint16;
+typedef int16_t int16;
+typedef uint32_t uint32;
+typedef int32_t int32;
+typedef uint64_t uint64;
+typedef int64_t int64;
+typedef int16 BOOL;
+typedef void *APTR;
+typedef char *STRPTR;
+typedef const char *CONST_STRPTR;
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+typedef long PlatFile;
+typedef struct PlatPort PlatPort;
+
+typedef struct PlatMsg
+{
+    struct PlatMsg *next;
+    PlatPort *reply_port;
+} PlatMsg;
+
+#endif /* __amigaos4__ */
+
+/* PlatAllocAligned memory types */
+#define PLAT_MEM_SHARED 0  /* MEMF_SHARED, what PlatAlloc hands out */
+#define PLAT_MEM_PRIVATE 1 /* MEMF_PRIVATE, may be paged out */
+#define PLAT_MEM_LOCKED 2  /* MEMF_SHARED, physically contiguous and locked (ready for DMA) */
+
+/* PlatOpen modes, as the matching dos.library MODE_* */
+#define PLAT_OPEN_EXISTING 0  /* Existing file, read/write (MODE_OLDFILE) */
+#define PLAT_OPEN_NEW 1       /* Create or truncate (MODE_NEWFILE) */
+#define PLAT_OPEN_READWRITE 2 /* Existing file, or create it (MODE_READWRITE) */
+
+/**
+ * @brief Set up the timer and anything else the backend needs.
+ * @return TRUE on success.
+ */
+BOOL PlatInit(void);
+
+void PlatCleanup(void);
+
+/* --- Files --- */
+
+/**
+ * @return The file handle, or 0 on failure.
+ */
+PlatFile PlatOpen(const char *path, uint32 mode);
+void PlatClose(PlatFile file);
+
+/**
+ * @return Bytes transferred (short at end of file), or -1 on error.
+ */
+int32 PlatRead(PlatFile file, void *buffer, uint32 length);
+int32 PlatWrite(PlatFile file, const void *buffer, uint32 length);
+
+/**
+ * @brief Open a file behind a buffer of buffer_size bytes (FOpen; stdio on a host).
+ *
+ * Handles from PlatFOpen are only used with PlatFRead, PlatFWrite and
+ * PlatFClose, which go through the buffer as FRead/FWrite do.
+ *
+ * @param buffer_size Buffer bytes (0 = the default of the DOS or C library).
+ * @return The file handle, or 0 on failure.
+ */
+PlatFile PlatFOpen(const char *path, uint32 mode, uint32 buffer_size);
+
+/**
+ * @brief Flush the buffer and close a handle from PlatFOpen.
+ * @return TRUE if the buffered data was written out.
+ */
+BOOL PlatFClose(PlatFile file);
+
+/**
+ * @return Bytes transferred, short at end of file or on error.
+ */
+int32 PlatFRead(PlatFile file, void *buffer, uint32 length);
+int32 PlatFWrite(PlatFile file, const void *buffer, uint32 length);
+
+/**
+ * @brief Move the file position to a byte offset from the start (may exceed 4 GB).
+ * @return TRUE on success.
+ */
+BOOL PlatSeek(PlatFile file, uint64 offset);
+
+/**
+ * @brief Make everything written to file durable (path names the file, for its volume).
+ *
+ * AmigaOS flushes the handle (FFlush) and then the volume (FlushVolume), as
+ * there is no per-file sync; a host uses fdatasync.
+ *
+ * @return TRUE if the data reached the device.
+ */
+BOOL PlatSyncFile(PlatFile file, const char *path);
+
+BOOL PlatDelete(const char *path);
+BOOL PlatRename(const char *from, const char *to);
+
+/**
+ * @return TRUE if the directory exists afterwards (created now or left over).
+ */
+BOOL PlatCreateDir(const char *path);
+
+/**
+ * @brief Look a path up by name (Lock and UnLock on AmigaOS).
+ * @return TRUE if it exists.
+ */
+BOOL PlatExists(const char *path);
+
+/**
+ * @brief Read every entry of a directory (ExamineDir on AmigaOS).
+ * @return Number of entries, or -1 if the directory could not be read to the end.
+ */
+int32 PlatScanDir(const char *path);
+
+/**
+ * @brief Write out everything the filesystem holds in memory for the volume of path.
+ * @return TRUE if the flush was done.
+ */
+BOOL PlatFlushVolume(const char *path);
+
+/**
+ * @brief Inhibit (TRUE) or release (FALSE) the filesystem of path's volume.
+ *
+ * Releasing makes the filesystem revalidate the volume and start with empty
+ * buffers. Fails while files on the volume are open (and always on a host).
+ */
+BOOL PlatInhibit(const char *path, BOOL inhibit);
+
+/**
+ * @brief Drop the read cache of path's volume by filesystem-specific means.
+ *
+ * AmigaOS shrinks the filesystem's buffer pool to one buffer and restores it;
+ * a host drops the page cache (root) or advises it away file by file.
+ *
+ * @return TRUE if the cache was dropped.
+ */
+BOOL PlatDropVolumeCache(const char *path);
+
+/* --- Memory (shareable between engine processes) --- */
+
+void *PlatAlloc(uint32 size);
+void *PlatAllocClear(uint32 size);
+void PlatFree(void *mem);
+
+/**
+ * @brief Allocate memory of a PLAT_MEM_* type starting on an align-byte boundary (a power of two).
+ *
+ * A host has no memory types; every type is plain aligned memory there.
+ * Freed with PlatFree.
+ */
+void *PlatAllocAligned(uint32 size, uint32 align, uint32 mem_type);
+
+/**
+ * @brief Free memory in bytes (what a file cache could still grow into).
+ */
+uint64 PlatAvailMemory(void);
+
+/* --- Time --- */
+
+/**
+ * @brief Free-running 64-bit tick counter (EClock on AmigaOS, monotonic nanoseconds on POSIX).
+ */
+uint64 PlatReadTicks(void);
+
+/**
+ * @brief Ticks per second of PlatReadTicks.
+ */
+uint64 PlatTickFrequency(void);
+
+/**
+ * @brief Sleep for about the given time (AmigaOS: rounded down to 1/50 s ticks).
+ */
+void PlatSleepMicros(uint32 micros);
+
+/* --- Processes and messages --- */
+
+/**
+ * @brief Message port; messages are owned by the receiver until replied.
+ */
+PlatPort *PlatCreatePort(void);
+void PlatDeletePort(PlatPort *port);
+
+/**
+ * @brief Prepare a message whose replies go to reply_port.
+ */
+void PlatInitMsg(PlatMsg *msg, PlatPort *reply_port, uint32 length);
+
+void PlatPutMsg(PlatPort *port, PlatMsg *msg);
+
+/**
+ * @brief Block until a message arrives and take it off the port.
+ */
+PlatMsg *PlatWaitMsg(PlatPort *port);
+
+void PlatReplyMsg(PlatMsg *msg);
+
+/**
+ * @brief Start a child process (a thread on POSIX) running entry.
+ *
+ * The child reads its commands from its own port (PlatOwnPort); the process
+ * ends when entry returns.
+ *
+ * @return The child's port, or NULL if it could not be started.
+ */
+PlatPort *PlatStartProcess(const char *name, void (*entry)(void), uint32 stack_size);
+
+/**
+ * @brief The calling process's own port (inside a PlatStartProcess entry).
+ */
+PlatPort *PlatOwnPort(void);
+
+#endif /* PLATFORM_H */
@@ -36,6 +36,11 @@ typedef enum {
     VIZ_SRC_BLOCK_SIZE = 0,
     VIZ_SRC_TIMESTAMP,
     VIZ_SRC_TEST_INDEX,
+    VIZ_SRC_WORKING_SET,
+    VIZ_SRC_DIR_ENTRIES,
+    VIZ_SRC_COMMIT_GROUP,
+    VIZ_SRC_QUEUE_DEPTH,
+    VIZ_SRC_IO_BUFFER,
     VIZ_SRC_COUNT
 } VizXSource;
 
@@ -46,9 +51,18 @@ typedef enum {
     VIZ_SRC_MAX_MBPS,
     VIZ_SRC_DURATION_SECS,
     VIZ_SRC_TOTAL_BYTES,
+    VIZ_SRC_CREATE_OPS, /* Metadata ops/sec of one operation class, in MetaOp order */
+    VIZ_SRC_LOOKUP_OPS,
+    VIZ_SRC_SCAN_OPS,
+    VIZ_SRC_RENAME_OPS,
+    VIZ_SRC_DELETE_OPS,
+    VIZ_SRC_MKDIR_OPS,
+    VIZ_SRC_RMDIR_OPS,
     VIZ_SRC_COUNT_Y
 } VizYSource;
 
+#define VIZ_SRC_IS_META_OP(src) ((src) >= VIZ_SRC_CREATE_OPS && (src) < VIZ_SRC_CREATE_OPS + META_OP_COUNT)
+
 typedef enum {
     VIZ_GROUP_DRIVE = 0,
     VIZ_GROUP_TEST_TYPE,
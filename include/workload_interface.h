@@ -7,16 +7,61 @@
 #define WORKLOAD_INTERFACE_H
 
 #include "engine.h"
-#include <exec/types.h>
+#include "engine_latency.h"
+#include "engine_metaops.h"
+#include "engine_readahead.h"
+#include "engine_sampler.h"
+#include "engine_seekmap.h"
+#include "engine_verify.h"
+#include "engine_zonemap.h"
+#include "platform.h"
 
 /*
  * Workload Lifecycle Hooks
  *
  * Setup: Called before measurement starts. 'data' is a pointer to private workload data.
- * Run: The timed portion of the benchmark.
+ *        'opts' carries the job's run-mode options (never NULL).
+ * Run: The timed portion of the benchmark. Byte counts are 64-bit so multi-gigabyte
+ *      data sets and long time-bounded passes are reported without clamping.
  * Cleanup: Called after measurement ends (even on failure).
+ *
+ * Optional hooks (may be NULL):
+ * GetLatency: Returns the per-operation latency histogram filled by the last Run.
+ * SetSampler: Called once after Setup with the engine's sampler. Run should then
+ *             call SamplerUpdate() after each operation so throughput is sampled
+ *             within the pass rather than once per pass.
+ * PreparePass: Called before each pass, outside the timed region, so per-pass
+ *              setup such as generating an offset sequence is not measured.
+ * SetFilesOpen: Close (FALSE) and reopen (TRUE) the workload's files between
+ *               passes. Lets the cold-cache Inhibit strategy take the volume
+ *               offline; workloads without it fall back to an eviction file.
+ * GetVerify: Returns the verify-mode counters of the last Run (engine_verify.h).
+ *            Workloads that stamp or check data in verify mode provide it.
+ * GetMetaOps: Returns the per-class metadata counters of the last Run
+ *             (engine_metaops.h), merged into BenchResult.meta_ops.
+ * GetZones: Returns the per-zone counters of the last Run (engine_zonemap.h),
+ *           merged into the BenchResult zone map.
+ * GetSeeks: Returns the per-distance latencies of the last Run (engine_seekmap.h),
+ *           merged into the BenchResult seek profile.
+ * GetStrides: Returns the per-gap latencies of the last Run (engine_readahead.h),
+ *             merged into the BenchResult read-ahead probe.
+ *
+ * Flags:
+ * WORKLOAD_F_ACCESS_PATTERN: Offsets follow the job's access pattern (BenchOptions),
+ *                            which is then recorded in the result.
+ * WORKLOAD_F_TRACEABLE: All I/O goes to a single file and is reported through
+ *                       SamplerTraceIO(), so record mode can capture it.
+ * WORKLOAD_F_DATA_PATTERN: Writes come from a DataPattern (engine_pattern.h) following
+ *                          the job's data_random_pct, which is then recorded in the result.
+ * WORKLOAD_F_BUFFER_PLACEMENT: Transfers go through XferBuffers (engine_buffer.h), so the
+ *                              job's buffer_mem and buffer_offset apply and are recorded.
  */
 
+#define WORKLOAD_F_ACCESS_PATTERN 0x0001
+#define WORKLOAD_F_TRACEABLE 0x0002
+#define WORKLOAD_F_DATA_PATTERN 0x0004
+#define WORKLOAD_F_BUFFER_PLACEMENT 0x0008
+
 typedef struct
 {
     BenchTestType type;
@@ -25,12 +70,25 @@ typedef struct
     const char *detailed_info; /* Paragraph-length explanation for user popup */
 
     /* Lifecycle hooks */
-    BOOL (*Setup)(const char *path, uint32 block_size, void **data);
-    BOOL (*Run)(void *data, uint32 *bytes_processed, uint32 *op_count);
+    BOOL (*Setup)(const char *path, uint32 block_size, const BenchOptions *opts, void **data);
+    BOOL (*Run)(void *data, uint64 *bytes_processed, uint32 *op_count);
     void (*Cleanup)(void *data);
 
     /* Metadata hooks */
     void (*GetDefaultSettings)(uint32 *block_size, uint32 *passes);
+
+    /* Optional measurement hooks */
+    const LatencyHistogram *(*GetLatency)(void *data);
+    void (*SetSampler)(void *data, BenchSampler *sampler);
+    void (*PreparePass)(void *data);
+    BOOL (*SetFilesOpen)(void *data, BOOL open);
+    const VerifyState *(*GetVerify)(void *data);
+    const MetaOpStats *(*GetMetaOps)(void *data);
+    const ZoneStats *(*GetZones)(void *data);
+    const SeekStats *(*GetSeeks)(void *data);
+    const StrideStats *(*GetStrides)(void *data);
+
+    uint32 flags; /* WORKLOAD_F_* */
 } BenchWorkload;
 
 #endif /* WORKLOAD_INTERFACE_H */
@@ -38,6 +38,7 @@ void EnqueueBenchmarkJob(BenchJob *job)
         /* Fallback: If we can't queue, try to send directly if idle, or fail */
         if (!ui.worker_busy) {
             LOG_DEBUG("BenchmarkQueue: Sending directly (emergency fallback)");
+            job->last_in_queue = TRUE;
             ui.worker_busy = TRUE;
             SetGadgetState(GID_RUN_ALL, TRUE);
             IIntuition->SetGadgetAttrs((struct Gadget *)ui.status_light_obj, ui.window, NULL, LABEL_Text,
@@ -85,6 +86,10 @@ void DispatchNextJob(void)
         if (job) {
             LOG_DEBUG("BenchmarkQueue: Dispatching job for '%s'", job->target_path);
 
+            /* Fixtures stay on disk for the jobs queued behind this one */
+            job->options.reuse_fixtures = TRUE;
+            job->last_in_queue = IsListEmpty(&ui.benchmark_queue);
+
             ui.worker_busy = TRUE;
 
             /* Ensure UI reflects busy state */
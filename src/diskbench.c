@@ -0,0 +1,621 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * diskbench: headless driver for the benchmark engine on a POSIX host.
+ * Runs one workload against a directory and appends the result to the same
+ * CSV history the GUI writes, so engine changes can be profiled and checked
+ * without an AmigaOS machine.
+ */
+
+#include "engine.h"
+#include "engine_buffer.h"
+#include "engine_fixture.h"
+#include "engine_workloads.h"
+#include "version.h"
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/stat.h>
+
+#define DISKBENCH_DEFAULT_CSV "diskbench.csv"
+#define DISKBENCH_MAX_JOBS 32
+
+void LogUser(const char *fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+static void PrintProgress(const char *status_text, BOOL finished)
+{
+    (void)finished;
+    fprintf(stderr, "%s\n", status_text);
+}
+
+static void PrintUsage(const char *prog)
+{
+    fprintf(stderr,
+            "Usage: %s [options] TEST DIRECTORY\n"
+            "\n"
+            "  -p, --passes N         Passes (default: the workload's own default)\n"
+            "  -b, --block-size N     Block size in bytes (default: the workload's own default)\n"
+            "  -a, --averaging N      0 all passes, 1 trimmed mean, 2 median, 3 adaptive\n"
+            "  -f, --flush            Flush the volume before the run\n"
+            "  -o, --csv FILE         CSV history to append to (default " DISKBENCH_DEFAULT_CSV ")\n"
+            "  -d, --duration SECS    Time-bounded passes\n"
+            "  -m, --dataset-mb N     Test file size for sequential/random workloads\n"
+            "  -s, --streams N        Scaling run: 1, 2, 4, ... up to N concurrent workload instances (max %d)\n"
+            "  -r, --raw-image FILE   Image file read by the raw workloads\n"
+            "  -t, --trace FILE       Trace to replay (TraceReplay) or to record (with --record)\n"
+            "      --record           Record the first pass of a traceable workload to --trace\n"
+            "      --open-loop        Replay the trace at its recorded timing\n"
+            "      --seed N           Access-pattern PRNG seed\n"
+            "      --cache-mode N     0 normal, 1 cold (evict before each pass), 2 paired cold/warm\n"
+            "      --evict N          Eviction for --cache-mode: 0 file, 1 inhibit, 2 filesystem\n"
+            "      --working-set-kb N CacheSweep: one working set instead of the full sweep\n"
+            "      --verify           Stamp written data and check it on read (a mismatch fails the job)\n"
+            "      --random-pct N     Share of random bytes in written data, 0-100 (default 0, constant fill)\n"
+            "      --dir-entries N    DirScaling: one directory size instead of the full sweep\n"
+            "      --commit-group N   CommitLog: records per flush instead of the 1/4/16 sweep\n"
+            "      --zones N          RawZoneScan: LBA positions to read, 2-%d (default %d)\n"
+            "      --queue-depth N    RawQueueDepth: requests in flight (1-%d) instead of the 1-32 sweep\n"
+            "      --io-buffer N      BufferedIO: FOpen buffer bytes, or none for Read/Write, instead of the sweep\n"
+            "      --buffer-mem N     Transfer buffer memory: 1 shared, 2 private, 3 locked (default: plain allocation)\n"
+            "      --buffer-offset N  Transfer buffer start past an 8 KB boundary, with --buffer-mem\n"
+            "      --buffer-sweep     Run each test once per buffer offset and memory type, where supported\n"
+            "  -l, --list             List the tests and exit\n"
+            "\n"
+            "TEST is a CSV test name such as Sprinter or Random4K, or a comma-separated\n"
+            "list run as a queue (pre-filled data files are reused between its jobs).\n",
+            prog, STREAMS_MAX, ZONE_MAP_MAX, ZONE_MAP_MAX, QUEUE_DEPTH_MAX);
+}
+
+static void ListTests(void)
+{
+    for (uint32 i = 0; i < TEST_COUNT; i++) {
+        const BenchWorkload *w = GetWorkloadByType((BenchTestType)i);
+        if (w)
+            printf("%-16s %s\n", TestTypeToString((BenchTestType)i), w->description);
+    }
+}
+
+/* out_result, if not NULL, receives the result of a successful job */
+static BOOL RunJob(BenchTestType type, const char *target, uint32 passes, uint32 block_size, uint32 averaging,
+                   BOOL flush, const BenchOptions *opts, const char *csv_path, BenchResult *out_result)
+{
+    const BenchWorkload *workload = GetWorkloadByType(type);
+    if (workload->GetDefaultSettings) {
+        uint32 default_block = 0, default_passes = 0;
+        workload->GetDefaultSettings(&default_block, &default_passes);
+        if (block_size == 0)
+            block_size = default_block;
+        if (passes == 0)
+            passes = default_passes;
+    }
+    if (passes == 0)
+        passes = 3;
+
+    fprintf(stderr, "diskbench %s: %s on %s, %u passes, block %u\n", APP_VERSION_STR, workload->name, target,
+            (unsigned int)passes, (unsigned int)block_size);
+
+    BenchResult result;
+    if (!RunBenchmark(type, target, passes, block_size, averaging, flush, opts, PrintProgress, &result, NULL)) {
+        fprintf(stderr, "diskbench: %s on %s failed\n", TestTypeToString(type), target);
+        return FALSE;
+    }
+
+    if (!SaveResultToCSV(csv_path, &result))
+        fprintf(stderr, "diskbench: could not append to %s\n", csv_path);
+    printf("%s: %.2f MB/s, %u IOPS, %u passes", TestTypeToString(type), result.mb_per_sec, (unsigned int)result.iops,
+           (unsigned int)result.effective_passes);
+    if (result.lat_p99_us > 0.0f)
+        printf(", p50 %.0f us, p99 %.0f us", result.lat_p50_us, result.lat_p99_us);
+    if (result.streams > 1)
+        printf(", %u streams at %.2f MB/s and %u IOPS each, slowest %.2f MB/s", (unsigned int)result.streams,
+               result.stream_mbps, (unsigned int)result.stream_iops, result.slow_stream_mbps);
+    if (result.commit_group > 0)
+        printf(", %u records per commit", (unsigned int)result.commit_group);
+    if (result.queue_depth > 0)
+        printf(", %u in flight", (unsigned int)result.queue_depth);
+    if (result.buffer_mem != BUFFER_MEM_DEFAULT)
+        printf(", %s buffer +%u", BufferMemName(result.buffer_mem), (unsigned int)result.buffer_offset);
+    if (result.io_buffer == IO_BUFFER_NONE)
+        printf(", Read/Write");
+    else if (result.io_buffer > 0)
+        printf(", FRead/FWrite with a %u-byte buffer", (unsigned int)result.io_buffer);
+    if (result.data_pattern[0])
+        printf(", data %s", result.data_pattern);
+    if (result.warm_mbps > 0.0f)
+        printf(", warm %.2f MB/s (%.1fx)", result.warm_mbps, result.cache_speedup);
+    if (result.verify_errors > 0)
+        printf(", VERIFY FAILED: %u bad sectors", (unsigned int)result.verify_errors);
+    else if (result.verify_bytes > 0)
+        printf(", verified %.1f MB in %.2f s", (double)result.verify_bytes / (1024.0 * 1024.0), result.verify_secs);
+    printf("\n");
+    for (uint32 op = 0; op < META_OP_COUNT; op++) {
+        const MetaOpResult *m = &result.meta_ops[op];
+        if (m->count > 0 && m->secs > 0.0f)
+            printf("  %-9s %10.0f ops/s (%u in %.3f s), p50 %.0f us, p99 %.0f us\n", MetaOpName((MetaOp)op),
+                   (double)MetaOpRate(m), (unsigned int)m->count, m->secs, m->p50_us, m->p99_us);
+    }
+    for (uint32 z = 0; z < result.zone_count; z++)
+        printf("  zone %2u %3u%% %8.1f MB/s%s\n", (unsigned int)z, (unsigned int)(z * 100 / (result.zone_count - 1)),
+               result.zone_mbps[z], (result.zone_weak_mask & (1UL << z)) ? "  weak" : "");
+    for (uint32 i = 0; i < result.seek_levels; i++)
+        printf("  seek %15llu bytes %8.0f us\n", (unsigned long long)result.seek_dist_bytes[i], result.seek_us[i]);
+    if (result.seek_levels > 1)
+        printf("  rotation %.0f us, track-to-track %.0f us, full stroke %.0f us\n", result.seek_rotation_us,
+               result.seek_track_us, result.seek_full_us);
+    for (uint32 i = 0; i < result.stride_levels; i++)
+        printf("  gap %10u bytes %8.0f us fwd %8.0f us back\n", (unsigned int)result.stride_gap_bytes[i],
+               result.stride_fwd_us[i], result.stride_back_us[i]);
+    if (result.stride_levels > 0)
+        printf("  random %.0f us, read-ahead %u bytes, read-behind %u bytes\n", result.stride_random_us,
+               (unsigned int)result.readahead_bytes, (unsigned int)result.readbehind_bytes);
+    if (out_result)
+        *out_result = result;
+    return (result.verify_errors == 0);
+}
+
+/* One job per stream count, then each count's total against a single stream; returns the number of failed jobs */
+static uint32 RunStreamSweep(BenchTestType type, const char *target, uint32 passes, uint32 block_size,
+                             uint32 averaging, BOOL flush, const BenchOptions *opts, const char *csv_path)
+{
+    uint32 levels[STREAMS_MAX_LEVELS];
+    uint32 count = GetStreamLevels(opts->streams, levels, STREAMS_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    uint32 streams[STREAMS_MAX_LEVELS];
+    float mbps[STREAMS_MAX_LEVELS];
+    uint32 measured = 0;
+    uint32 failed = 0;
+    for (uint32 i = 0; i < count; i++) {
+        BenchResult result;
+        sweep.streams = levels[i];
+        fprintf(stderr, "diskbench: %u concurrent streams\n", (unsigned int)levels[i]);
+        if (!RunJob(type, target, passes, block_size, averaging, flush, &sweep, csv_path, &result)) {
+            failed++;
+            continue;
+        }
+        streams[measured] = levels[i];
+        mbps[measured++] = result.mb_per_sec;
+    }
+    if (measured > 1 && streams[0] == 1 && mbps[0] > 0.0f) {
+        for (uint32 i = 1; i < measured; i++)
+            printf("%s: %u streams %.2f MB/s total, %.1fx one stream\n", TestTypeToString(type),
+                   (unsigned int)streams[i], mbps[i], mbps[i] / mbps[0]);
+    }
+    return failed;
+}
+
+/* One job per working-set size, sharing a data file sized for the largest; returns the number of failed jobs */
+static uint32 RunCacheSweep(const char *target, uint32 passes, uint32 block_size, uint32 averaging, BOOL flush,
+                            const BenchOptions *opts, const char *csv_path)
+{
+    uint64 levels[CACHE_SWEEP_MAX_LEVELS];
+    uint32 count = GetCacheSweepLevels(target, opts->dataset_bytes, levels, CACHE_SWEEP_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    sweep.dataset_bytes = levels[count - 1];
+    sweep.reuse_fixtures = TRUE;
+
+    uint32 failed = 0;
+    for (uint32 i = 0; i < count; i++) {
+        sweep.working_set_bytes = levels[i];
+        fprintf(stderr, "diskbench: working set %llu KB\n", (unsigned long long)(levels[i] / 1024));
+        if (!RunJob(TEST_CACHE_SWEEP, target, passes, block_size, averaging, flush, &sweep, csv_path, NULL))
+            failed++;
+    }
+    return failed;
+}
+
+/* One job per directory size; returns the number of failed jobs */
+static uint32 RunDirScaling(const char *target, uint32 passes, uint32 averaging, BOOL flush, const BenchOptions *opts,
+                            const char *csv_path)
+{
+    uint32 levels[DIR_SCALING_MAX_LEVELS];
+    uint32 count = GetDirScalingLevels(target, levels, DIR_SCALING_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    uint32 failed = 0;
+    for (uint32 i = 0; i < count; i++) {
+        sweep.dir_entries = levels[i];
+        fprintf(stderr, "diskbench: %u directory entries\n", (unsigned int)levels[i]);
+        if (!RunJob(TEST_DIR_SCALING, target, passes, 0, averaging, flush, &sweep, csv_path, NULL))
+            failed++;
+    }
+    return failed;
+}
+
+/* One job per group-commit size; returns the number of failed jobs */
+static uint32 RunCommitSweep(const char *target, uint32 passes, uint32 block_size, uint32 averaging, BOOL flush,
+                             const BenchOptions *opts, const char *csv_path)
+{
+    uint32 levels[COMMIT_MAX_LEVELS];
+    uint32 count = GetCommitGroupLevels(levels, COMMIT_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    uint32 failed = 0;
+    for (uint32 i = 0; i < count; i++) {
+        sweep.commit_group = levels[i];
+        fprintf(stderr, "diskbench: %u records per commit\n", (unsigned int)levels[i]);
+        if (!RunJob(TEST_COMMIT_LOG, target, passes, block_size, averaging, flush, &sweep, csv_path, NULL))
+            failed++;
+    }
+    return failed;
+}
+
+/* One job per queue depth, then the saturation depth; returns the number of failed jobs */
+static uint32 RunQueueSweep(const char *target, uint32 passes, uint32 block_size, uint32 averaging, BOOL flush,
+                            const BenchOptions *opts, const char *csv_path)
+{
+    uint32 levels[QUEUE_DEPTH_MAX_LEVELS];
+    uint32 count = GetQueueDepthLevels(levels, QUEUE_DEPTH_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    uint32 depths[QUEUE_DEPTH_MAX_LEVELS];
+    float iops[QUEUE_DEPTH_MAX_LEVELS];
+    uint32 measured = 0;
+    uint32 failed = 0;
+    for (uint32 i = 0; i < count; i++) {
+        BenchResult result;
+        sweep.queue_depth = levels[i];
+        fprintf(stderr, "diskbench: %u requests in flight\n", (unsigned int)levels[i]);
+        if (!RunJob(TEST_RAW_QUEUE_DEPTH, target, passes, block_size, averaging, flush, &sweep, csv_path, &result)) {
+            failed++;
+            continue;
+        }
+        depths[measured] = levels[i];
+        iops[measured++] = (float)result.iops;
+    }
+    if (measured > 1)
+        printf("RawQueueDepth: saturates at %u requests in flight\n",
+               (unsigned int)GetQueueDepthSaturation(depths, iops, measured));
+    return failed;
+}
+
+/* One job per buffer size, each compared with plain Read/Write; returns the number of failed jobs */
+static uint32 RunBufferSweep(const char *target, uint32 passes, uint32 block_size, uint32 averaging, BOOL flush,
+                             const BenchOptions *opts, const char *csv_path)
+{
+    uint32 levels[IO_BUFFER_MAX_LEVELS];
+    uint32 count = GetIoBufferLevels(levels, IO_BUFFER_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    uint32 buffers[IO_BUFFER_MAX_LEVELS];
+    float mbps[IO_BUFFER_MAX_LEVELS];
+    uint32 measured = 0;
+    uint32 failed = 0;
+    for (uint32 i = 0; i < count; i++) {
+        BenchResult result;
+        sweep.io_buffer = levels[i];
+        if (levels[i] == IO_BUFFER_NONE)
+            fprintf(stderr, "diskbench: Read/Write, unbuffered\n");
+        else
+            fprintf(stderr, "diskbench: FRead/FWrite, %u-byte buffer\n", (unsigned int)levels[i]);
+        if (!RunJob(TEST_BUFFERED_IO, target, passes, block_size, averaging, flush, &sweep, csv_path, &result)) {
+            failed++;
+            continue;
+        }
+        buffers[measured] = levels[i];
+        mbps[measured++] = result.mb_per_sec;
+    }
+    if (measured > 1 && buffers[0] == IO_BUFFER_NONE && mbps[0] > 0.0f) {
+        for (uint32 i = 1; i < measured; i++)
+            printf("BufferedIO: %u-byte buffer %.1fx Read/Write\n", (unsigned int)buffers[i], mbps[i] / mbps[0]);
+    }
+    return failed;
+}
+
+/*
+ * One job per buffer offset and memory type, then each offset's rate against the 8 KB aligned buffer of the
+ * same memory; returns the number of failed jobs
+ */
+static uint32 RunAlignmentSweep(BenchTestType type, const char *target, uint32 passes, uint32 block_size,
+                                uint32 averaging, BOOL flush, const BenchOptions *opts, const char *csv_path)
+{
+    uint32 offsets[BUFFER_OFFSET_MAX_LEVELS];
+    uint32 count = GetBufferOffsetLevels(offsets, BUFFER_OFFSET_MAX_LEVELS);
+
+    BenchOptions sweep = *opts;
+    float mbps[BUFFER_MEM_COUNT][BUFFER_OFFSET_MAX_LEVELS];
+    uint32 failed = 0;
+    for (uint32 mem = BUFFER_MEM_SHARED; mem < BUFFER_MEM_COUNT; mem++) {
+        for (uint32 i = 0; i < count; i++) {
+            BenchResult result;
+            sweep.buffer_mem = mem;
+            sweep.buffer_offset = offsets[i];
+            fprintf(stderr, "diskbench: %s memory, buffer +%u\n", BufferMemName(mem), (unsigned int)offsets[i]);
+            mbps[mem][i] = 0.0f;
+            if (!RunJob(type, target, passes, block_size, averaging, flush, &sweep, csv_path, &result)) {
+                failed++;
+                continue;
+            }
+            mbps[mem][i] = result.mb_per_sec;
+        }
+    }
+    for (uint32 mem = BUFFER_MEM_SHARED; mem < BUFFER_MEM_COUNT; mem++) {
+        if (mbps[mem][0] <= 0.0f)
+            continue;
+        for (uint32 i = 1; i < count; i++) {
+            float pct = mbps[mem][i] / mbps[mem][0] * 100.0f;
+            printf("%s: %s +%u %.2f MB/s, %.0f%% of aligned%s\n", TestTypeToString(type), BufferMemName(mem),
+                   (unsigned int)offsets[i], mbps[mem][i], pct,
+                   (pct < 100.0f - BUFFER_FALLBACK_PCT) ? " - bounce buffering likely" : "");
+        }
+    }
+    return failed;
+}
+
+int main(int argc, char **argv)
+{
+    enum { OPT_RECORD = 256, OPT_OPEN_LOOP, OPT_SEED, OPT_CACHE_MODE, OPT_EVICT, OPT_WORKING_SET, OPT_VERIFY,
+           OPT_RANDOM_PCT, OPT_DIR_ENTRIES, OPT_COMMIT_GROUP,
+           OPT_ZONES, OPT_QUEUE_DEPTH, OPT_IO_BUFFER, OPT_BUFFER_MEM, OPT_BUFFER_OFFSET, OPT_BUFFER_SWEEP };
+    static const struct option long_opts[] = {{"passes", required_argument, NULL, 'p'},
+                                              {"block-size", required_argument, NULL, 'b'},
+                                              {"averaging", required_argument, NULL, 'a'},
+                                              {"flush", no_argument, NULL, 'f'},
+                                              {"csv", required_argument, NULL, 'o'},
+                                              {"duration", required_argument, NULL, 'd'},
+                                              {"dataset-mb", required_argument, NULL, 'm'},
+                                              {"streams", required_argument, NULL, 's'},
+                                              {"raw-image", required_argument, NULL, 'r'},
+                                              {"trace", required_argument, NULL, 't'},
+                                              {"record", no_argument, NULL, OPT_RECORD},
+                                              {"open-loop", no_argument, NULL, OPT_OPEN_LOOP},
+                                              {"seed", required_argument, NULL, OPT_SEED},
+                                              {"cache-mode", required_argument, NULL, OPT_CACHE_MODE},
+                                              {"evict", required_argument, NULL, OPT_EVICT},
+                                              {"working-set-kb", required_argument, NULL, OPT_WORKING_SET},
+                                              {"verify", no_argument, NULL, OPT_VERIFY},
+                                              {"random-pct", required_argument, NULL, OPT_RANDOM_PCT},
+                                              {"dir-entries", required_argument, NULL, OPT_DIR_ENTRIES},
+                                              {"commit-group", required_argument, NULL, OPT_COMMIT_GROUP},
+                                              {"zones", required_argument, NULL, OPT_ZONES},
+                                              {"queue-depth", required_argument, NULL, OPT_QUEUE_DEPTH},
+                                              {"io-buffer", required_argument, NULL, OPT_IO_BUFFER},
+                                              {"buffer-mem", required_argument, NULL, OPT_BUFFER_MEM},
+                                              {"buffer-offset", required_argument, NULL, OPT_BUFFER_OFFSET},
+                                              {"buffer-sweep", no_argument, NULL, OPT_BUFFER_SWEEP},
+                                              {"list", no_argument, NULL, 'l'},
+                                              {"help", no_argument, NULL, 'h'},
+                                              {NULL, 0, NULL, 0}};
+
+    BenchOptions opts;
+    memset(&opts, 0, sizeof(opts));
+    uint32 passes = 0, block_size = 0, averaging = AVERAGE_ALL_PASSES;
+    BOOL flush = FALSE, list = FALSE;
+    const char *csv_path = DISKBENCH_DEFAULT_CSV;
+
+    int c;
+    while ((c = getopt_long(argc, argv, "p:b:a:fo:d:m:s:r:t:lh", long_opts, NULL)) != -1) {
+        switch (c) {
+        case 'p':
+            passes = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case 'b':
+            block_size = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case 'a':
+            averaging = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case 'f':
+            flush = TRUE;
+            break;
+        case 'o':
+            csv_path = optarg;
+            break;
+        case 'd':
+            opts.duration_secs = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case 'm':
+            opts.dataset_bytes = (uint64)strtoull(optarg, NULL, 0) * 1024 * 1024;
+            break;
+        case 's':
+            opts.streams = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            snprintf(opts.raw_image_path, sizeof(opts.raw_image_path), "%s", optarg);
+            break;
+        case 't':
+            snprintf(opts.trace_path, sizeof(opts.trace_path), "%s", optarg);
+            break;
+        case OPT_RECORD:
+            opts.trace_record = TRUE;
+            break;
+        case OPT_OPEN_LOOP:
+            opts.trace_open_loop = TRUE;
+            break;
+        case OPT_SEED:
+            opts.access_seed = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_CACHE_MODE:
+            opts.cache_mode = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_EVICT:
+            opts.evict_strategy = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_WORKING_SET:
+            opts.working_set_bytes = (uint64)strtoul(optarg, NULL, 0) * 1024;
+            break;
+        case OPT_VERIFY:
+            opts.verify = TRUE;
+            break;
+        case OPT_RANDOM_PCT:
+            opts.data_random_pct = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_DIR_ENTRIES:
+            opts.dir_entries = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_COMMIT_GROUP:
+            opts.commit_group = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_ZONES:
+            opts.zone_count = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_QUEUE_DEPTH:
+            opts.queue_depth = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_IO_BUFFER:
+            opts.io_buffer = (strcasecmp(optarg, "none") == 0) ? IO_BUFFER_NONE : (uint32)strtoul(optarg, NULL, 0);
+            if (opts.io_buffer == 0)
+                opts.io_buffer = IO_BUFFER_MAX + 1; /* Rejected below, rather than running the sweep */
+            break;
+        case OPT_BUFFER_MEM:
+            opts.buffer_mem = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_BUFFER_OFFSET:
+            opts.buffer_offset = (uint32)strtoul(optarg, NULL, 0);
+            break;
+        case OPT_BUFFER_SWEEP:
+            opts.buffer_sweep = TRUE;
+            break;
+        case 'l':
+            list = TRUE;
+            break;
+        default:
+            PrintUsage(argv[0]);
+            return (c == 'h') ? 0 : 2;
+        }
+    }
+
+    if (!InitEngine()) {
+        fprintf(stderr, "diskbench: engine initialisation failed\n");
+        return 1;
+    }
+    if (list) {
+        ListTests();
+        CleanupEngine();
+        return 0;
+    }
+    if (argc - optind != 2) {
+        PrintUsage(argv[0]);
+        CleanupEngine();
+        return 2;
+    }
+
+    /* TEST may list several tests, run as one queue */
+    BenchTestType types[DISKBENCH_MAX_JOBS];
+    uint32 num_jobs = 0;
+    char names[256];
+    snprintf(names, sizeof(names), "%s", argv[optind]);
+    for (char *tok = strtok(names, ","); tok; tok = strtok(NULL, ",")) {
+        BenchTestType type = StringToTestType(tok);
+        if (!GetWorkloadByType(type)) {
+            fprintf(stderr, "diskbench: unknown test '%s' (see --list)\n", tok);
+            CleanupEngine();
+            return 2;
+        }
+        if (num_jobs == DISKBENCH_MAX_JOBS) {
+            fprintf(stderr, "diskbench: at most %d tests per run\n", DISKBENCH_MAX_JOBS);
+            CleanupEngine();
+            return 2;
+        }
+        types[num_jobs++] = type;
+    }
+    if (num_jobs == 0) {
+        PrintUsage(argv[0]);
+        CleanupEngine();
+        return 2;
+    }
+    if (averaging > AVERAGE_ADAPTIVE) {
+        fprintf(stderr, "diskbench: averaging method must be 0-3\n");
+        CleanupEngine();
+        return 2;
+    }
+    if (opts.cache_mode >= CACHE_MODE_COUNT || opts.evict_strategy >= EVICT_COUNT) {
+        fprintf(stderr, "diskbench: cache mode must be 0-2 and eviction 0-2\n");
+        CleanupEngine();
+        return 2;
+    }
+    if (opts.data_random_pct > 100) {
+        fprintf(stderr, "diskbench: random data share must be 0-100\n");
+        CleanupEngine();
+        return 2;
+    }
+    if (opts.zone_count == 1 || opts.zone_count > ZONE_MAP_MAX) {
+        fprintf(stderr, "diskbench: zones must be 2-%d\n", ZONE_MAP_MAX);
+        CleanupEngine();
+        return 2;
+    }
+    if (opts.queue_depth > QUEUE_DEPTH_MAX) {
+        fprintf(stderr, "diskbench: queue depth must be 1-%d\n", QUEUE_DEPTH_MAX);
+        CleanupEngine();
+        return 2;
+    }
+    if (opts.buffer_mem >= BUFFER_MEM_COUNT || opts.buffer_offset >= BUFFER_BASE_ALIGN ||
+        (opts.buffer_offset > 0 && opts.buffer_mem == BUFFER_MEM_DEFAULT)) {
+        fprintf(stderr, "diskbench: buffer memory must be 1-%d, with an offset below %d\n", BUFFER_MEM_COUNT - 1,
+                BUFFER_BASE_ALIGN);
+        CleanupEngine();
+        return 2;
+    }
+    if (opts.io_buffer > IO_BUFFER_MAX) {
+        fprintf(stderr, "diskbench: I/O buffer must be none or 2-%d bytes\n", IO_BUFFER_MAX);
+        CleanupEngine();
+        return 2;
+    }
+
+    struct stat st;
+    if (stat(argv[optind + 1], &st) != 0 || !S_ISDIR(st.st_mode)) {
+        fprintf(stderr, "diskbench: %s is not a directory\n", argv[optind + 1]);
+        CleanupEngine();
+        return 2;
+    }
+
+    /* Workloads append file names to the target, as to an AmigaOS "DH0:" or "DH0:dir/" */
+    char target[MAX_PATH_LEN];
+    const char *dir = argv[optind + 1];
+    size_t len = strlen(dir);
+    snprintf(target, sizeof(target), "%s%s", dir, (len > 0 && dir[len - 1] == '/') ? "" : "/");
+
+    /* As in the GUI queue, data files are kept from job to job and removed after the last */
+    opts.reuse_fixtures = (num_jobs > 1);
+
+    uint32 failed = 0;
+    for (uint32 j = 0; j < num_jobs; j++) {
+        if (opts.streams > 1) {
+            failed += RunStreamSweep(types[j], target, passes, block_size, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        if (types[j] == TEST_CACHE_SWEEP && opts.working_set_bytes == 0) {
+            failed += RunCacheSweep(target, passes, block_size, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        if (types[j] == TEST_DIR_SCALING && opts.dir_entries == 0) {
+            failed += RunDirScaling(target, passes, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        if (types[j] == TEST_COMMIT_LOG && opts.commit_group == 0) {
+            failed += RunCommitSweep(target, passes, block_size, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        if (types[j] == TEST_RAW_QUEUE_DEPTH && opts.queue_depth == 0) {
+            failed += RunQueueSweep(target, passes, block_size, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        const BenchWorkload *workload = GetWorkloadByType(types[j]);
+        if (opts.buffer_sweep && workload && (workload->flags & WORKLOAD_F_BUFFER_PLACEMENT)) {
+            failed += RunAlignmentSweep(types[j], target, passes, block_size, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        if (types[j] == TEST_BUFFERED_IO && opts.io_buffer == 0) {
+            failed += RunBufferSweep(target, passes, block_size, averaging, flush, &opts, csv_path);
+            continue;
+        }
+        if (!RunJob(types[j], target, passes, block_size, averaging, flush, &opts, csv_path, NULL))
+            failed++;
+    }
+    FixtureCacheFlush();
+
+    CleanupEngine();
+    return failed ? 1 : 0;
+}
@@ -3,51 +3,36 @@
  * Copyright (c) 2026 Team Derfs. All rights reserved.
  */
 
+#include "engine_access.h"
+#include "engine_buffer.h"
+#include "engine_cache.h"
+#include "engine_fixture.h"
 #include "engine_internal.h"
+#include "engine_streams.h"
+#include "engine_trace.h"
+#include "engine_verify.h"
 #include "engine_warmup.h"
 #include "engine_workloads.h"
 #include <float.h>
+#include <math.h>
 #include <stdlib.h>
 #include <time.h>
 
-/* Global library bases and interfaces */
-struct Device *BenchTimerBase = NULL;
-struct TimerIFace *IBenchTimer = NULL;
-struct MsgPort *BenchTimerPort = NULL;
-struct TimeRequest *BenchTimerReq = NULL;
-
 /*
  * Initializes the benchmark engine.
- * Sets up timer.device and the workload registry.
+ * Sets up the platform layer (timer) and the workload registry.
  */
 BOOL InitEngine(void)
 {
-    BenchTimerPort = IExec->AllocSysObjectTags(ASOT_PORT, TAG_DONE);
-    if (BenchTimerPort) {
-        BenchTimerReq = (struct TimeRequest *)IExec->AllocSysObjectTags(
-            ASOT_IOREQUEST, ASOIOR_Size, sizeof(struct TimeRequest), ASOIOR_ReplyPort, BenchTimerPort, TAG_DONE);
-        if (BenchTimerReq) {
-            if (IExec->OpenDevice("timer.device", UNIT_MICROHZ, (struct IORequest *)BenchTimerReq, 0) == 0) {
-                BenchTimerBase = (struct Device *)BenchTimerReq->Request.io_Device;
-                IBenchTimer =
-                    (struct TimerIFace *)IExec->GetInterface((struct Library *)BenchTimerBase, "main", 1, NULL);
-                if (IBenchTimer) {
-                    InitWorkloadRegistry();
-                    LOG_DEBUG("Engine initialized successfully");
-                    return TRUE;
-                }
-                LOG_DEBUG("FAILED to get Timer interface");
-            } else {
-                LOG_DEBUG("FAILED to open timer.device");
-            }
-        } else {
-            LOG_DEBUG("FAILED to allocate TimeRequest");
-        }
-    } else {
-        LOG_DEBUG("FAILED to allocate TimerPort");
+    if (!PlatInit()) {
+        LOG_DEBUG("FAILED to initialize platform layer");
+        return FALSE;
     }
-    CleanupEngine();
-    return FALSE;
+    TimingInit();
+    VerifyTablesInit();
+    InitWorkloadRegistry();
+    LOG_DEBUG("Engine initialized successfully");
+    return TRUE;
 }
 
 /*
@@ -57,39 +42,9 @@ BOOL InitEngine(void)
 void CleanupEngine(void)
 {
     LOG_DEBUG("Cleaning up engine...");
+    FixtureCacheFlush();
     CleanupWorkloadRegistry();
-    if (IBenchTimer) {
-        IExec->DropInterface((struct Interface *)IBenchTimer);
-        IBenchTimer = NULL;
-    }
-    if (BenchTimerBase) {
-        IExec->CloseDevice((struct IORequest *)BenchTimerReq);
-        BenchTimerBase = NULL;
-    }
-    if (BenchTimerReq) {
-        IExec->FreeSysObject(ASOT_IOREQUEST, BenchTimerReq);
-        BenchTimerReq = NULL;
-    }
-    if (BenchTimerPort) {
-        IExec->FreeSysObject(ASOT_PORT, BenchTimerPort);
-        BenchTimerPort = NULL;
-    }
-}
-
-void GetMicroTime(struct TimeVal *tv)
-{
-    if (IBenchTimer) {
-        IBenchTimer->GetSysTime(tv);
-    }
-}
-
-float GetDuration(struct TimeVal *start, struct TimeVal *end)
-{
-    if (!IBenchTimer)
-        return 0.0f;
-    struct TimeVal delta = *end;
-    IBenchTimer->SubTime(&delta, start);
-    return (float)delta.Seconds + (float)delta.Microseconds / 1000000.0f;
+    PlatCleanup();
 }
 
 /**
@@ -106,32 +61,116 @@ static int CompareFloats(const void *a, const void *b)
     return 0;
 }
 
+/*
+ * Two-sided 95% critical value of Student's t distribution for the given degrees of freedom.
+ */
+static float StudentT95(uint32 dof)
+{
+    static const float t_table[30] = {12.706f, 4.303f, 3.182f, 2.776f, 2.571f, 2.447f, 2.365f, 2.306f,
+                                      2.262f,  2.228f, 2.201f, 2.179f, 2.160f, 2.145f, 2.131f, 2.120f,
+                                      2.110f,  2.101f, 2.093f, 2.086f, 2.080f, 2.074f, 2.069f, 2.064f,
+                                      2.060f,  2.056f, 2.052f, 2.048f, 2.045f, 2.042f};
+    if (dof == 0)
+        return 0.0f;
+    if (dof <= 30)
+        return t_table[dof - 1];
+    if (dof <= 60)
+        return 2.021f;
+    if (dof <= 120)
+        return 2.000f;
+    return 1.980f;
+}
 
 /*
- * Records a single time/value data point into the sample buffer.
+ * Computes the 95% CI half-width of the mean and the coefficient of variation
+ * of the per-pass results, both as a percentage of the mean.
  */
-static void AddSample(BenchSampleData *sd, float time, float value)
+static void GetPassConfidence(const float *results, uint32 count, float *ci_pct, float *cv_pct)
+{
+    *ci_pct = 0.0f;
+    *cv_pct = 0.0f;
+    if (count < 2)
+        return;
+
+    double sum = 0.0;
+    for (uint32 i = 0; i < count; i++)
+        sum += results[i];
+    double mean = sum / count;
+    if (mean <= 0.0)
+        return;
+
+    double var = 0.0;
+    for (uint32 i = 0; i < count; i++)
+        var += (results[i] - mean) * (results[i] - mean);
+    double stddev = sqrt(var / (count - 1)); /* Sample standard deviation */
+
+    *cv_pct = (float)(100.0 * stddev / mean);
+    *ci_pct = (float)(100.0 * StudentT95(count - 1) * stddev / sqrt((double)count) / mean);
+}
+
+/* Paired mode: rerun the pass just measured cold, now with its data cached; returns MB/s (0 on failure) */
+static float RunWarmPass(const BenchWorkload *workload, void *data, StreamGroup *group, BenchSampler *sampler)
 {
-    if (sd && sd->sample_count < MAX_SAMPLES) {
-        sd->samples[sd->sample_count].time_offset = time;
-        sd->samples[sd->sample_count].value = value;
-        sd->sample_count++;
+    uint64 bytes = 0;
+    uint32 ops = 0;
+
+    /* The graph and the trace show the cold passes only */
+    BenchSampleData *out = sampler->out;
+    sampler->out = NULL;
+    if (workload->PreparePass && !group)
+        workload->PreparePass(data);
+    SamplerBeginPass(sampler, 0.0f);
+    BenchTicks start = TimerNow();
+    BOOL success = group ? StreamsRunPass(group, &bytes, &ops) : workload->Run(data, &bytes, &ops);
+    BenchTicks end = TimerNow();
+    SamplerEndPass(sampler);
+    sampler->out = out;
+
+    double duration = TimerSeconds(start, end);
+    if (workload->GetVerify && !group)
+        duration -= VerifySeconds(workload->GetVerify(data));
+    if (group) {
+        duration = group->pass_secs;
+    } else if (SamplerTimed(sampler)) {
+        duration = sampler->measure_secs;
+        bytes = sampler->measure_bytes;
     }
+    if (!success || duration <= 0)
+        return 0.0f;
+    return (float)(((double)bytes / (1024.0 * 1024.0)) / duration);
 }
 
 BOOL RunBenchmark(BenchTestType type, const char *target_path, uint32 passes, uint32 block_size, uint32 averaging_method,
-                  BOOL flush_cache, ProgressCallback progress_cb, BenchResult *out_result, BenchSampleData *out_samples)
+                  BOOL flush_cache, const BenchOptions *options, ProgressCallback progress_cb, BenchResult *out_result,
+                  BenchSampleData *out_samples)
 {
+    BenchOptions opts;
+    if (options)
+        opts = *options;
+    else
+        memset(&opts, 0, sizeof(opts));
+
     if (passes == 0)
         passes = 1;
     if (passes > MAX_PASSES)
         passes = MAX_PASSES;
 
-    LOG_DEBUG("RunBenchmark: Type=%d, Passes=%u, BS=%u, AvgMethod=%u, Flush=%d", type, (unsigned int)passes,
-              (unsigned int)block_size, (unsigned int)averaging_method, (int)flush_cache);
+    /* Adaptive mode: the pass count is decided by the CI stopping rule, bounded by a time budget */
+    BOOL adaptive = (averaging_method == AVERAGE_ADAPTIVE);
+    float ci_target = (opts.adaptive_ci_pct > 0.0f) ? opts.adaptive_ci_pct : ADAPTIVE_DEFAULT_CI_PCT;
+    float budget_secs =
+        (float)((opts.adaptive_budget_secs > 0) ? opts.adaptive_budget_secs : ADAPTIVE_DEFAULT_BUDGET_SECS);
+    if (adaptive) {
+        passes = ADAPTIVE_MAX_PASSES;
+        LOG_DEBUG("RunBenchmark: Adaptive passes, target CI %.1f%%, budget %.0f s", ci_target, budget_secs);
+    }
+
+    LOG_DEBUG("RunBenchmark: Type=%d, Passes=%u, BS=%u, AvgMethod=%u, Flush=%d, PassSecs=%u", type,
+              (unsigned int)passes, (unsigned int)block_size, (unsigned int)averaging_method, (int)flush_cache,
+              (unsigned int)opts.duration_secs);
 
     /* Force Block Size to 0 (Mixed) for fixed-behavior tests */
-    if (type == TEST_DAILY_GRIND || type == TEST_PROFILER) {
+    if (type == TEST_DAILY_GRIND || type == TEST_PROFILER || type == TEST_DIR_SCALING) {
         block_size = 0;
     }
 
@@ -142,13 +181,52 @@ BOOL RunBenchmark(BenchTestType type, const char *target_path, uint32 passes, ui
     /* Perform Warmup */
     RunWarmup(target_path);
 
-    float *results = IExec->AllocVecTags(sizeof(float) * passes, AVT_Type, MEMF_SHARED, TAG_DONE);
+    /* MB/s per pass, then the scored metric per pass (IOPS for ops-scored workloads) for the confidence interval */
+    float *results = PlatAlloc(sizeof(float) * passes * 2);
     if (!results)
         return FALSE;
+    float *scores = results + passes;
+
+    /* Merged across passes by the workloads that track them; every exit goes through cleanup to free them */
+    BOOL ok = FALSE;
+    LatencyHistogram *latency = NULL;
+    MetaOpStats *meta_ops = NULL;
+    SeekStats *seeks = NULL;
+    StrideStats *strides = NULL;
 
     memset(out_result, 0, sizeof(BenchResult));
     out_result->type = type;
     out_result->passes = passes;
+    out_result->dataset_bytes = opts.dataset_bytes;
+    if (type == TEST_CACHE_SWEEP) {
+        if (opts.working_set_bytes == 0)
+            opts.working_set_bytes = CACHE_SWEEP_DEFAULT_BYTES;
+        out_result->working_set_bytes = opts.working_set_bytes;
+    }
+    if (type == TEST_DIR_SCALING) {
+        if (opts.dir_entries == 0)
+            opts.dir_entries = DIR_SCALING_DEFAULT_ENTRIES;
+        out_result->dir_entries = opts.dir_entries;
+    }
+    if (type == TEST_COMMIT_LOG) {
+        if (opts.commit_group == 0)
+            opts.commit_group = 1;
+        out_result->commit_group = opts.commit_group;
+    }
+    if (type == TEST_RAW_QUEUE_DEPTH) {
+        if (opts.queue_depth == 0)
+            opts.queue_depth = 1;
+        if (opts.queue_depth > QUEUE_DEPTH_MAX)
+            opts.queue_depth = QUEUE_DEPTH_MAX;
+        out_result->queue_depth = opts.queue_depth;
+    }
+    if (type == TEST_BUFFERED_IO) {
+        if (opts.io_buffer == 0)
+            opts.io_buffer = IO_BUFFER_NONE;
+        if (opts.io_buffer > IO_BUFFER_MAX)
+            opts.io_buffer = IO_BUFFER_MAX;
+        out_result->io_buffer = opts.io_buffer;
+    }
     out_result->block_size = block_size;
 
     GetFileSystemInfo(target_path, out_result->fs_type, sizeof(out_result->fs_type));
@@ -177,54 +255,242 @@ BOOL RunBenchmark(BenchTestType type, const char *target_path, uint32 passes, ui
              timeinfo->tm_sec, (unsigned short)(rand() & 0xFFFF));
 
     uint32 valid_passes = 0;
-    uint32 sum_iops = 0;
-    float total_duration = 0;
+    uint64 sum_iops = 0;
+    double total_duration = 0.0;
     uint64 total_bytes = 0;
 
     const BenchWorkload *workload = GetWorkloadByType(type);
     if (!workload) {
         LOG_DEBUG("FAILED to find workload for type %d", type);
         LogUser("ERROR: Unknown test type %d - no workload registered", type);
-        IExec->FreeVec(results);
-        return FALSE;
+        goto cleanup;
     }
 
+    /* Buffer placement applies to workloads whose transfers go through XferBuffers */
+    if (opts.buffer_mem != BUFFER_MEM_DEFAULT) {
+        if (opts.buffer_mem >= BUFFER_MEM_COUNT || !(workload->flags & WORKLOAD_F_BUFFER_PLACEMENT)) {
+            LogUser("Buffers: %s allocates its own buffers - running with the default placement", workload->name);
+            opts.buffer_mem = BUFFER_MEM_DEFAULT;
+            opts.buffer_offset = 0;
+        }
+        opts.buffer_offset %= BUFFER_BASE_ALIGN;
+        out_result->buffer_mem = opts.buffer_mem;
+        out_result->buffer_offset = opts.buffer_offset;
+    }
+
+    /* Latency histogram merged across all passes (only for workloads that track it) */
+    if (workload->GetLatency) {
+        latency = PlatAlloc(sizeof(LatencyHistogram));
+        if (!latency)
+            goto cleanup;
+        LatencyReset(latency);
+    }
+
+    /* Per-class metadata counters merged across all passes (histograms make this a few KB, so not on the stack) */
+    if (workload->GetMetaOps) {
+        meta_ops = PlatAlloc(sizeof(MetaOpStats));
+        if (!meta_ops)
+            goto cleanup;
+        MetaOpsReset(meta_ops);
+    }
+
+    /* Per-distance seek latencies merged across all passes (one histogram per distance, ~40 KB) */
+    if (workload->GetSeeks) {
+        seeks = PlatAllocClear(sizeof(SeekStats));
+        if (!seeks)
+            goto cleanup;
+    }
+
+    /* Per-gap strided-read latencies merged across all passes (two histograms per gap, ~33 KB) */
+    if (workload->GetStrides) {
+        strides = PlatAllocClear(sizeof(StrideStats));
+        if (!strides)
+            goto cleanup;
+    }
+
+    /* Throughput samples: intra-pass for workloads that report progress, one per pass otherwise */
+    BenchSampler sampler;
+    BOOL ops_metric = (type == TEST_PROFILER || type == TEST_DIR_SCALING); /* Scored in IOPS */
+    SamplerInit(&sampler, out_samples, ops_metric);
+
+    /* Concurrent streams: N workload instances in child processes, otherwise one instance here */
+    uint32 streams = (opts.streams > STREAMS_MAX) ? STREAMS_MAX : opts.streams;
+    StreamGroup *group = NULL;
     void *workload_data = NULL;
-    if (!workload->Setup(target_path, block_size, &workload_data)) {
+    out_result->streams = streams; /* 1 marks the single-stream point of a scaling curve */
+    if (streams > 1) {
+        opts.reuse_fixtures = FALSE; /* Stream directories are removed after the job */
+        group = StreamsStart(workload, target_path, block_size, &opts, streams);
+        if (!group) {
+            LogUser("ERROR: %s could not start %u concurrent streams on '%s'", workload->name, (unsigned int)streams,
+                    target_path);
+            goto cleanup;
+        }
+    } else if (!workload->Setup(target_path, block_size, &opts, &workload_data)) {
         LOG_DEBUG("FAILED to setup workload '%s' on '%s'", workload->name, target_path);
         LogUser("ERROR: %s setup failed on '%s' - could not create test file, open device, or allocate %u-byte buffer",
                 workload->name, target_path, (unsigned int)block_size);
-        IExec->FreeVec(results);
-        return FALSE;
+        goto cleanup;
     }
+    if (group) {
+        /* Each stream keeps its own deadline; the graph gets one aggregate point per pass */
+        out_result->pass_duration_secs = opts.duration_secs;
+    } else if (workload->SetSampler) {
+        workload->SetSampler(workload_data, &sampler);
+        if (opts.duration_secs > 0) {
+            SamplerSetDuration(&sampler, opts.duration_secs);
+            out_result->pass_duration_secs = opts.duration_secs;
+        }
+    } else if (opts.duration_secs > 0) {
+        LOG_DEBUG("Workload '%s' has no sampler hook - running fixed-work passes", workload->name);
+    }
+
+    /* Cold-cache modes: evict before every measured pass */
+    CacheEvictor evictor;
+    uint32 cache_mode = (opts.cache_mode < CACHE_MODE_COUNT) ? opts.cache_mode : CACHE_MODE_NORMAL;
+    if (cache_mode != CACHE_MODE_NORMAL) {
+        if (!EvictorInit(&evictor, target_path, opts.evict_strategy, workload, streams, &opts)) {
+            LogUser("Cache: eviction unavailable on '%s' - running with a warm cache", target_path);
+            EvictorFree(&evictor);
+            cache_mode = CACHE_MODE_NORMAL;
+        }
+    }
+    float warm_sum = 0.0f;
+    uint32 warm_count = 0;
+    BOOL evict_failed = FALSE; /* The workload's files were lost to an Inhibit: the job stops */
+
+    if (workload->flags & WORKLOAD_F_ACCESS_PATTERN)
+        FormatAccessPattern(&opts, block_size, out_result->access_pattern, sizeof(out_result->access_pattern));
+    else if (type == TEST_TRACE_REPLAY)
+        snprintf(out_result->access_pattern, sizeof(out_result->access_pattern), "%s",
+                 opts.trace_open_loop ? "TraceOpenLoop" : "TraceClosedLoop");
+    if (workload->flags & WORKLOAD_F_DATA_PATTERN)
+        FormatDataPattern(&opts, out_result->data_pattern, sizeof(out_result->data_pattern));
+
+    /* Record mode: the first pass of a traceable workload is captured to trace_path */
+    TraceRecorder recorder;
+    BOOL recording = FALSE;
+    if (opts.trace_record && opts.trace_path[0]) {
+        if (group)
+            LogUser("Trace: recording is not available with concurrent streams");
+        else if (!(workload->flags & WORKLOAD_F_TRACEABLE))
+            LogUser("Trace: %s cannot be recorded (not a single-file workload)", workload->name);
+        else if (!TraceRecorderInit(&recorder, TRACE_RECORD_CAPACITY))
+            LogUser("Trace: not enough memory to record %s", workload->name);
+        else
+            recording = TRUE;
+    }
+    double total_rampup = 0.0;
+    double wall_time = 0.0; /* Sample timeline, including ramp-up */
+    VerifyState verify;
+    memset(&verify, 0, sizeof(verify));
+    ZoneStats zones;
+    memset(&zones, 0, sizeof(zones));
+    if (opts.verify && !workload->GetVerify)
+        LogUser("Verify: %s does not check its data - running without verification", workload->name);
+    uint32 passes_run = 0;
+    float slow_stream = 0.0f;
+    float ci_pct = 0.0f, cv_pct = 0.0f; /* Last computed; a failed pass must not reset them and stop the run */
+    BenchTicks run_start = TimerNow(); /* Adaptive budget: real time, including eviction and warm passes */
 
     for (uint32 i = 0; i < passes; i++) {
-        uint32 pass_bytes = 0, pass_ops = 0;
-        struct TimeVal start_tv, end_tv;
+        uint64 pass_bytes = 0;
+        uint32 pass_ops = 0;
 
-        GetMicroTime(&start_tv);
-        BOOL success = workload->Run(workload_data, &pass_bytes, &pass_ops);
-        GetMicroTime(&end_tv);
+        if (cache_mode != CACHE_MODE_NORMAL && !EvictorRun(&evictor, workload, workload_data)) {
+            evict_failed = TRUE;
+            break;
+        }
+        if (workload->PreparePass && !group)
+            workload->PreparePass(workload_data);
+
+        sampler.recorder = (recording && i == 0) ? &recorder : NULL;
+        SamplerBeginPass(&sampler, (float)wall_time);
+        BenchTicks start = TimerNow();
+        BOOL success = group ? StreamsRunPass(group, &pass_bytes, &pass_ops)
+                             : workload->Run(workload_data, &pass_bytes, &pass_ops);
+        BenchTicks end = TimerNow();
+        SamplerEndPass(&sampler);
+        sampler.recorder = NULL;
+
+        double duration = TimerSeconds(start, end);
+        wall_time += duration;
+        passes_run++;
+
+        /* Verify mode: stamping and checking are reported on their own, not as I/O time */
+        if (workload->GetVerify) {
+            VerifyState pass_verify;
+            memset(&pass_verify, 0, sizeof(pass_verify));
+            if (group)
+                StreamsMergeVerify(group, &pass_verify);
+            else
+                VerifyMerge(&pass_verify, workload->GetVerify(workload_data));
+            VerifyMerge(&verify, &pass_verify);
+            duration -= VerifySeconds(&pass_verify);
+        }
 
         if (success) {
-            float duration = GetDuration(&start_tv, &end_tv);
+            /* Time-bounded passes are scored on the steady-state window only */
+            if (group) {
+                duration = group->pass_secs;
+                total_rampup += group->rampup_secs;
+                if (slow_stream == 0.0f || group->slowest_mbps < slow_stream)
+                    slow_stream = group->slowest_mbps;
+            } else if (SamplerTimed(&sampler)) {
+                duration = sampler.measure_secs;
+                pass_bytes = sampler.measure_bytes;
+                pass_ops = sampler.measure_ops;
+                total_rampup += sampler.rampup_secs;
+            }
+
             if (duration > 0) {
-                results[valid_passes] = ((float)pass_bytes / (1024.0f * 1024.0f)) / duration;
+                results[valid_passes] = (float)(((double)pass_bytes / (1024.0 * 1024.0)) / duration);
+                scores[valid_passes] = ops_metric ? (float)((double)pass_ops / duration) : results[valid_passes];
                 LOG_DEBUG("[Debug] Pass %u: %.2f MB/s", (unsigned int)valid_passes + 1, results[valid_passes]);
                 sum_iops += pass_ops;
                 valid_passes++;
                 total_duration += duration;
                 total_bytes += pass_bytes;
-
-                /* Add a sample point for this pass */
-                float val = (out_result->type == TEST_PROFILER) ? (float)pass_ops / duration
-                                                                : ((float)pass_bytes / (1024.0f * 1024.0f)) / duration;
-                AddSample(out_samples, total_duration, val);
+                if (latency && group)
+                    StreamsMergeLatency(group, latency);
+                else if (latency)
+                    LatencyMerge(latency, workload->GetLatency(workload_data));
+                if (meta_ops && group)
+                    StreamsMergeMetaOps(group, meta_ops);
+                else if (meta_ops)
+                    MetaOpsMerge(meta_ops, workload->GetMetaOps(workload_data));
+                if (workload->GetZones && group)
+                    StreamsMergeZones(group, &zones);
+                else if (workload->GetZones)
+                    ZoneStatsMerge(&zones, workload->GetZones(workload_data));
+                if (seeks && group)
+                    StreamsMergeSeeks(group, seeks);
+                else if (seeks)
+                    SeekStatsMerge(seeks, workload->GetSeeks(workload_data));
+                if (strides && group)
+                    StreamsMergeStrides(group, strides);
+                else if (strides)
+                    StrideStatsMerge(strides, workload->GetStrides(workload_data));
+
+                /* Workloads without intra-pass sampling get one point per pass */
+                float val = (float)(ops_metric ? (double)pass_ops / duration
+                                               : ((double)pass_bytes / (1024.0 * 1024.0)) / duration);
+                if (!workload->SetSampler || group)
+                    SamplerAddPoint(&sampler, (float)total_duration, val);
+
+                if (adaptive)
+                    GetPassConfidence(scores, valid_passes, &ci_pct, &cv_pct);
 
                 /* Report progress if callback provided */
                 if (progress_cb) {
                     char progress_text[128];
-                    if (out_result->type == TEST_PROFILER) {
+                    if (adaptive && valid_passes >= 2) {
+                        snprintf(progress_text, sizeof(progress_text), "Pass %u - %.1f %s (CI +/-%.1f%%)",
+                                 (unsigned int)(i + 1), val, ops_metric ? "IOPS" : "MB/s", ci_pct);
+                    } else if (adaptive) {
+                        snprintf(progress_text, sizeof(progress_text), "Pass %u - %.1f %s", (unsigned int)(i + 1),
+                                 val, ops_metric ? "IOPS" : "MB/s");
+                    } else if (ops_metric) {
                         snprintf(progress_text, sizeof(progress_text), "Pass %u/%u - %.0f IOPS", (unsigned int)(i + 1),
                                  (unsigned int)passes, val);
                     } else {
@@ -233,25 +499,113 @@ BOOL RunBenchmark(BenchTestType type, const char *target_path, uint32 passes, ui
                     }
                     progress_cb(progress_text, FALSE);
                 }
+
+                if (cache_mode == CACHE_MODE_PAIRED) {
+                    float warm = RunWarmPass(workload, workload_data, group, &sampler);
+                    if (warm > 0.0f) {
+                        warm_sum += warm;
+                        warm_count++;
+                    }
+                    if (progress_cb) {
+                        char progress_text[128];
+                        snprintf(progress_text, sizeof(progress_text), "Pass %u warm - %.1f MB/s",
+                                 (unsigned int)(i + 1), warm);
+                        progress_cb(progress_text, FALSE);
+                    }
+                }
             }
         }
+
+        if (adaptive) {
+            if (valid_passes >= ADAPTIVE_MIN_PASSES && ci_pct <= ci_target) {
+                LOG_DEBUG("[Adaptive] CI +/-%.2f%% within target after %u passes", ci_pct, (unsigned int)valid_passes);
+                break;
+            }
+            if (TimerSeconds(run_start, TimerNow()) >= budget_secs) {
+                LogUser("Adaptive: time budget of %.0f s used after %u passes (CI +/-%.1f%%, target %.1f%%)",
+                        budget_secs, (unsigned int)valid_passes, ci_pct, ci_target);
+                break;
+            }
+        }
+    }
+    if (adaptive)
+        out_result->passes = passes_run;
+
+    if (group)
+        StreamsStop(group);
+    else
+        workload->Cleanup(workload_data);
+    if (cache_mode != CACHE_MODE_NORMAL) {
+        /* The strategy actually used, after any fallback during the passes */
+        snprintf(out_result->cache_mode, sizeof(out_result->cache_mode), "%s/%s", CacheModeName(cache_mode),
+                 EvictStrategyName(evictor.strategy));
+        EvictorFree(&evictor);
     }
 
-    workload->Cleanup(workload_data);
+    if (recording) {
+        if (TraceSave(&recorder.data, opts.trace_path)) {
+            LogUser("Trace: recorded %u I/Os of %s to %s", (unsigned int)recorder.data.count, workload->name,
+                    opts.trace_path);
+            if (recorder.dropped > 0)
+                LogUser("Trace: capacity reached, %u further I/Os not recorded", (unsigned int)recorder.dropped);
+        } else {
+            LogUser("Trace: could not write %s", opts.trace_path);
+        }
+        TraceRecorderFree(&recorder);
+    }
 
-    if (valid_passes == 0) {
-        LogUser("ERROR: %s - all %u passes produced zero bytes on '%s' (block %u)",
-                workload->name, (unsigned int)passes, target_path, (unsigned int)block_size);
-        IExec->FreeVec(results);
-        return FALSE;
+    if (evict_failed || valid_passes == 0) {
+        if (evict_failed)
+            LogUser("ERROR: %s stopped after %u passes - its files on '%s' could not be reopened after eviction",
+                    workload->name, (unsigned int)passes_run, target_path);
+        else
+            LogUser("ERROR: %s - all %u passes produced zero bytes on '%s' (block %u)", workload->name,
+                    (unsigned int)passes_run, target_path, (unsigned int)block_size);
+        goto cleanup;
+    }
+
+    /* Tail latency across all operations of all valid passes */
+    if (latency && latency->count > 0) {
+        out_result->lat_p50_us = LatencyPercentile(latency, 50.0f);
+        out_result->lat_p90_us = LatencyPercentile(latency, 90.0f);
+        out_result->lat_p99_us = LatencyPercentile(latency, 99.0f);
+        out_result->lat_p999_us = LatencyPercentile(latency, 99.9f);
+        out_result->lat_max_us = (float)latency->max_us;
+        LOG_DEBUG("[Latency] n=%llu, p50=%.0f p99=%.0f max=%.0f us", (unsigned long long)latency->count,
+                  out_result->lat_p50_us, out_result->lat_p99_us, out_result->lat_max_us);
+    }
+
+    if (opts.verify && workload->GetVerify) {
+        out_result->verify_bytes = verify.bytes_checked;
+        out_result->verify_errors = verify.bad_sectors;
+        out_result->verify_secs = VerifySeconds(&verify);
+        if (verify.bad_sectors > 0)
+            LogUser("VERIFY FAILED: %s read back %u corrupt 512-byte sectors, the first at file offset %llu",
+                    workload->name, (unsigned int)verify.bad_sectors, (unsigned long long)verify.first_bad_offset);
+        LOG_DEBUG("[Verify] %llu bytes checked, %u bad sectors, %.3f s", (unsigned long long)verify.bytes_checked,
+                  (unsigned int)verify.bad_sectors, out_result->verify_secs);
     }
 
+    if (meta_ops)
+        MetaOpsToResult(meta_ops, out_result->meta_ops);
+    if (workload->GetZones)
+        ZoneStatsToResult(&zones, out_result);
+    if (seeks)
+        SeekStatsToResult(seeks, out_result);
+    if (strides)
+        StrideStatsToResult(strides, out_result);
+
     /* Track total work */
     out_result->total_duration = total_duration;
+    if (out_result->pass_duration_secs > 0)
+        out_result->rampup_secs = (float)(total_rampup / valid_passes);
     out_result->cumulative_bytes = total_bytes;
     out_result->averaging_method = averaging_method;
+    GetPassConfidence(scores, valid_passes, &out_result->ci95_pct, &out_result->cv_pct);
 
     switch (averaging_method) {
+    case AVERAGE_ADAPTIVE:
+        /* Adaptive runs stop on the CI of the plain mean, so report that mean */
     case AVERAGE_ALL_PASSES:
         /* Simple average of all passes */
         out_result->min_mbps = results[0];
@@ -364,9 +718,34 @@ BOOL RunBenchmark(BenchTestType type, const char *target_path, uint32 passes, ui
     }
 
 
-    out_result->iops = (total_duration > 0.0f) ? (uint32)((float)sum_iops / total_duration) : 0;
-    IExec->FreeVec(results);
+    out_result->iops = (total_duration > 0.0) ? (uint32)((double)sum_iops / total_duration) : 0;
+    if (out_result->streams > 0) {
+        out_result->stream_mbps = out_result->mb_per_sec / (float)out_result->streams;
+        out_result->stream_iops = out_result->iops / out_result->streams;
+        out_result->slow_stream_mbps = (streams > 1) ? slow_stream : out_result->min_mbps;
+        LOG_DEBUG("[Streams] %u streams: %.2f MB/s total, %.2f per stream, slowest %.2f",
+                  (unsigned int)out_result->streams, out_result->mb_per_sec, out_result->stream_mbps, slow_stream);
+    }
+    if (warm_count > 0) {
+        out_result->warm_mbps = warm_sum / (float)warm_count;
+        if (out_result->mb_per_sec > 0.0f)
+            out_result->cache_speedup = out_result->warm_mbps / out_result->mb_per_sec;
+        LOG_DEBUG("[Cache] cold %.2f MB/s, warm %.2f MB/s, speed-up %.2fx", out_result->mb_per_sec,
+                  out_result->warm_mbps, out_result->cache_speedup);
+    }
 
     LOG_DEBUG("Multi-pass benchmark (n=%u) completed. MB/s: %.2f", (unsigned int)valid_passes, out_result->mb_per_sec);
-    return TRUE;
+    ok = TRUE;
+
+cleanup:
+    if (latency)
+        PlatFree(latency);
+    if (meta_ops)
+        PlatFree(meta_ops);
+    if (seeks)
+        PlatFree(seeks);
+    if (strides)
+        PlatFree(strides);
+    PlatFree(results);
+    return ok;
 }
@@ -0,0 +1,226 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Access-pattern (offset) generator for random-I/O workloads.
+ */
+
+#include "engine_access.h"
+#include "engine_internal.h"
+#include <math.h>
+
+#define ZIPF_EXACT_TERMS 10000 /* Terms summed exactly before switching to the integral tail */
+
+/* SplitMix64 finaliser: spreads seeds and scatters Zipf ranks across the file */
+static uint64 Mix64(uint64 x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+void FastRandSeed(FastRand *r, uint64 seed)
+{
+    r->state = Mix64(seed);
+    if (r->state == 0)
+        r->state = 0x2545F4914F6CDD1DULL; /* xorshift must never hold zero */
+}
+
+uint64 FastRandNext(FastRand *r)
+{
+    uint64 x = r->state;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    r->state = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+uint64 FastRandRange(FastRand *r, uint64 range)
+{
+    return (range > 0) ? FastRandNext(r) % range : 0;
+}
+
+/* Uniform double in [0, 1) */
+static double FastRandUnit(FastRand *r)
+{
+    return (double)(FastRandNext(r) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/*
+ * Generalised harmonic number H(n, theta) = sum 1/i^theta for i = 1..n.
+ * Large n would take seconds to sum on a PPC, so terms beyond
+ * ZIPF_EXACT_TERMS use the Euler-Maclaurin integral approximation.
+ */
+static double Zeta(uint64 n, double theta)
+{
+    uint64 exact = (n < ZIPF_EXACT_TERMS) ? n : ZIPF_EXACT_TERMS;
+    double sum = 0.0;
+    for (uint64 i = 1; i <= exact; i++)
+        sum += pow((double)i, -theta);
+
+    if (n > exact) {
+        double a = (double)exact, b = (double)n;
+        sum += (pow(b, 1.0 - theta) - pow(a, 1.0 - theta)) / (1.0 - theta);
+        sum += (pow(b, -theta) - pow(a, -theta)) * 0.5;
+    }
+    return sum;
+}
+
+/* Zipfian rank in [0, zipf_items), rank 0 being the most popular */
+static uint64 NextZipfRank(OffsetGenerator *g)
+{
+    double u = FastRandUnit(&g->rng);
+    double uz = u * g->zipf_zetan;
+
+    if (uz < 1.0)
+        return 0;
+    if (uz < 1.0 + pow(0.5, g->zipf_theta))
+        return 1;
+
+    uint64 rank = (uint64)((double)g->zipf_items * pow(g->zipf_eta * u - g->zipf_eta + 1.0, g->zipf_alpha));
+    return (rank < g->zipf_items) ? rank : g->zipf_items - 1;
+}
+
+static uint64 NextOffset(OffsetGenerator *g)
+{
+    uint64 off = 0;
+
+    switch (g->pattern) {
+    case ACCESS_ZIPF: {
+        /* Scatter ranks so the hot blocks are not all at the start of the file */
+        uint64 item = Mix64(NextZipfRank(g)) % g->zipf_items;
+        off = item * g->block_size;
+        break;
+    }
+    case ACCESS_HOTCOLD: {
+        BOOL hot = (FastRandRange(&g->rng, 100) < g->hot_ops_pct) || (g->hot_slots >= g->slots);
+        uint64 slot = hot ? FastRandRange(&g->rng, g->hot_slots)
+                          : g->hot_slots + FastRandRange(&g->rng, g->slots - g->hot_slots);
+        off = slot * g->align;
+        break;
+    }
+    case ACCESS_STRIDED:
+        off = g->stride_pos;
+        g->stride_pos = ((g->stride_pos + g->stride) % (g->max_offset + 1)) & ~(uint64)(g->align - 1);
+        break;
+    case ACCESS_UNIFORM:
+    default:
+        off = FastRandRange(&g->rng, g->slots) * g->align;
+        break;
+    }
+
+    off &= ~(uint64)(g->align - 1);
+    return (off > g->max_offset) ? g->max_offset & ~(uint64)(g->align - 1) : off;
+}
+
+BOOL OffsetGenInit(OffsetGenerator *g, const BenchOptions *opts, uint64 file_size, uint32 block_size, uint32 align,
+                   uint32 count)
+{
+    memset(g, 0, sizeof(OffsetGenerator));
+    if (count == 0 || file_size < block_size || align == 0)
+        return FALSE;
+
+    g->offsets = PlatAlloc(sizeof(uint64) * count);
+    if (!g->offsets)
+        return FALSE;
+    g->count = count;
+
+    g->pattern = (opts->access_pattern < ACCESS_COUNT) ? (AccessPattern)opts->access_pattern : ACCESS_UNIFORM;
+    g->block_size = block_size;
+    g->align = align;
+    g->max_offset = file_size - block_size;
+    g->slots = g->max_offset / align + 1;
+    FastRandSeed(&g->rng, opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED);
+
+    switch (g->pattern) {
+    case ACCESS_ZIPF: {
+        double theta = (opts->zipf_theta > 0.0f) ? opts->zipf_theta : ACCESS_DEFAULT_ZIPF_THETA;
+        if (theta < 0.01)
+            theta = 0.01;
+        if (theta > 0.999)
+            theta = 0.999; /* The closed-form sampler is undefined at theta = 1 */
+        g->zipf_theta = theta;
+        g->zipf_items = g->max_offset / block_size + 1;
+        g->zipf_zetan = Zeta(g->zipf_items, theta);
+        g->zipf_alpha = 1.0 / (1.0 - theta);
+        g->zipf_eta = (1.0 - pow(2.0 / (double)g->zipf_items, 1.0 - theta)) / (1.0 - Zeta(2, theta) / g->zipf_zetan);
+        break;
+    }
+    case ACCESS_HOTCOLD: {
+        g->hot_ops_pct = opts->hot_ops_pct ? opts->hot_ops_pct : ACCESS_DEFAULT_HOT_OPS_PCT;
+        uint32 data_pct = opts->hot_data_pct ? opts->hot_data_pct : ACCESS_DEFAULT_HOT_DATA_PCT;
+        if (data_pct > 100)
+            data_pct = 100;
+        g->hot_slots = g->slots * data_pct / 100;
+        if (g->hot_slots == 0)
+            g->hot_slots = 1;
+        break;
+    }
+    case ACCESS_STRIDED:
+        g->stride = opts->stride_bytes ? opts->stride_bytes : block_size;
+        g->stride = (g->stride + align - 1) & ~(uint64)(align - 1);
+        break;
+    default:
+        break;
+    }
+
+    LOG_DEBUG("OffsetGen: pattern=%d, slots=%llu, count=%u", (int)g->pattern, (unsigned long long)g->slots,
+              (unsigned int)count);
+    return TRUE;
+}
+
+uint32 OffsetGenBatchSize(const BenchOptions *opts, uint32 planned)
+{
+    if (opts->duration_secs > 0)
+        return ACCESS_REFILL_CHUNK;
+
+    uint64 max_entries = PlatAvailMemory() / ACCESS_BATCH_MEM_DIV / sizeof(uint64);
+    if (max_entries < ACCESS_REFILL_CHUNK)
+        max_entries = ACCESS_REFILL_CHUNK;
+    return (planned > max_entries) ? (uint32)max_entries : planned;
+}
+
+void OffsetGenPrepare(OffsetGenerator *g)
+{
+    for (uint32 i = 0; i < g->count; i++)
+        g->offsets[i] = NextOffset(g);
+    g->next = 0;
+}
+
+void OffsetGenRefill(OffsetGenerator *g, BenchSampler *sampler)
+{
+    BenchTicks start = TimerNow();
+    OffsetGenPrepare(g);
+    SamplerExclude(sampler, TimerNow() - start);
+}
+
+void OffsetGenFree(OffsetGenerator *g)
+{
+    if (g->offsets) {
+        PlatFree(g->offsets);
+        g->offsets = NULL;
+    }
+    g->count = 0;
+}
+
+void FormatAccessPattern(const BenchOptions *opts, uint32 block_size, char *buf, uint32 size)
+{
+    switch (opts->access_pattern) {
+    case ACCESS_ZIPF:
+        snprintf(buf, size, "Zipf%.2f", (opts->zipf_theta > 0.0f) ? opts->zipf_theta : ACCESS_DEFAULT_ZIPF_THETA);
+        break;
+    case ACCESS_HOTCOLD:
+        snprintf(buf, size, "HotCold%u/%u",
+                 (unsigned int)(opts->hot_ops_pct ? opts->hot_ops_pct : ACCESS_DEFAULT_HOT_OPS_PCT),
+                 (unsigned int)(opts->hot_data_pct ? opts->hot_data_pct : ACCESS_DEFAULT_HOT_DATA_PCT));
+        break;
+    case ACCESS_STRIDED:
+        snprintf(buf, size, "Stride%u", (unsigned int)(opts->stride_bytes ? opts->stride_bytes : block_size));
+        break;
+    default:
+        snprintf(buf, size, "Uniform");
+        break;
+    }
+}
@@ -0,0 +1,180 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Raw block-device abstraction, request queue, image-file stand-in and request scheduler.
+ */
+
+#include "engine_blockdev.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+
+/* --- Image file backend --- */
+
+static BOOL FileRead(BlockDevice *dev, uint64 offset, void *buffer, uint32 length)
+{
+    FILE *fp = (FILE *)dev->handle;
+    if (fseeko(fp, (off_t)offset, SEEK_SET) != 0)
+        return FALSE;
+    return (fread(buffer, 1, length, fp) == length);
+}
+
+static void FileClose(BlockDevice *dev)
+{
+    fclose((FILE *)dev->handle);
+}
+
+static const BlockDeviceOps FileOps = {FileRead, FileClose};
+
+BOOL BlockDevOpenFile(BlockDevice *dev, const char *path, uint32 block_bytes)
+{
+    memset(dev, 0, sizeof(BlockDevice));
+    if (block_bytes == 0)
+        block_bytes = BLOCKDEV_DEFAULT_BLOCK;
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp)
+        return FALSE;
+
+    off_t size = -1;
+    if (fseeko(fp, 0, SEEK_END) == 0)
+        size = ftello(fp);
+    if (size < (off_t)block_bytes) {
+        fclose(fp);
+        return FALSE;
+    }
+
+    /* Unbuffered: each request should reach the file as issued, like a device command */
+    setvbuf(fp, NULL, _IONBF, 0);
+
+    dev->ops = &FileOps;
+    dev->handle = fp;
+    dev->block_bytes = block_bytes;
+    dev->capacity_bytes = (uint64)size / block_bytes * block_bytes;
+    snprintf(dev->name, sizeof(dev->name), "%s", path);
+    return TRUE;
+}
+
+/* --- Common --- */
+
+BOOL BlockDevRead(BlockDevice *dev, uint64 offset, void *buffer, uint32 length)
+{
+    BOOL ok = (offset + length <= dev->capacity_bytes) && dev->ops->Read(dev, offset, buffer, length);
+    dev->reads++;
+    if (ok)
+        dev->bytes_read += length;
+    else
+        dev->errors++;
+    return ok;
+}
+
+BOOL BlockDevQueueInit(BlockDevice *dev, uint32 depth)
+{
+    if (depth == 0 || depth > BLOCKDEV_MAX_QUEUE || dev->in_flight > 0)
+        return FALSE;
+    if (dev->ops->QueueInit && !dev->ops->QueueInit(dev, depth))
+        return FALSE;
+    dev->queue_depth = depth;
+    dev->done_head = 0;
+    dev->done_count = 0;
+    return TRUE;
+}
+
+BOOL BlockDevSubmit(BlockDevice *dev, uint32 slot, uint64 offset, void *buffer, uint32 length)
+{
+    if (slot >= dev->queue_depth || offset + length > dev->capacity_bytes) {
+        dev->reads++;
+        dev->errors++;
+        return FALSE;
+    }
+
+    if (dev->ops->Submit) {
+        if (!dev->ops->Submit(dev, slot, offset, buffer, length)) {
+            dev->reads++;
+            dev->errors++;
+            return FALSE;
+        }
+    } else {
+        /* No queueing in the backend: complete now and hand the result out in order */
+        uint32 tail = (dev->done_head + dev->done_count) % BLOCKDEV_MAX_QUEUE;
+        dev->done_slot[tail] = slot;
+        dev->done_ok[tail] = dev->ops->Read(dev, offset, buffer, length);
+        dev->done_count++;
+    }
+    dev->slot_length[slot] = length;
+    dev->in_flight++;
+    return TRUE;
+}
+
+int32 BlockDevWaitAny(BlockDevice *dev, BOOL *ok)
+{
+    if (dev->in_flight == 0)
+        return -1;
+
+    int32 slot;
+    if (dev->ops->WaitAny) {
+        slot = dev->ops->WaitAny(dev, ok);
+        if (slot < 0)
+            return -1;
+    } else {
+        slot = (int32)dev->done_slot[dev->done_head];
+        *ok = dev->done_ok[dev->done_head];
+        dev->done_head = (dev->done_head + 1) % BLOCKDEV_MAX_QUEUE;
+        dev->done_count--;
+    }
+
+    dev->in_flight--;
+    dev->reads++;
+    if (*ok)
+        dev->bytes_read += dev->slot_length[slot];
+    else
+        dev->errors++;
+    return slot;
+}
+
+void BlockDevClose(BlockDevice *dev)
+{
+    BOOL ok;
+    while (dev->ops && BlockDevWaitAny(dev, &ok) >= 0)
+        ;
+    if (dev->ops)
+        dev->ops->Close(dev);
+    dev->ops = NULL;
+    dev->handle = NULL;
+}
+
+uint32 BlockDevIOSize(const BlockDevice *dev, uint32 block_size)
+{
+    uint32 sectors = (block_size + dev->block_bytes - 1) / dev->block_bytes;
+    return (sectors ? sectors : 1) * dev->block_bytes;
+}
+
+/* --- Scheduler --- */
+
+BOOL RawScheduleInit(RawSchedule *s, const BlockDevice *dev, RawOrder order, uint32 io_bytes, uint64 seed)
+{
+    memset(s, 0, sizeof(RawSchedule));
+    if (io_bytes == 0 || dev->capacity_bytes < io_bytes)
+        return FALSE;
+
+    s->order = order;
+    s->io_bytes = io_bytes;
+    s->slots = dev->capacity_bytes / io_bytes;
+    FastRandSeed(&s->rng, seed);
+    return TRUE;
+}
+
+uint64 RawScheduleNext(RawSchedule *s)
+{
+    uint64 slot;
+    if (s->order == RAW_ORDER_RANDOM) {
+        slot = FastRandRange(&s->rng, s->slots);
+    } else {
+        slot = s->next;
+        if (++s->next >= s->slots)
+            s->next = 0;
+    }
+    return slot * s->io_bytes;
+}
@@ -0,0 +1,193 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Exec device backend for BlockDevice: 64-bit trackdisk reads via DoIO, or
+ * several at once via SendIO.
+ */
+
+#include "engine_blockdev.h"
+#include "engine_internal.h"
+#include <devices/newstyle.h>
+#include <devices/trackdisk.h>
+
+typedef struct
+{
+    struct MsgPort *port;
+    struct IOStdReq *ior;
+    uint16 read_cmd; /* NSCMD_TD_READ64 or TD_READ64 */
+
+    /* Request slots: slot 0 is ior itself, the others duplicates of it replying to the same port */
+    struct IOStdReq *queue[BLOCKDEV_MAX_QUEUE];
+    uint32 depth;
+} ExecDevHandle;
+
+/* 64-bit commands take the offset low word in io_Offset and the high word in io_Actual */
+static void SetupRead(ExecDevHandle *h, struct IOStdReq *ior, uint64 offset, void *buffer, uint32 length)
+{
+    ior->io_Command = h->read_cmd;
+    ior->io_Data = buffer;
+    ior->io_Length = length;
+    ior->io_Offset = (uint32)offset;
+    ior->io_Actual = (uint32)(offset >> 32);
+}
+
+static BOOL ExecRead(BlockDevice *dev, uint64 offset, void *buffer, uint32 length)
+{
+    ExecDevHandle *h = (ExecDevHandle *)dev->handle;
+    SetupRead(h, h->ior, offset, buffer, length);
+    return (IExec->DoIO((struct IORequest *)h->ior) == 0 && h->ior->io_Actual == length);
+}
+
+static void FreeQueue(ExecDevHandle *h)
+{
+    for (uint32 i = 1; i < h->depth; i++)
+        IExec->FreeSysObject(ASOT_IOREQUEST, h->queue[i]);
+    h->depth = 0;
+}
+
+static BOOL ExecQueueInit(BlockDevice *dev, uint32 depth)
+{
+    ExecDevHandle *h = (ExecDevHandle *)dev->handle;
+    FreeQueue(h);
+    h->queue[0] = h->ior;
+    for (h->depth = 1; h->depth < depth; h->depth++) {
+        h->queue[h->depth] = IExec->AllocSysObjectTags(ASOT_IOREQUEST, ASOIOR_Duplicate, h->ior, TAG_DONE);
+        if (!h->queue[h->depth]) {
+            FreeQueue(h);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static BOOL ExecSubmit(BlockDevice *dev, uint32 slot, uint64 offset, void *buffer, uint32 length)
+{
+    ExecDevHandle *h = (ExecDevHandle *)dev->handle;
+    SetupRead(h, h->queue[slot], offset, buffer, length);
+    IExec->SendIO((struct IORequest *)h->queue[slot]);
+    return TRUE;
+}
+
+static int32 ExecWaitAny(BlockDevice *dev, BOOL *ok)
+{
+    ExecDevHandle *h = (ExecDevHandle *)dev->handle;
+    struct IOStdReq *ior;
+    while (!(ior = (struct IOStdReq *)IExec->GetMsg(h->port)))
+        IExec->WaitPort(h->port);
+
+    for (uint32 i = 0; i < h->depth; i++) {
+        if (h->queue[i] == ior) {
+            *ok = (ior->io_Error == 0 && ior->io_Actual == ior->io_Length);
+            return (int32)i;
+        }
+    }
+    return -1;
+}
+
+static void ExecClose(BlockDevice *dev)
+{
+    ExecDevHandle *h = (ExecDevHandle *)dev->handle;
+    FreeQueue(h);
+    IExec->CloseDevice((struct IORequest *)h->ior);
+    IExec->FreeSysObject(ASOT_IOREQUEST, h->ior);
+    IExec->FreeSysObject(ASOT_PORT, h->port);
+    IExec->FreeVec(h);
+}
+
+static const BlockDeviceOps ExecOps = {ExecRead, ExecClose, ExecQueueInit, ExecSubmit, ExecWaitAny};
+
+/* TRUE if the device lists NSCMD_TD_READ64 in its NSCMD_DEVICEQUERY reply */
+static BOOL SupportsNSDRead64(struct IOStdReq *ior)
+{
+    struct NSDeviceQueryResult nsdqr;
+    memset(&nsdqr, 0, sizeof(nsdqr));
+    ior->io_Command = NSCMD_DEVICEQUERY;
+    ior->io_Data = &nsdqr;
+    ior->io_Length = sizeof(nsdqr);
+
+    if (IExec->DoIO((struct IORequest *)ior) != 0 || nsdqr.DeviceType != NSDEVTYPE_TRACKDISK ||
+        !nsdqr.SupportedCommands)
+        return FALSE;
+
+    for (const uint16 *cmd = nsdqr.SupportedCommands; *cmd; cmd++) {
+        if (*cmd == NSCMD_TD_READ64)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static BOOL QueryGeometry(struct IOStdReq *ior, BlockDevice *dev)
+{
+    struct DriveGeometry geom;
+    memset(&geom, 0, sizeof(geom));
+    ior->io_Command = TD_GETGEOMETRY;
+    ior->io_Data = &geom;
+    ior->io_Length = sizeof(geom);
+
+    if (IExec->DoIO((struct IORequest *)ior) != 0 || geom.dg_SectorSize == 0)
+        return FALSE;
+
+    dev->block_bytes = geom.dg_SectorSize;
+    dev->capacity_bytes = (uint64)geom.dg_Cylinders * geom.dg_Heads * geom.dg_TrackSectors * geom.dg_SectorSize;
+    if (dev->capacity_bytes == 0)
+        dev->capacity_bytes = (uint64)geom.dg_TotalSectors * geom.dg_SectorSize;
+    return (dev->capacity_bytes > 0);
+}
+
+BOOL BlockDevOpenExec(BlockDevice *dev, const char *device_name, uint32 unit)
+{
+    memset(dev, 0, sizeof(BlockDevice));
+
+    ExecDevHandle *h =
+        IExec->AllocVecTags(sizeof(ExecDevHandle), AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
+    if (!h)
+        return FALSE;
+
+    h->port = IExec->AllocSysObjectTags(ASOT_PORT, TAG_DONE);
+    if (h->port)
+        h->ior = IExec->AllocSysObjectTags(ASOT_IOREQUEST, ASOIOR_ReplyPort, h->port, ASOIOR_Size,
+                                           sizeof(struct IOExtTD), TAG_DONE);
+    if (!h->ior || IExec->OpenDevice(device_name, unit, (struct IORequest *)h->ior, 0) != 0) {
+        LOG_DEBUG("BlockDevOpenExec: cannot open %s unit %u", device_name, (unsigned int)unit);
+        if (h->ior)
+            IExec->FreeSysObject(ASOT_IOREQUEST, h->ior);
+        if (h->port)
+            IExec->FreeSysObject(ASOT_PORT, h->port);
+        IExec->FreeVec(h);
+        return FALSE;
+    }
+
+    dev->ops = &ExecOps;
+    dev->handle = h;
+    snprintf(dev->name, sizeof(dev->name), "%s/%u", device_name, (unsigned int)unit);
+
+    if (!QueryGeometry(h->ior, dev)) {
+        LOG_DEBUG("BlockDevOpenExec: %s has no usable geometry", dev->name);
+        BlockDevClose(dev);
+        return FALSE;
+    }
+
+    /* Prefer the NSD command; older TD64 drivers only know TD_READ64 */
+    h->read_cmd = SupportsNSDRead64(h->ior) ? NSCMD_TD_READ64 : TD_READ64;
+
+    uint8 *probe = IExec->AllocVecTags(dev->block_bytes, AVT_Type, MEMF_SHARED, TAG_DONE);
+    BOOL ok = probe && ExecRead(dev, 0, probe, dev->block_bytes);
+    if (!ok && probe && h->read_cmd == NSCMD_TD_READ64) {
+        h->read_cmd = TD_READ64;
+        ok = ExecRead(dev, 0, probe, dev->block_bytes);
+    }
+    if (probe)
+        IExec->FreeVec(probe);
+
+    if (!ok) {
+        LOG_DEBUG("BlockDevOpenExec: %s rejects 64-bit reads (error %d)", dev->name, (int)h->ior->io_Error);
+        BlockDevClose(dev);
+        return FALSE;
+    }
+
+    LOG_DEBUG("BlockDevOpenExec: %s, %u-byte sectors, %llu bytes, %s", dev->name, (unsigned int)dev->block_bytes,
+              (unsigned long long)dev->capacity_bytes,
+              (h->read_cmd == NSCMD_TD_READ64) ? "NSCMD_TD_READ64" : "TD_READ64");
+    return TRUE;
+}
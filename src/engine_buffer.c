@@ -0,0 +1,52 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Transfer buffers placed for the buffer alignment sweep.
+ */
+
+#include "engine_buffer.h"
+#include "engine_internal.h"
+
+static const char *buffer_mem_names[BUFFER_MEM_COUNT] = {"Default", "Shared", "Private", "Locked"};
+
+/* Offsets of a sweep: the full alignment, then word, cache-line and sector boundaries */
+static const uint32 buffer_offset_levels[] = {0, 4, 16, 32, 64, 512, 4096};
+#define BUFFER_NUM_OFFSETS (sizeof(buffer_offset_levels) / sizeof(buffer_offset_levels[0]))
+
+uint32 GetBufferOffsetLevels(uint32 *levels, uint32 max_levels)
+{
+    uint32 count = 0;
+    for (uint32 i = 0; i < BUFFER_NUM_OFFSETS && count < max_levels; i++)
+        levels[count++] = buffer_offset_levels[i];
+    return count;
+}
+
+const char *BufferMemName(uint32 mem)
+{
+    return (mem < BUFFER_MEM_COUNT) ? buffer_mem_names[mem] : "Unknown";
+}
+
+BOOL XferBufferAlloc(XferBuffer *b, uint32 size, const BenchOptions *opts)
+{
+    if (opts->buffer_mem == BUFFER_MEM_DEFAULT || opts->buffer_mem >= BUFFER_MEM_COUNT) {
+        b->base = PlatAlloc(size);
+        b->data = b->base;
+        return (b->base != NULL);
+    }
+
+    static const uint32 plat_types[BUFFER_MEM_COUNT] = {PLAT_MEM_SHARED, PLAT_MEM_SHARED, PLAT_MEM_PRIVATE,
+                                                        PLAT_MEM_LOCKED};
+    uint32 offset = opts->buffer_offset % BUFFER_BASE_ALIGN;
+    b->base = PlatAllocAligned(size + offset, BUFFER_BASE_ALIGN, plat_types[opts->buffer_mem]);
+    b->data = b->base ? b->base + offset : NULL;
+    return (b->base != NULL);
+}
+
+void XferBufferFree(XferBuffer *b)
+{
+    if (b->base)
+        PlatFree(b->base);
+    b->base = NULL;
+    b->data = NULL;
+}
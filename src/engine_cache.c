@@ -0,0 +1,142 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Cold-cache passes: eviction strategies run before each pass.
+ */
+
+#include "engine_cache.h"
+#include "engine_fixture.h"
+#include "engine_internal.h"
+
+static const char *evict_names[EVICT_COUNT] = {"File", "Inhibit", "Filesystem"};
+static const char *cache_mode_names[CACHE_MODE_COUNT] = {"Normal", "Cold", "Paired"};
+
+const char *EvictStrategyName(uint32 strategy)
+{
+    return (strategy < EVICT_COUNT) ? evict_names[strategy] : "Unknown";
+}
+
+const char *CacheModeName(uint32 mode)
+{
+    return (mode < CACHE_MODE_COUNT) ? cache_mode_names[mode] : "Unknown";
+}
+
+/* Eviction file: 25% more than free memory, so the cache cannot hold it and the workload's data together */
+static BOOL PrepareEvictionFile(CacheEvictor *ev)
+{
+    if (ev->file_ready)
+        return TRUE;
+
+    uint64 avail = PlatAvailMemory();
+    uint64 size = avail + avail / 4;
+    if (size < EVICT_MIN_BYTES)
+        size = EVICT_MIN_BYTES;
+    if (size > EVICT_MAX_BYTES) {
+        LogUser("Cache: %llu MB free, eviction file capped at %llu MB (cache may not be fully cleared)",
+                (unsigned long long)(avail >> 20), (unsigned long long)(EVICT_MAX_BYTES >> 20));
+        size = EVICT_MAX_BYTES;
+    }
+    size &= ~(uint64)(EVICT_CHUNK - 1);
+
+    ev->buffer = PlatAlloc(EVICT_CHUNK);
+    if (!ev->buffer)
+        return FALSE;
+
+    LOG_DEBUG("Cache: writing %llu MB eviction file %s", (unsigned long long)(size >> 20), ev->file_path);
+    if (!FixtureAcquire(ev->target, ev->file_path, size, EVICT_CHUNK, TRUE, ev->opts)) {
+        LogUser("Cache: could not create the %llu MB eviction file on '%s'", (unsigned long long)(size >> 20),
+                ev->target);
+        PlatFree(ev->buffer);
+        ev->buffer = NULL;
+        return FALSE;
+    }
+    ev->file_bytes = size;
+    ev->file_ready = TRUE;
+    return TRUE;
+}
+
+static void FallBackToFile(CacheEvictor *ev, const char *reason)
+{
+    LogUser("Cache: %s eviction %s - using an eviction file instead", EvictStrategyName(ev->strategy), reason);
+    ev->strategy = EVICT_FILE;
+}
+
+BOOL EvictorInit(CacheEvictor *ev, const char *target_path, uint32 strategy, const BenchWorkload *workload,
+                 uint32 streams, const BenchOptions *opts)
+{
+    memset(ev, 0, sizeof(*ev));
+    snprintf(ev->target, sizeof(ev->target), "%s", target_path);
+    snprintf(ev->file_path, sizeof(ev->file_path), "%s%s", target_path, EVICT_FILE_NAME);
+    ev->opts = opts;
+    ev->strategy = (strategy < EVICT_COUNT) ? strategy : EVICT_FILE;
+
+    if (ev->strategy == EVICT_INHIBIT && streams > 1)
+        FallBackToFile(ev, "is not available with concurrent streams");
+    else if (ev->strategy == EVICT_INHIBIT && !workload->SetFilesOpen)
+        FallBackToFile(ev, "needs a workload that can close its files");
+
+    if (ev->strategy == EVICT_FILE)
+        return PrepareEvictionFile(ev);
+    return TRUE;
+}
+
+static void ReadEvictionFile(CacheEvictor *ev)
+{
+    PlatFile file = PlatOpen(ev->file_path, PLAT_OPEN_EXISTING);
+    if (!file)
+        return;
+    for (uint64 done = 0; done < ev->file_bytes; done += EVICT_CHUNK) {
+        if (PlatRead(file, ev->buffer, EVICT_CHUNK) != EVICT_CHUNK)
+            break;
+    }
+    PlatClose(file);
+}
+
+/* FALSE if the workload's files did not reopen; an inhibit that fails falls back to the File strategy */
+static BOOL CycleInhibit(CacheEvictor *ev, const BenchWorkload *workload, void *data)
+{
+    if (!workload->SetFilesOpen(data, FALSE)) {
+        FallBackToFile(ev, "could not close the workload's files");
+        return TRUE;
+    }
+
+    if (PlatInhibit(ev->target, TRUE))
+        PlatInhibit(ev->target, FALSE);
+    else
+        FallBackToFile(ev, "could not inhibit the volume");
+
+    /* The volume revalidates after the release; opening fails until it is back */
+    for (uint32 i = 0; i < EVICT_REMOUNT_TRIES; i++) {
+        if (workload->SetFilesOpen(data, TRUE))
+            return TRUE;
+        PlatSleepMicros(100000);
+    }
+    LogUser("Cache: '%s' did not come back after Inhibit - the test files cannot be reopened", ev->target);
+    return FALSE;
+}
+
+BOOL EvictorRun(CacheEvictor *ev, const BenchWorkload *workload, void *data)
+{
+    /* Dirty buffers first, so nothing is left for the filesystem to write back during the pass */
+    FlushDiskCache(ev->target);
+
+    if (ev->strategy == EVICT_INHIBIT && !CycleInhibit(ev, workload, data))
+        return FALSE;
+    if (ev->strategy == EVICT_FILESYSTEM && !PlatDropVolumeCache(ev->target))
+        FallBackToFile(ev, "is not supported by this filesystem");
+
+    if (ev->strategy == EVICT_FILE && PrepareEvictionFile(ev))
+        ReadEvictionFile(ev);
+    return TRUE;
+}
+
+void EvictorFree(CacheEvictor *ev)
+{
+    if (ev->file_ready)
+        FixtureRelease(ev->file_path, FALSE);
+    if (ev->buffer)
+        PlatFree(ev->buffer);
+    ev->file_ready = FALSE;
+    ev->buffer = NULL;
+}
@@ -0,0 +1,162 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Fixture cache: pre-filled data files kept between the jobs of a queue.
+ */
+
+#include "engine_fixture.h"
+#include "engine_internal.h"
+
+typedef struct
+{
+    char path[MAX_PATH_LEN * 2];
+    uint64 size;
+} CachedFixture;
+
+/* Only touched by the engine's own process: stream instances never cache */
+static CachedFixture fixtures[FIXTURE_MAX_CACHED];
+static uint32 fixture_count = 0;
+static char fixture_volume[MAX_PATH_LEN];
+
+static int32 FindFixture(const char *path)
+{
+    for (uint32 i = 0; i < fixture_count; i++) {
+        if (strcmp(fixtures[i].path, path) == 0)
+            return (int32)i;
+    }
+    return -1;
+}
+
+static void ForgetFixture(int32 idx)
+{
+    fixtures[idx] = fixtures[--fixture_count];
+}
+
+/*
+ * FNV-1a over FIXTURE_SAMPLES blocks spread evenly from the first to the
+ * last sector of the data. Catches a truncated, rewritten or foreign file
+ * without reading it all.
+ */
+static BOOL SampleFixture(PlatFile file, uint64 size, uint32 *out_sum)
+{
+    uint8 block[FIXTURE_SAMPLE_BYTES];
+    uint32 len = (size < FIXTURE_SAMPLE_BYTES) ? (uint32)size : FIXTURE_SAMPLE_BYTES;
+    uint32 sum = 2166136261U;
+
+    for (uint32 i = 0; i < FIXTURE_SAMPLES; i++) {
+        uint64 offset = (size - len) * i / (FIXTURE_SAMPLES - 1);
+        offset &= ~(uint64)(FIXTURE_SAMPLE_BYTES - 1);
+        if (!PlatSeek(file, offset) || PlatRead(file, block, len) != (int32)len)
+            return FALSE;
+        for (uint32 j = 0; j < len; j++) {
+            sum ^= block[j];
+            sum *= 16777619U;
+        }
+    }
+    *out_sum = sum;
+    return TRUE;
+}
+
+/* Write the header after the data, recording what is in the file now */
+static BOOL StampFixture(const char *path, uint64 size, uint32 pattern, uint32 seed)
+{
+    PlatFile file = PlatOpen(path, PLAT_OPEN_EXISTING);
+    if (!file)
+        return FALSE;
+
+    FixtureHeader hdr;
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.magic = FIXTURE_MAGIC;
+    hdr.version = FIXTURE_VERSION;
+    hdr.data_bytes = size;
+    hdr.pattern = pattern;
+    hdr.seed = seed;
+
+    BOOL ok = SampleFixture(file, size, &hdr.sample_sum) && PlatSeek(file, size) &&
+              PlatWrite(file, &hdr, sizeof(hdr)) == (int32)sizeof(hdr);
+    PlatClose(file);
+    return ok;
+}
+
+static BOOL FixtureMatches(const char *path, uint64 size, BOOL any_content, uint32 pattern, uint32 seed)
+{
+    PlatFile file = PlatOpen(path, PLAT_OPEN_EXISTING);
+    if (!file)
+        return FALSE;
+
+    FixtureHeader hdr;
+    uint32 sum = 0;
+    BOOL ok = PlatSeek(file, size) && PlatRead(file, &hdr, sizeof(hdr)) == (int32)sizeof(hdr) &&
+              hdr.magic == FIXTURE_MAGIC && hdr.version == FIXTURE_VERSION && hdr.data_bytes == size &&
+              (any_content || (hdr.pattern == pattern && hdr.seed == seed)) && SampleFixture(file, size, &sum) &&
+              sum == hdr.sample_sum;
+    PlatClose(file);
+    return ok;
+}
+
+BOOL FixtureAcquire(const char *target_path, const char *file_path, uint64 size, uint32 fill_chunk,
+                    BOOL any_content, const BenchOptions *opts)
+{
+    /* Write workloads only need the space; readers in verify mode need stamped data */
+    VerifyState verify;
+    VerifyInit(&verify, opts);
+    if (any_content)
+        verify.enabled = FALSE;
+    uint32 pattern = verify.enabled ? FIXTURE_PATTERN_VERIFY : FIXTURE_FILL_BYTE;
+    uint32 seed = verify.enabled ? verify.seed : 0;
+
+    if (!opts->reuse_fixtures)
+        return (WriteDummyFile(file_path, size, fill_chunk, NULL, NULL, &verify) != 0);
+
+    if (fixture_count > 0 && strcasecmp(fixture_volume, target_path) != 0) {
+        LOG_DEBUG("Fixture: target changed from %s to %s", fixture_volume, target_path);
+        FixtureCacheFlush();
+    }
+    snprintf(fixture_volume, sizeof(fixture_volume), "%s", target_path);
+
+    int32 idx = FindFixture(file_path);
+    if (idx >= 0) {
+        if (FixtureMatches(file_path, size, any_content, pattern, seed)) {
+            LOG_DEBUG("Fixture: reusing %s (%llu bytes)", file_path, (unsigned long long)size);
+            return TRUE;
+        }
+        LOG_DEBUG("Fixture: %s no longer matches, rewriting", file_path);
+        ForgetFixture(idx);
+    }
+
+    uint64 written = WriteDummyFile(file_path, size, fill_chunk, NULL, NULL, &verify);
+    if (written == 0)
+        return FALSE;
+
+    /* A short or unstampable file is still usable once, it just is not kept */
+    if (written == size && fixture_count < FIXTURE_MAX_CACHED && StampFixture(file_path, size, pattern, seed)) {
+        CachedFixture *f = &fixtures[fixture_count++];
+        snprintf(f->path, sizeof(f->path), "%s", file_path);
+        f->size = size;
+    }
+    return TRUE;
+}
+
+void FixtureRelease(const char *file_path, BOOL modified)
+{
+    int32 idx = FindFixture(file_path);
+    if (idx < 0) {
+        PlatDelete(file_path);
+        return;
+    }
+    if (modified && !StampFixture(file_path, fixtures[idx].size, FIXTURE_PATTERN_MODIFIED, 0)) {
+        ForgetFixture(idx);
+        PlatDelete(file_path);
+    }
+}
+
+void FixtureCacheFlush(void)
+{
+    for (uint32 i = 0; i < fixture_count; i++) {
+        LOG_DEBUG("Fixture: deleting %s", fixtures[i].path);
+        PlatDelete(fixtures[i].path);
+    }
+    fixture_count = 0;
+    fixture_volume[0] = '\0';
+}
@@ -0,0 +1,105 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Host counterparts of engine_info.c and engine_blockdev_exec.c for the
+ * diskbench tool: the volume is the mount holding the path, the device is
+ * its /dev node, read through the file backend.
+ */
+
+#define _GNU_SOURCE
+#include "engine_blockdev.h"
+#include "engine_internal.h"
+#include "version.h"
+#include <mntent.h>
+#include <stdlib.h>
+#include <sys/vfs.h>
+
+typedef struct
+{
+    char device[BLOCKDEV_NAME_LEN];
+    char fstype[32];
+} HostMount;
+
+/* The mount whose directory is the longest prefix of path */
+static BOOL FindMount(const char *path, HostMount *out)
+{
+    char abs_path[MAX_PATH_LEN];
+    if (!realpath(path, abs_path))
+        snprintf(abs_path, sizeof(abs_path), "%s", path);
+
+    FILE *mounts = setmntent("/proc/mounts", "r");
+    if (!mounts)
+        return FALSE;
+
+    size_t best_len = 0;
+    struct mntent *m;
+    while ((m = getmntent(mounts))) {
+        size_t len = strlen(m->mnt_dir);
+        if (strncmp(abs_path, m->mnt_dir, len) != 0)
+            continue;
+        if (len > 1 && abs_path[len] != '\0' && abs_path[len] != '/')
+            continue; /* "/mnt/a" does not hold "/mnt/ab" */
+        if (len >= best_len) {
+            best_len = len;
+            snprintf(out->device, sizeof(out->device), "%s", m->mnt_fsname);
+            snprintf(out->fstype, sizeof(out->fstype), "%s", m->mnt_type);
+        }
+    }
+    endmntent(mounts);
+    return (best_len > 0);
+}
+
+void GetFileSystemInfo(const char *path, char *out_name, uint32 name_size)
+{
+    HostMount mount;
+    if (FindMount(path, &mount)) {
+        snprintf(out_name, name_size, "%s", mount.fstype);
+        return;
+    }
+
+    struct statfs sfs;
+    if (statfs(path, &sfs) == 0)
+        snprintf(out_name, name_size, "0x%08lX", (unsigned long)sfs.f_type);
+    else
+        snprintf(out_name, name_size, "%s", "Unknown");
+}
+
+void ClearHardwareInfoCache(void)
+{
+    /* Nothing cached: /proc/mounts is cheap to read */
+}
+
+void GetHardwareInfo(const char *path, BenchResult *result)
+{
+    snprintf(result->app_version, sizeof(result->app_version), "%s", APP_VERSION_STR);
+    snprintf(result->device_name, sizeof(result->device_name), "%s", "Unknown");
+    result->device_unit = 0;
+    snprintf(result->vendor, sizeof(result->vendor), "%s", "Standard");
+    snprintf(result->product, sizeof(result->product), "%s", "Storage Device");
+
+    HostMount mount;
+    if (FindMount(path, &mount))
+        snprintf(result->device_name, sizeof(result->device_name), "%s", mount.device);
+}
+
+BOOL GetDeviceFromVolume(const char *volume, char *out_device, uint32 device_size, uint32 *out_unit)
+{
+    if (!volume || !out_device || !out_unit)
+        return FALSE;
+
+    HostMount mount;
+    if (!FindMount(volume, &mount) || strncmp(mount.device, "/dev/", 5) != 0)
+        return FALSE; /* tmpfs, overlay and the like have no block device */
+
+    snprintf(out_device, device_size, "%s", mount.device);
+    *out_unit = 0;
+    return TRUE;
+}
+
+/* The unit is part of the node name on a host (/dev/sda1) */
+BOOL BlockDevOpenExec(BlockDevice *dev, const char *device_name, uint32 unit)
+{
+    (void)unit;
+    return BlockDevOpenFile(dev, device_name, 0);
+}
@@ -0,0 +1,91 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Log-bucketed per-operation latency histogram.
+ */
+
+#include "engine_latency.h"
+#include <string.h>
+
+/* Map a microsecond value to its bucket index */
+static uint32 LatencyBucketIndex(uint32 micros)
+{
+    if (micros < LAT_SUB_BUCKETS)
+        return micros;
+
+    uint32 msb = 31 - __builtin_clz(micros);
+    uint32 shift = msb - LAT_SUB_BUCKET_BITS;
+    return (msb - LAT_SUB_BUCKET_BITS + 1) * LAT_SUB_BUCKETS + ((micros >> shift) & (LAT_SUB_BUCKETS - 1));
+}
+
+/* Highest microsecond value that maps to the given bucket */
+static uint32 LatencyBucketUpperBound(uint32 index)
+{
+    if (index < LAT_SUB_BUCKETS)
+        return index;
+
+    uint32 msb = index / LAT_SUB_BUCKETS + LAT_SUB_BUCKET_BITS - 1;
+    uint32 shift = msb - LAT_SUB_BUCKET_BITS;
+    uint64 lower = (uint64)(LAT_SUB_BUCKETS + (index % LAT_SUB_BUCKETS)) << shift;
+    uint64 upper = lower + ((uint64)1 << shift) - 1;
+    return (upper > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32)upper;
+}
+
+void LatencyReset(LatencyHistogram *h)
+{
+    if (!h)
+        return;
+    memset(h, 0, sizeof(LatencyHistogram));
+    h->min_us = 0xFFFFFFFFU;
+}
+
+void LatencyRecord(LatencyHistogram *h, uint32 micros)
+{
+    h->buckets[LatencyBucketIndex(micros)]++;
+    h->count++;
+    h->sum_us += micros;
+    if (micros < h->min_us)
+        h->min_us = micros;
+    if (micros > h->max_us)
+        h->max_us = micros;
+}
+
+void LatencyMerge(LatencyHistogram *dst, const LatencyHistogram *src)
+{
+    if (!dst || !src || src->count == 0)
+        return;
+
+    for (uint32 i = 0; i < LAT_NUM_BUCKETS; i++) {
+        dst->buckets[i] += src->buckets[i];
+    }
+    dst->count += src->count;
+    dst->sum_us += src->sum_us;
+    if (src->min_us < dst->min_us)
+        dst->min_us = src->min_us;
+    if (src->max_us > dst->max_us)
+        dst->max_us = src->max_us;
+}
+
+float LatencyPercentile(const LatencyHistogram *h, float percentile)
+{
+    if (!h || h->count == 0)
+        return 0.0f;
+
+    /* Rank of the sample that sits at the requested percentile (1-based) */
+    uint64 rank = (uint64)((double)h->count * (double)percentile / 100.0 + 0.5);
+    if (rank < 1)
+        rank = 1;
+    if (rank > h->count)
+        rank = h->count;
+
+    uint64 seen = 0;
+    for (uint32 i = 0; i < LAT_NUM_BUCKETS; i++) {
+        seen += h->buckets[i];
+        if (seen >= rank) {
+            uint32 upper = LatencyBucketUpperBound(i);
+            return (float)((upper > h->max_us) ? h->max_us : upper);
+        }
+    }
+    return (float)h->max_us;
+}
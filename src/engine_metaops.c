@@ -0,0 +1,61 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Per-class metadata operation counters.
+ */
+
+#include "engine_metaops.h"
+#include "engine_internal.h"
+
+static const char *const meta_op_names[META_OP_COUNT] = {"Create", "Lookup", "Scan", "Rename", "Delete",
+                                                            "MakeDir", "DeleteDir"};
+
+const char *MetaOpName(MetaOp op)
+{
+    return (op < META_OP_COUNT) ? meta_op_names[op] : "Unknown";
+}
+
+float MetaOpRate(const MetaOpResult *m)
+{
+    return (m->count > 0 && m->secs > 0.0f) ? (float)m->count / m->secs : 0.0f;
+}
+
+void MetaOpsReset(MetaOpStats *m)
+{
+    memset(m->count, 0, sizeof(m->count));
+    memset(m->ticks, 0, sizeof(m->ticks));
+    for (uint32 op = 0; op < META_OP_COUNT; op++)
+        LatencyReset(&m->latency[op]);
+}
+
+void MetaOpsMerge(MetaOpStats *dest, const MetaOpStats *src)
+{
+    for (uint32 op = 0; op < META_OP_COUNT; op++) {
+        dest->count[op] += src->count[op];
+        dest->ticks[op] += src->ticks[op];
+        LatencyMerge(&dest->latency[op], &src->latency[op]);
+    }
+}
+
+void MetaOpsRecord(MetaOpStats *m, MetaOp op, uint32 n, BenchTicks start)
+{
+    BenchTicks now = TimerNow();
+    m->count[op] += n;
+    m->ticks[op] += now - start;
+    if (n == 0)
+        return;
+    uint32 micros = TimerOpMicros(start, now) / n;
+    for (uint32 i = 0; i < n; i++)
+        LatencyRecord(&m->latency[op], micros);
+}
+
+void MetaOpsToResult(const MetaOpStats *m, MetaOpResult *out)
+{
+    for (uint32 op = 0; op < META_OP_COUNT; op++) {
+        out[op].count = m->count[op];
+        out[op].secs = (float)TimerSeconds(0, m->ticks[op]);
+        out[op].p50_us = LatencyPercentile(&m->latency[op], 50.0f);
+        out[op].p99_us = LatencyPercentile(&m->latency[op], 99.0f);
+    }
+}
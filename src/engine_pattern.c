@@ -0,0 +1,78 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Write data patterns: constant fill or a pre-generated, partly random pool.
+ */
+
+#include "engine_pattern.h"
+#include "engine_access.h"
+#include "engine_internal.h"
+
+BOOL DataPatternInit(DataPattern *dp, const BenchOptions *opts, uint32 max_len, uint8 fill)
+{
+    memset(dp, 0, sizeof(*dp));
+    dp->random_pct = (opts->data_random_pct > 100) ? 100 : opts->data_random_pct;
+
+    /* The constant fill needs one write's worth; a random pool is large enough to vary between writes */
+    dp->pool_bytes = max_len;
+    if (dp->random_pct > 0 && dp->pool_bytes < DATA_POOL_BYTES)
+        dp->pool_bytes = DATA_POOL_BYTES;
+    dp->slice_align = (opts->buffer_mem != BUFFER_MEM_DEFAULT) ? BUFFER_BASE_ALIGN : DATA_ALIGN;
+    if (!XferBufferAlloc(&dp->pool_buf, dp->pool_bytes, opts))
+        return FALSE;
+    dp->pool = dp->pool_buf.data;
+
+    if (dp->random_pct == 0) {
+        memset(dp->pool, fill, dp->pool_bytes);
+        return TRUE;
+    }
+
+    FastRand rng;
+    uint32 seed = opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED;
+    FastRandSeed(&rng, seed);
+    uint32 random_bytes = DATA_SEGMENT_BYTES * dp->random_pct / 100;
+    for (uint32 seg = 0; seg < dp->pool_bytes; seg += DATA_SEGMENT_BYTES) {
+        uint32 len = (dp->pool_bytes - seg < DATA_SEGMENT_BYTES) ? dp->pool_bytes - seg : DATA_SEGMENT_BYTES;
+        uint32 rnd = (random_bytes < len) ? random_bytes : len;
+        for (uint32 i = 0; i < rnd; i += 8) {
+            uint64 r = FastRandNext(&rng);
+            memcpy(dp->pool + seg + i, &r, (rnd - i < 8) ? rnd - i : 8);
+        }
+        memset(dp->pool + seg + rnd, 0, len - rnd);
+    }
+    dp->serial = (uint64)seed << 32;
+    return TRUE;
+}
+
+uint8 *DataPatternNext(DataPattern *dp, uint32 len)
+{
+    if (dp->random_pct == 0)
+        return dp->pool;
+
+    if (dp->next + len > dp->pool_bytes)
+        dp->next = 0;
+    uint8 *p = dp->pool + dp->next;
+    dp->next += (len + dp->slice_align - 1) & ~(dp->slice_align - 1);
+
+    for (uint32 i = 0; i + sizeof(dp->serial) <= len; i += DATA_TAG_SPACING) {
+        memcpy(p + i, &dp->serial, sizeof(dp->serial));
+        dp->serial++;
+    }
+    return p;
+}
+
+void DataPatternFree(DataPattern *dp)
+{
+    XferBufferFree(&dp->pool_buf);
+    dp->pool = NULL;
+}
+
+void FormatDataPattern(const BenchOptions *opts, char *buf, uint32 size)
+{
+    uint32 pct = (opts->data_random_pct > 100) ? 100 : opts->data_random_pct;
+    if (pct == 0)
+        snprintf(buf, size, "Fill");
+    else
+        snprintf(buf, size, "Random%u", (unsigned int)pct);
+}
@@ -6,26 +6,396 @@
 #include "engine_internal.h"
 #include <stdlib.h>
 
+/* Extended CSV columns following "Serial", in file order. New metrics are appended at the end. */
+enum
+{
+    EXT_COL_LAT_P50 = 0,
+    EXT_COL_LAT_P90,
+    EXT_COL_LAT_P99,
+    EXT_COL_LAT_P999,
+    EXT_COL_LAT_MAX,
+    EXT_COL_PASS_SECS,
+    EXT_COL_RAMPUP_SECS,
+    EXT_COL_CI95_PCT,
+    EXT_COL_CV_PCT,
+    EXT_COL_DATASET_BYTES,
+    EXT_COL_ACCESS,
+    EXT_COL_STREAMS,
+    EXT_COL_STREAM_MBPS,
+    EXT_COL_STREAM_IOPS,
+    EXT_COL_SLOW_STREAM_MBPS,
+    EXT_COL_CACHE_MODE,
+    EXT_COL_WARM_MBPS,
+    EXT_COL_CACHE_SPEEDUP,
+    EXT_COL_WORKING_SET,
+    EXT_COL_VERIFY_BYTES,
+    EXT_COL_VERIFY_ERRORS,
+    EXT_COL_VERIFY_SECS,
+    EXT_COL_DATA_PATTERN,
+    EXT_COL_DIR_ENTRIES,
+    EXT_COL_META_OPS,
+    EXT_COL_COMMIT_GROUP,
+    EXT_COL_ZONE_MAP,
+    EXT_COL_SEEK_MAP,
+    EXT_COL_SEEK_ROTATION_US,
+    EXT_COL_SEEK_TRACK_US,
+    EXT_COL_SEEK_FULL_US,
+    EXT_COL_QUEUE_DEPTH,
+    EXT_COL_STRIDE_MAP,
+    EXT_COL_STRIDE_RANDOM_US,
+    EXT_COL_READAHEAD_BYTES,
+    EXT_COL_READBEHIND_BYTES,
+    EXT_COL_IO_BUFFER,
+    EXT_COL_BUFFER_MEM,
+    EXT_COL_BUFFER_OFFSET,
+    EXT_COL_COUNT
+};
+
+/*
+ * MetaOps column: "Create=1000/0.052300/48/310;Lookup=..." (count/seconds/p50 us/p99 us) for the
+ * classes the test performed, empty otherwise. Older files without the percentiles still parse.
+ */
+static BOOL FormatMetaOps(const BenchResult *result, char *buf, uint32 buf_size)
+{
+    int written = 0;
+    buf[0] = '\0';
+    for (uint32 op = 0; op < META_OP_COUNT; op++) {
+        const MetaOpResult *m = &result->meta_ops[op];
+        if (m->count == 0)
+            continue;
+        int more = snprintf(buf + written, buf_size - written, "%s%s=%u/%.6f/%.0f/%.0f", written ? ";" : "",
+                            MetaOpName((MetaOp)op), (unsigned int)m->count, m->secs, m->p50_us, m->p99_us);
+        if (more <= 0 || more >= (int)buf_size - written)
+            return FALSE;
+        written += more;
+    }
+    return TRUE;
+}
+
+static void ParseMetaOps(char *field, BenchResult *result)
+{
+    char *entry;
+    while ((entry = strsep(&field, ";")) != NULL) {
+        char *value = strchr(entry, '=');
+        if (!value)
+            continue;
+        *value++ = '\0';
+        for (uint32 op = 0; op < META_OP_COUNT; op++) {
+            if (strcmp(entry, MetaOpName((MetaOp)op)) == 0) {
+                char *secs = strchr(value, '/');
+                char *p50 = secs ? strchr(secs + 1, '/') : NULL;
+                char *p99 = p50 ? strchr(p50 + 1, '/') : NULL;
+                result->meta_ops[op].count = strtoul(value, NULL, 10);
+                result->meta_ops[op].secs = secs ? (float)atof(secs + 1) : 0.0f;
+                result->meta_ops[op].p50_us = p50 ? (float)atof(p50 + 1) : 0.0f;
+                result->meta_ops[op].p99_us = p99 ? (float)atof(p99 + 1) : 0.0f;
+                break;
+            }
+        }
+    }
+}
+
+/* ZoneMap column: "118.2;117.9;...;61.4" MB/s from the first zone to the last, weak zones marked '*' */
+static BOOL FormatZoneMap(const BenchResult *result, char *buf, uint32 buf_size)
+{
+    int written = 0;
+    buf[0] = '\0';
+    for (uint32 i = 0; i < result->zone_count && i < ZONE_MAP_MAX; i++) {
+        int more = snprintf(buf + written, buf_size - written, "%s%.1f%s", i ? ";" : "", result->zone_mbps[i],
+                            (result->zone_weak_mask & (1UL << i)) ? "*" : "");
+        if (more <= 0 || more >= (int)buf_size - written)
+            return FALSE;
+        written += more;
+    }
+    return TRUE;
+}
+
+static void ParseZoneMap(char *field, BenchResult *result)
+{
+    char *entry;
+    result->zone_count = 0;
+    result->zone_weak_mask = 0;
+    while ((entry = strsep(&field, ";")) != NULL && result->zone_count < ZONE_MAP_MAX) {
+        if (!entry[0])
+            continue;
+        if (strchr(entry, '*'))
+            result->zone_weak_mask |= 1UL << result->zone_count;
+        result->zone_mbps[result->zone_count++] = (float)atof(entry);
+    }
+}
+
+/* SeekMap column: "4096:212;8192:4630;...;1000204795904:17020" distance in bytes : mean us per distance */
+static BOOL FormatSeekMap(const BenchResult *result, char *buf, uint32 buf_size)
+{
+    int written = 0;
+    buf[0] = '\0';
+    for (uint32 i = 0; i < result->seek_levels && i < SEEK_PROFILE_MAX; i++) {
+        int more = snprintf(buf + written, buf_size - written, "%s%llu:%.0f", i ? ";" : "",
+                            (unsigned long long)result->seek_dist_bytes[i], result->seek_us[i]);
+        if (more <= 0 || more >= (int)buf_size - written)
+            return FALSE;
+        written += more;
+    }
+    return TRUE;
+}
+
+static void ParseSeekMap(char *field, BenchResult *result)
+{
+    char *entry;
+    result->seek_levels = 0;
+    while ((entry = strsep(&field, ";")) != NULL && result->seek_levels < SEEK_PROFILE_MAX) {
+        char *sep = strchr(entry, ':');
+        if (!sep)
+            continue;
+        result->seek_dist_bytes[result->seek_levels] = strtoull(entry, NULL, 10);
+        result->seek_us[result->seek_levels++] = (float)atof(sep + 1);
+    }
+}
+
+/* StrideMap column: "0:95/4210;4096:102/4180;..." gap in bytes : mean us forward / backward per gap */
+static BOOL FormatStrideMap(const BenchResult *result, char *buf, uint32 buf_size)
+{
+    int written = 0;
+    buf[0] = '\0';
+    for (uint32 i = 0; i < result->stride_levels && i < STRIDE_LEVELS_MAX; i++) {
+        int more = snprintf(buf + written, buf_size - written, "%s%u:%.0f/%.0f", i ? ";" : "",
+                            (unsigned int)result->stride_gap_bytes[i], result->stride_fwd_us[i],
+                            result->stride_back_us[i]);
+        if (more <= 0 || more >= (int)buf_size - written)
+            return FALSE;
+        written += more;
+    }
+    return TRUE;
+}
+
+static void ParseStrideMap(char *field, BenchResult *result)
+{
+    char *entry;
+    result->stride_levels = 0;
+    while ((entry = strsep(&field, ";")) != NULL && result->stride_levels < STRIDE_LEVELS_MAX) {
+        char *fwd = strchr(entry, ':');
+        char *back = fwd ? strchr(fwd, '/') : NULL;
+        if (!back)
+            continue;
+        result->stride_gap_bytes[result->stride_levels] = strtoul(entry, NULL, 10);
+        result->stride_fwd_us[result->stride_levels] = (float)atof(fwd + 1);
+        result->stride_back_us[result->stride_levels++] = (float)atof(back + 1);
+    }
+}
+
+BOOL FormatExtendedCSVFields(const BenchResult *result, char *buf, uint32 buf_size)
+{
+    int written = snprintf(buf, buf_size, ",%.1f,%.1f,%.1f,%.1f,%.1f,%u,%.2f,%.2f,%.2f,%llu,%s", result->lat_p50_us,
+                           result->lat_p90_us, result->lat_p99_us, result->lat_p999_us, result->lat_max_us,
+                           (unsigned int)result->pass_duration_secs, result->rampup_secs, result->ci95_pct,
+                           result->cv_pct, (unsigned long long)result->dataset_bytes, result->access_pattern);
+    if (written <= 0 || written >= (int)buf_size)
+        return FALSE;
+
+    int more = snprintf(buf + written, buf_size - written, ",%u,%.2f,%u,%.2f,%s,%.2f,%.2f",
+                        (unsigned int)result->streams, result->stream_mbps, (unsigned int)result->stream_iops,
+                        result->slow_stream_mbps, result->cache_mode, result->warm_mbps, result->cache_speedup);
+    if (more <= 0 || more >= (int)buf_size - written)
+        return FALSE;
+    written += more;
+
+    more = snprintf(buf + written, buf_size - written, ",%llu,%llu,%u,%.6f,%s",
+                    (unsigned long long)result->working_set_bytes, (unsigned long long)result->verify_bytes,
+                    (unsigned int)result->verify_errors, result->verify_secs, result->data_pattern);
+    if (more <= 0 || more >= (int)buf_size - written)
+        return FALSE;
+    written += more;
+
+    char meta_ops[384];
+    if (!FormatMetaOps(result, meta_ops, sizeof(meta_ops)))
+        return FALSE;
+    char zone_map[320];
+    if (!FormatZoneMap(result, zone_map, sizeof(zone_map)))
+        return FALSE;
+    more = snprintf(buf + written, buf_size - written, ",%u,%s,%u,%s", (unsigned int)result->dir_entries, meta_ops,
+                    (unsigned int)result->commit_group, zone_map);
+    if (more <= 0 || more >= (int)buf_size - written)
+        return FALSE;
+    written += more;
+
+    char seek_map[1024];
+    if (!FormatSeekMap(result, seek_map, sizeof(seek_map)))
+        return FALSE;
+    more = snprintf(buf + written, buf_size - written, ",%s,%.0f,%.0f,%.0f,%u", seek_map, result->seek_rotation_us,
+                    result->seek_track_us, result->seek_full_us, (unsigned int)result->queue_depth);
+    if (more <= 0 || more >= (int)buf_size - written)
+        return FALSE;
+    written += more;
+
+    char stride_map[512];
+    if (!FormatStrideMap(result, stride_map, sizeof(stride_map)))
+        return FALSE;
+    more = snprintf(buf + written, buf_size - written, ",%s,%.0f,%u,%u,%u,%u,%u", stride_map,
+                    result->stride_random_us, (unsigned int)result->readahead_bytes,
+                    (unsigned int)result->readbehind_bytes, (unsigned int)result->io_buffer,
+                    (unsigned int)result->buffer_mem, (unsigned int)result->buffer_offset);
+    return (more > 0 && more < (int)buf_size - written);
+}
+
+void ParseExtendedCSVFields(const char *fields, BenchResult *result)
+{
+    if (!fields || !result)
+        return;
+
+    char buf[2048];
+    snprintf(buf, sizeof(buf), "%s", fields);
+
+    char *rest = buf;
+    if (*rest == ',')
+        rest++;
+
+    char *token;
+    uint32 col = 0;
+    while (col < EXT_COL_COUNT && (token = strsep(&rest, ",\r\n")) != NULL) {
+        if (token[0] != '\0') {
+            switch (col) {
+            case EXT_COL_LAT_P50:
+                result->lat_p50_us = (float)atof(token);
+                break;
+            case EXT_COL_LAT_P90:
+                result->lat_p90_us = (float)atof(token);
+                break;
+            case EXT_COL_LAT_P99:
+                result->lat_p99_us = (float)atof(token);
+                break;
+            case EXT_COL_LAT_P999:
+                result->lat_p999_us = (float)atof(token);
+                break;
+            case EXT_COL_LAT_MAX:
+                result->lat_max_us = (float)atof(token);
+                break;
+            case EXT_COL_PASS_SECS:
+                result->pass_duration_secs = (uint32)strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_RAMPUP_SECS:
+                result->rampup_secs = (float)atof(token);
+                break;
+            case EXT_COL_CI95_PCT:
+                result->ci95_pct = (float)atof(token);
+                break;
+            case EXT_COL_CV_PCT:
+                result->cv_pct = (float)atof(token);
+                break;
+            case EXT_COL_DATASET_BYTES:
+                result->dataset_bytes = strtoull(token, NULL, 10);
+                break;
+            case EXT_COL_ACCESS:
+                snprintf(result->access_pattern, sizeof(result->access_pattern), "%s", token);
+                break;
+            case EXT_COL_STREAMS:
+                result->streams = (uint32)strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_STREAM_MBPS:
+                result->stream_mbps = (float)atof(token);
+                break;
+            case EXT_COL_STREAM_IOPS:
+                result->stream_iops = (uint32)strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_SLOW_STREAM_MBPS:
+                result->slow_stream_mbps = (float)atof(token);
+                break;
+            case EXT_COL_CACHE_MODE:
+                snprintf(result->cache_mode, sizeof(result->cache_mode), "%s", token);
+                break;
+            case EXT_COL_WARM_MBPS:
+                result->warm_mbps = (float)atof(token);
+                break;
+            case EXT_COL_CACHE_SPEEDUP:
+                result->cache_speedup = (float)atof(token);
+                break;
+            case EXT_COL_WORKING_SET:
+                result->working_set_bytes = strtoull(token, NULL, 10);
+                break;
+            case EXT_COL_VERIFY_BYTES:
+                result->verify_bytes = strtoull(token, NULL, 10);
+                break;
+            case EXT_COL_VERIFY_ERRORS:
+                result->verify_errors = (uint32)strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_VERIFY_SECS:
+                result->verify_secs = atof(token);
+                break;
+            case EXT_COL_DATA_PATTERN:
+                snprintf(result->data_pattern, sizeof(result->data_pattern), "%s", token);
+                break;
+            case EXT_COL_DIR_ENTRIES:
+                result->dir_entries = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_META_OPS:
+                ParseMetaOps(token, result);
+                break;
+            case EXT_COL_COMMIT_GROUP:
+                result->commit_group = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_ZONE_MAP:
+                ParseZoneMap(token, result);
+                break;
+            case EXT_COL_SEEK_MAP:
+                ParseSeekMap(token, result);
+                break;
+            case EXT_COL_SEEK_ROTATION_US:
+                result->seek_rotation_us = (float)atof(token);
+                break;
+            case EXT_COL_SEEK_TRACK_US:
+                result->seek_track_us = (float)atof(token);
+                break;
+            case EXT_COL_SEEK_FULL_US:
+                result->seek_full_us = (float)atof(token);
+                break;
+            case EXT_COL_QUEUE_DEPTH:
+                result->queue_depth = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_STRIDE_MAP:
+                ParseStrideMap(token, result);
+                break;
+            case EXT_COL_STRIDE_RANDOM_US:
+                result->stride_random_us = (float)atof(token);
+                break;
+            case EXT_COL_READAHEAD_BYTES:
+                result->readahead_bytes = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_READBEHIND_BYTES:
+                result->readbehind_bytes = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_IO_BUFFER:
+                result->io_buffer = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_BUFFER_MEM:
+                result->buffer_mem = strtoul(token, NULL, 10);
+                break;
+            case EXT_COL_BUFFER_OFFSET:
+                result->buffer_offset = strtoul(token, NULL, 10);
+                break;
+            }
+        }
+        col++;
+    }
+}
+
 BOOL SaveResultToCSV(const char *filename, BenchResult *result)
 {
     LOG_DEBUG("SaveResultToCSV: Attempting to save to '%s'", filename);
-    BPTR file = IDOS->FOpen(filename, MODE_OLDFILE, 0);
+    /* C stdio rather than dos.library, so the host build writes the same file */
+    FILE *file = fopen(filename, "r");
+    BOOL exists = (file != NULL);
+    if (file)
+        fclose(file);
 
-    if (!file) {
+    file = fopen(filename, "a");
+    if (file && !exists) {
         LOG_DEBUG("SaveResultToCSV: Creating new file '%s'", filename);
-        file = IDOS->FOpen(filename, MODE_NEWFILE, 0);
-        if (file) {
-            IDOS->FPuts(file, "ID,DateTime,Type,Volume,FS,MB/"
-                              "s,IOPS,Hardware,Unit,AppVersion,Passes,BlockSize,Trimmed,Min,Max,Duration,TotalBytes,"
-                              "Vendor,Product,Firmware,Serial\n");
-        }
-    } else {
+        fputs(BENCH_CSV_HEADER, file);
+    } else if (file) {
         LOG_DEBUG("SaveResultToCSV: Appending to existing file");
-        IDOS->ChangeFilePosition(file, 0, OFFSET_END);
     }
 
     if (file) {
-        char line[2048];
+        char line[3072];
         char *ptr = line;
         size_t remaining = sizeof(line);
         int written;
@@ -57,29 +427,36 @@ BOOL SaveResultToCSV(const char *filename, BenchResult *result)
 
         // 4. Test Settings (Passes, BlockSize, AveragingMethod)
         const char *avg_method_str = (result->averaging_method == AVERAGE_TRIMMED_MEAN) ? "TrimmedMean" :
-                                     (result->averaging_method == AVERAGE_MEDIAN) ? "Median" : "AllPasses";
+                                     (result->averaging_method == AVERAGE_MEDIAN)   ? "Median" :
+                                     (result->averaging_method == AVERAGE_ADAPTIVE) ? "Adaptive" : "AllPasses";
         APPEND_CSV(",%u,%u,%s", (unsigned int)result->passes, (unsigned int)result->block_size,
                    avg_method_str);
 
         // 5. Detailed Stats (Min, Max, Duration)
-        APPEND_CSV(",%.2f,%.2f,%.2f", result->min_mbps, result->max_mbps, result->total_duration);
+        APPEND_CSV(",%.2f,%.2f,%.6f", result->min_mbps, result->max_mbps, result->total_duration);
 
         // 6. Cumulative Bytes (uint64)
         APPEND_CSV(",%llu", (unsigned long long)result->cumulative_bytes);
 
         // 7. Hardware Details (Vendor, Product, Firmware, Serial)
-        APPEND_CSV(",%s,%s,%s,%s\n", result->vendor, result->product, result->firmware_rev, result->serial_number);
+        APPEND_CSV(",%s,%s,%s,%s", result->vendor, result->product, result->firmware_rev, result->serial_number);
+
+        // 8. Extended Metrics (Latency percentiles, ...)
+        char ext[2048];
+        if (!FormatExtendedCSVFields(result, ext, sizeof(ext)))
+            overflow = TRUE;
+        APPEND_CSV("%s\n", ext);
 
 #undef APPEND_CSV
 
         if (overflow) {
-            LOG_DEBUG("SaveResultToCSV: CSV line buffer overflow (>2048 bytes) for result %s — record skipped",
+            LOG_DEBUG("SaveResultToCSV: CSV line buffer overflow (>3072 bytes) for result %s — record skipped",
                       result->result_id);
             LogUser("WARNING: CSV record too large to save (result %s)", result->result_id);
         } else {
-            IDOS->FPuts(file, line);
+            fputs(line, file);
         }
-        IDOS->FClose(file);
+        fclose(file);
         return !overflow;
     }
 
@@ -88,15 +465,15 @@ BOOL SaveResultToCSV(const char *filename, BenchResult *result)
 
 BOOL GenerateGlobalReport(const char *filename, GlobalReport *report)
 {
-    BPTR file = IDOS->FOpen(filename, MODE_OLDFILE, 0);
+    FILE *file = fopen(filename, "r");
     if (!file)
         return FALSE;
 
     memset(report, 0, sizeof(GlobalReport));
-    char line[2048]; /* Must be large enough to hold a full CSV record (matches SaveResultToCSV buffer) */
+    char line[3072]; /* Must be large enough to hold a full CSV record (matches SaveResultToCSV buffer) */
     BOOL first = TRUE;
 
-    while (IDOS->FGets(file, line, sizeof(line))) {
+    while (fgets(line, sizeof(line), file)) {
         if (first) {
             first = FALSE;
             continue;
@@ -138,7 +515,7 @@ BOOL GenerateGlobalReport(const char *filename, GlobalReport *report)
         }
     }
 
-    IDOS->FClose(file);
+    fclose(file);
 
     /* Finalize averages */
     for (int i = 0; i < TEST_COUNT; i++) {
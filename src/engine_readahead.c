@@ -0,0 +1,129 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Read-ahead detection from strided reads.
+ */
+
+#include "engine_readahead.h"
+#include "engine_internal.h"
+#include <math.h>
+
+#define STRIDE_MIN_CONTRAST 2.0 /* Random reads must cost this many times a prefetched one to tell them apart */
+
+BOOL StrideStatsInit(StrideStats *s, uint32 block_bytes, uint32 max_gap_bytes)
+{
+    memset(s, 0, sizeof(*s));
+    if (block_bytes == 0)
+        return FALSE;
+
+    s->block_bytes = block_bytes;
+    s->gap_bytes[s->levels++] = 0;
+    for (uint32 gap = block_bytes; gap <= max_gap_bytes && s->levels < STRIDE_LEVELS_MAX; gap *= 2)
+        s->gap_bytes[s->levels++] = gap;
+    return (s->levels > 1);
+}
+
+void StrideStatsReset(StrideStats *s)
+{
+    for (uint32 i = 0; i < STRIDE_LEVELS_MAX; i++) {
+        LatencyReset(&s->forward[i]);
+        LatencyReset(&s->backward[i]);
+    }
+    LatencyReset(&s->random);
+}
+
+void StrideStatsMerge(StrideStats *dest, const StrideStats *src)
+{
+    if (dest->levels == 0) {
+        dest->levels = src->levels;
+        dest->block_bytes = src->block_bytes;
+        memcpy(dest->gap_bytes, src->gap_bytes, sizeof(dest->gap_bytes));
+    }
+    for (uint32 i = 0; i < dest->levels && i < src->levels; i++) {
+        LatencyMerge(&dest->forward[i], &src->forward[i]);
+        LatencyMerge(&dest->backward[i], &src->backward[i]);
+    }
+    LatencyMerge(&dest->random, &src->random);
+}
+
+void StrideStatsRecord(StrideStats *s, uint32 level, BOOL backward, uint32 micros)
+{
+    LatencyRecord(backward ? &s->backward[level] : &s->forward[level], micros);
+}
+
+void StrideStatsRecordRandom(StrideStats *s, uint32 micros)
+{
+    LatencyRecord(&s->random, micros);
+}
+
+static float MeanMicros(const LatencyHistogram *h)
+{
+    return h->count ? (float)((double)h->sum_us / h->count) : 0.0f;
+}
+
+/*
+ * With a window of W bytes fetched on each miss, reads a step of s bytes
+ * apart hit the window a share h = 1 - s/W of the time, and their mean
+ * latency sits that far from the random level towards the prefetched one.
+ * The level with h nearest one half gives W = s / (1 - h). A curve that
+ * jumps straight from hits to misses bounds W by the first step it misses.
+ */
+static uint32 InferWindow(const StrideStats *s, const float *mean_us, float hit_us, float miss_us, BOOL *at_least)
+{
+    int32 best = -1;
+    float best_share = 0.0f;
+    int32 first_miss = -1;
+    *at_least = FALSE;
+
+    for (uint32 i = 0; i < s->levels; i++) {
+        float share = (miss_us - mean_us[i]) / (miss_us - hit_us);
+        if (share < 0.5f && first_miss < 0)
+            first_miss = (int32)i;
+        if (share > 0.1f && share < 0.9f && (best < 0 || fabsf(share - 0.5f) < fabsf(best_share - 0.5f))) {
+            best = (int32)i;
+            best_share = share;
+        }
+    }
+
+    if (best >= 0)
+        return (uint32)((s->block_bytes + s->gap_bytes[best]) / (1.0f - best_share));
+    if (first_miss == 0)
+        return 0;
+    if (first_miss > 0)
+        return s->block_bytes + s->gap_bytes[first_miss];
+    *at_least = TRUE; /* Still prefetched at the widest gap */
+    return s->block_bytes + s->gap_bytes[s->levels - 1];
+}
+
+void StrideStatsToResult(const StrideStats *s, BenchResult *out)
+{
+    out->stride_levels = s->levels;
+    for (uint32 i = 0; i < s->levels; i++) {
+        out->stride_gap_bytes[i] = s->gap_bytes[i];
+        out->stride_fwd_us[i] = MeanMicros(&s->forward[i]);
+        out->stride_back_us[i] = MeanMicros(&s->backward[i]);
+    }
+    out->stride_random_us = MeanMicros(&s->random);
+    out->readahead_bytes = 0;
+    out->readbehind_bytes = 0;
+    if (s->levels < 2 || s->forward[0].count == 0 || s->random.count == 0)
+        return;
+
+    /* The fastest sequential reads are the prefetched ones; random reads are never prefetched */
+    float hit_us = LatencyPercentile(&s->forward[0], 5.0f);
+    float miss_us = out->stride_random_us;
+    if (miss_us < hit_us * STRIDE_MIN_CONTRAST) {
+        LogUser("Read-Ahead: random reads (%.0f us) cost about as much as sequential ones (%.0f us) - the data "
+                "is cached or the medium has no access penalty, so no window can be inferred",
+                miss_us, hit_us);
+        return;
+    }
+
+    BOOL ahead_min, behind_min;
+    out->readahead_bytes = InferWindow(s, out->stride_fwd_us, hit_us, miss_us, &ahead_min);
+    out->readbehind_bytes = InferWindow(s, out->stride_back_us, hit_us, miss_us, &behind_min);
+    LogUser("Read-Ahead: %s%u KB ahead, %s%u KB behind (prefetched %.0f us, uncached %.0f us)",
+            ahead_min ? "at least " : "", (unsigned int)(out->readahead_bytes / 1024), behind_min ? "at least " : "",
+            (unsigned int)(out->readbehind_bytes / 1024), hit_us, miss_us);
+}
@@ -0,0 +1,252 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Intra-pass throughput sampling into BenchSampleData.
+ */
+
+#include "engine_sampler.h"
+#include "engine_internal.h"
+#include "engine_trace.h"
+#include <math.h>
+
+/*
+ * Halves the number of stored samples by averaging adjacent pairs.
+ * Each pair covers two equal-length intervals, so the mean of the two rates
+ * is the true rate over the combined interval.
+ */
+static void DecimateSamples(BenchSampler *s)
+{
+    BenchSampleData *sd = s->out;
+    uint32 half = sd->sample_count / 2;
+
+    for (uint32 i = 0; i < half; i++) {
+        BenchSample *a = &sd->samples[i * 2];
+        BenchSample *b = &sd->samples[i * 2 + 1];
+        sd->samples[i].time_offset = b->time_offset;
+        sd->samples[i].value = (a->value + b->value) * 0.5f;
+    }
+    /* An odd trailing sample is carried over unchanged */
+    if (sd->sample_count & 1) {
+        sd->samples[half] = sd->samples[sd->sample_count - 1];
+        half++;
+    }
+    sd->sample_count = half;
+    s->interval_us *= 2;
+
+    LOG_DEBUG("Sampler: buffer full, decimated to %u samples, interval now %u ms", (unsigned int)half,
+              (unsigned int)(s->interval_us / 1000));
+}
+
+void SamplerAddPoint(BenchSampler *s, float time_offset, float value)
+{
+    if (!s || !s->out)
+        return;
+
+    if (s->out->sample_count >= MAX_SAMPLES)
+        DecimateSamples(s);
+
+    s->out->samples[s->out->sample_count].time_offset = time_offset;
+    s->out->samples[s->out->sample_count].value = value;
+    s->out->sample_count++;
+}
+
+/* Open the measurement window at 'now', discarding everything before it as ramp-up */
+static void StartMeasuring(BenchSampler *s, BenchTicks now)
+{
+    s->steady = TRUE;
+    s->measure_start = now;
+    s->measure_bytes = 0;
+    s->measure_ops = 0;
+    s->rampup_secs = TimerSeconds(s->pass_start, now);
+}
+
+/* Feed one interval rate to the sliding window and test it for steady state */
+static void CheckSteadyState(BenchSampler *s, float rate, BenchTicks now)
+{
+    if (s->steady)
+        return;
+
+    if (s->window_count < SAMPLER_STEADY_WINDOW) {
+        s->window[s->window_count++] = rate;
+    } else {
+        memmove(&s->window[0], &s->window[1], sizeof(float) * (SAMPLER_STEADY_WINDOW - 1));
+        s->window[SAMPLER_STEADY_WINDOW - 1] = rate;
+    }
+    if (s->window_count < SAMPLER_STEADY_WINDOW)
+        return;
+
+    float sum = 0.0f;
+    for (uint32 i = 0; i < SAMPLER_STEADY_WINDOW; i++)
+        sum += s->window[i];
+    float mean = sum / SAMPLER_STEADY_WINDOW;
+    if (mean <= 0.0f)
+        return;
+
+    float var = 0.0f;
+    for (uint32 i = 0; i < SAMPLER_STEADY_WINDOW; i++)
+        var += (s->window[i] - mean) * (s->window[i] - mean);
+    float cv = sqrtf(var / SAMPLER_STEADY_WINDOW) / mean;
+
+    /* A slow ramp can have a low CV, so also require the two halves of the window to agree */
+    float first = 0.0f;
+    for (uint32 i = 0; i < SAMPLER_STEADY_WINDOW / 2; i++)
+        first += s->window[i];
+    float second = sum - first;
+    float drift = fabsf(second - first) / (0.5f * sum);
+
+    if (cv <= SAMPLER_STEADY_CV && drift <= SAMPLER_STEADY_DRIFT) {
+        StartMeasuring(s, now);
+        LOG_DEBUG("Sampler: steady state after %.2f s (window CV %.3f, drift %.3f)", s->rampup_secs, cv, drift);
+    }
+}
+
+/* Emit one point for the work done between interval_start and now */
+static void EmitInterval(BenchSampler *s, BenchTicks now)
+{
+    double secs = TimerSeconds(s->interval_start, now);
+    if (secs <= 0.0)
+        return;
+
+    float value = s->use_ops ? (float)s->interval_ops / secs
+                             : ((float)s->interval_bytes / (1024.0f * 1024.0f)) / secs;
+    float offset = s->time_base + (float)TimerSeconds(s->pass_start, now);
+
+    SamplerAddPoint(s, offset, value);
+    if (s->duration_us > 0)
+        CheckSteadyState(s, value, now);
+
+    s->interval_start = now;
+    s->interval_bytes = 0;
+    s->interval_ops = 0;
+}
+
+void SamplerInit(BenchSampler *s, BenchSampleData *out, BOOL use_ops)
+{
+    memset(s, 0, sizeof(BenchSampler));
+    s->out = out;
+    s->use_ops = use_ops;
+    s->interval_us = SAMPLER_INTERVAL_US;
+    if (out)
+        out->sample_count = 0;
+}
+
+void SamplerSetDuration(BenchSampler *s, uint32 duration_secs)
+{
+    s->duration_us = (duration_secs > 4000) ? 4000000000U : duration_secs * 1000000U;
+}
+
+void SamplerBeginPass(BenchSampler *s, float time_base)
+{
+    if (!s)
+        return;
+    s->time_base = time_base;
+    s->pass_bytes = 0;
+    s->pass_ops = 0;
+    s->expired = FALSE;
+    s->steady = FALSE;
+    s->window_count = 0;
+    s->measure_bytes = 0;
+    s->measure_ops = 0;
+    s->measure_secs = 0.0;
+    s->rampup_secs = 0.0;
+    s->interval_bytes = 0;
+    s->interval_ops = 0;
+    s->unchecked_bytes = 0;
+    s->unchecked_ops = 0;
+    s->pass_start = TimerNow();
+    s->interval_start = s->pass_start;
+}
+
+void SamplerUpdate(BenchSampler *s, uint32 bytes, uint32 ops)
+{
+    if (!s)
+        return;
+
+    s->pass_bytes += bytes;
+    s->pass_ops += ops;
+    s->measure_bytes += bytes;
+    s->measure_ops += ops;
+    s->interval_bytes += bytes;
+    s->interval_ops += ops;
+    s->unchecked_bytes += bytes;
+    s->unchecked_ops += ops;
+
+    /* Only touch the timer once enough work has accumulated */
+    if (s->unchecked_bytes < SAMPLER_CHECK_BYTES && s->unchecked_ops < SAMPLER_CHECK_OPS)
+        return;
+    s->unchecked_bytes = 0;
+    s->unchecked_ops = 0;
+
+    BenchTicks now = TimerNow();
+    if (TimerMicros(s->interval_start, now) >= s->interval_us)
+        EmitInterval(s, now);
+
+    if (s->duration_us > 0) {
+        uint32 elapsed_us = TimerMicros(s->pass_start, now);
+        /* A device that never settles is measured over the second half of the pass */
+        if (!s->steady && elapsed_us >= s->duration_us / 2) {
+            StartMeasuring(s, now);
+            LOG_DEBUG("Sampler: no steady state, measuring from %.2f s", s->rampup_secs);
+        }
+        if (elapsed_us >= s->duration_us)
+            s->expired = TRUE;
+    }
+}
+
+void SamplerTraceIO(BenchSampler *s, uint8 op, uint64 offset, uint32 length)
+{
+    if (!s || !s->recorder)
+        return;
+
+    TraceRecorderAdd(s->recorder, op, offset, length, GetMicroTimestamp());
+}
+
+void SamplerExclude(BenchSampler *s, BenchTicks ticks)
+{
+    if (!s)
+        return;
+
+    /* Moving the start points forward takes the time out of every open interval and window */
+    s->pass_start += ticks;
+    s->interval_start += ticks;
+    s->measure_start += ticks;
+}
+
+void SamplerEndPass(BenchSampler *s)
+{
+    if (!s)
+        return;
+
+    BenchTicks now = TimerNow();
+    if (s->interval_bytes > 0 || s->interval_ops > 0)
+        EmitInterval(s, now);
+
+    if (s->duration_us > 0) {
+        /* Pass ended before the window opened (e.g. an I/O error): measure all of it */
+        if (!s->steady) {
+            s->measure_start = s->pass_start;
+            s->measure_bytes = s->pass_bytes;
+            s->measure_ops = s->pass_ops;
+            s->rampup_secs = 0.0;
+        }
+        s->measure_secs = TimerSeconds(s->measure_start, now);
+    }
+}
+
+BOOL SamplerKeepRunning(const BenchSampler *s, uint64 done, uint64 planned)
+{
+    if (s && s->duration_us > 0)
+        return !s->expired;
+    return (done < planned);
+}
+
+BOOL SamplerExpired(const BenchSampler *s)
+{
+    return (s && s->expired);
+}
+
+BOOL SamplerTimed(const BenchSampler *s)
+{
+    return (s && s->duration_us > 0);
+}
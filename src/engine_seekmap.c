@@ -0,0 +1,109 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Read latency against seek distance on a raw device.
+ */
+
+#include "engine_seekmap.h"
+#include "engine_internal.h"
+#include <stdlib.h>
+
+#define SEEK_MIN_SAMPLES 8       /* Fewer reads than this at a level say nothing about its spread */
+#define SEEK_MIN_REVOLUTION 1000 /* us; a faster "revolution" (over 60000 RPM) is noise, not a platter */
+
+BOOL SeekStatsInit(SeekStats *s, uint64 capacity_bytes, uint32 io_bytes)
+{
+    memset(s, 0, sizeof(*s));
+    if (io_bytes == 0 || capacity_bytes < (uint64)io_bytes * 4)
+        return FALSE;
+
+    uint64 full = (capacity_bytes - io_bytes) / io_bytes * io_bytes; /* First block to last */
+    for (uint64 d = io_bytes; d < full && s->levels < SEEK_PROFILE_MAX - 1; d *= 2)
+        s->distance[s->levels++] = d;
+    s->distance[s->levels++] = full;
+    return TRUE;
+}
+
+void SeekStatsReset(SeekStats *s)
+{
+    for (uint32 i = 0; i < SEEK_PROFILE_MAX; i++)
+        LatencyReset(&s->latency[i]);
+}
+
+void SeekStatsMerge(SeekStats *dest, const SeekStats *src)
+{
+    if (dest->levels == 0) {
+        dest->levels = src->levels;
+        memcpy(dest->distance, src->distance, sizeof(dest->distance));
+    }
+    for (uint32 i = 0; i < dest->levels && i < src->levels; i++)
+        LatencyMerge(&dest->latency[i], &src->latency[i]);
+}
+
+void SeekStatsRecord(SeekStats *s, uint32 level, uint32 micros)
+{
+    LatencyRecord(&s->latency[level], micros);
+}
+
+static int CompareFloat(const void *a, const void *b)
+{
+    float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+void SeekStatsToResult(const SeekStats *s, BenchResult *out)
+{
+    out->seek_levels = s->levels;
+    out->seek_rotation_us = 0.0f;
+    out->seek_track_us = 0.0f;
+    out->seek_full_us = 0.0f;
+    for (uint32 i = 0; i < s->levels; i++) {
+        const LatencyHistogram *h = &s->latency[i];
+        out->seek_dist_bytes[i] = s->distance[i];
+        out->seek_us[i] = h->count ? (float)((double)h->sum_us / h->count) : 0.0f;
+    }
+    if (s->levels < 2 || s->latency[0].count == 0)
+        return;
+
+    /*
+     * Beyond a track the sector can be anywhere under the head, so the
+     * rotational wait is spread evenly over one revolution: the middle 90%
+     * of a level spans 0.9 of it. The median over all such levels rides out
+     * the odd level disturbed by a recalibration or a remapped sector.
+     */
+    float spreads[SEEK_PROFILE_MAX];
+    uint32 num_spreads = 0;
+    int32 track_level = -1;
+    for (uint32 i = 0; i < s->levels; i++) {
+        const LatencyHistogram *h = &s->latency[i];
+        if (s->distance[i] < SEEK_TRACK_DISTANCE || h->count < SEEK_MIN_SAMPLES)
+            continue;
+        if (track_level < 0)
+            track_level = (int32)i;
+        spreads[num_spreads++] = (LatencyPercentile(h, 95.0f) - LatencyPercentile(h, 5.0f)) / 0.9f;
+    }
+    if (track_level < 0)
+        return; /* Device too small to leave the first track */
+
+    qsort(spreads, num_spreads, sizeof(float), CompareFloat);
+    float revolution = spreads[num_spreads / 2];
+    if (revolution >= SEEK_MIN_REVOLUTION)
+        out->seek_rotation_us = revolution / 2.0f;
+
+    /* Adjacent reads cost only the command and the transfer; take that off both seek estimates */
+    float base = LatencyPercentile(&s->latency[0], 5.0f);
+    float track = LatencyPercentile(&s->latency[track_level], 5.0f) - base;
+    float full = out->seek_us[s->levels - 1] - out->seek_rotation_us - base;
+    out->seek_track_us = (track > 0.0f) ? track : 0.0f;
+    out->seek_full_us = (full > 0.0f) ? full : 0.0f;
+
+    if (out->seek_rotation_us > 0.0f)
+        LogUser("Seek Profile: revolution %.0f us (~%.0f RPM), rotational latency %.0f us, track-to-track %.0f us, "
+                "full stroke %.0f us",
+                revolution, 60.0e6f / revolution, out->seek_rotation_us, out->seek_track_us, out->seek_full_us);
+    else
+        LogUser("Seek Profile: no rotational delay seen (solid-state or cached device); track-to-track %.0f us, "
+                "full stroke %.0f us",
+                out->seek_track_us, out->seek_full_us);
+}
@@ -0,0 +1,323 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Concurrent streams: N child processes each running their own workload instance.
+ */
+
+#include "engine_streams.h"
+#include "engine_internal.h"
+
+typedef enum
+{
+    STREAM_CMD_SETUP = 0,
+    STREAM_CMD_RUN,
+    STREAM_CMD_QUIT
+} StreamCmd;
+
+/* Per-stream state, shared between the engine and the stream process. The
+ * message is the command channel: the stream only touches the rest of the
+ * structure between receiving the message and replying to it. */
+typedef struct StreamCtx
+{
+    PlatMsg msg;
+    uint32 cmd; /* StreamCmd */
+    const BenchWorkload *workload;
+    const BenchOptions *opts;
+    uint32 block_size;
+    char dir[MAX_PATH_LEN];      /* Stream directory, removed at teardown */
+    char path[MAX_PATH_LEN + 1]; /* dir plus '/', handed to the workload as its target */
+    PlatPort *port;              /* The stream process's own port */
+    void *workload_data;
+    BenchSampler sampler;        /* Per-stream deadline and steady-state window (no sample buffer) */
+
+    /* Result of the last command */
+    BOOL ok;
+    uint64 bytes;
+    uint32 ops;
+    double secs;
+    double rampup_secs;
+    double verify_secs; /* Verify mode: stamping and checking, already left out of secs */
+} StreamCtx;
+
+uint32 GetStreamLevels(uint32 max_streams, uint32 *levels, uint32 max_levels)
+{
+    if (max_streams > STREAMS_MAX)
+        max_streams = STREAMS_MAX;
+
+    uint32 count = 0;
+    for (uint32 n = 1; n < max_streams && count + 1 < max_levels; n *= 2)
+        levels[count++] = n;
+    if (count < max_levels)
+        levels[count++] = max_streams;
+    return count;
+}
+
+static void StreamProcess(void)
+{
+    PlatPort *port = PlatOwnPort();
+    BOOL running = TRUE;
+
+    while (running) {
+        StreamCtx *ctx = (StreamCtx *)PlatWaitMsg(port);
+        const BenchWorkload *w = ctx->workload;
+
+        switch (ctx->cmd) {
+        case STREAM_CMD_SETUP:
+            ctx->ok = w->Setup(ctx->path, ctx->block_size, ctx->opts, &ctx->workload_data);
+            if (!ctx->ok)
+                ctx->workload_data = NULL;
+            SamplerInit(&ctx->sampler, NULL, (w->type == TEST_PROFILER || w->type == TEST_DIR_SCALING));
+            if (ctx->ok && w->SetSampler) {
+                w->SetSampler(ctx->workload_data, &ctx->sampler);
+                if (ctx->opts->duration_secs > 0)
+                    SamplerSetDuration(&ctx->sampler, ctx->opts->duration_secs);
+            }
+            break;
+
+        case STREAM_CMD_RUN: {
+            ctx->bytes = 0;
+            ctx->ops = 0;
+            SamplerBeginPass(&ctx->sampler, 0.0f);
+            BenchTicks start = TimerNow();
+            ctx->ok = w->Run(ctx->workload_data, &ctx->bytes, &ctx->ops);
+            BenchTicks end = TimerNow();
+            SamplerEndPass(&ctx->sampler);
+            ctx->verify_secs = w->GetVerify ? VerifySeconds(w->GetVerify(ctx->workload_data)) : 0.0;
+            ctx->secs = TimerSeconds(start, end) - ctx->verify_secs;
+            ctx->rampup_secs = 0.0;
+            if (SamplerTimed(&ctx->sampler)) {
+                ctx->bytes = ctx->sampler.measure_bytes;
+                ctx->ops = ctx->sampler.measure_ops;
+                ctx->secs = ctx->sampler.measure_secs;
+                ctx->rampup_secs = ctx->sampler.rampup_secs;
+            }
+            break;
+        }
+
+        case STREAM_CMD_QUIT:
+        default:
+            if (ctx->workload_data)
+                w->Cleanup(ctx->workload_data);
+            ctx->workload_data = NULL;
+            running = FALSE;
+            break;
+        }
+
+        /* ctx belongs to the engine again once replied */
+        PlatReplyMsg(&ctx->msg);
+    }
+}
+
+/* Post the same command to every running stream, back-to-back */
+static void PostAll(StreamGroup *g, uint32 cmd)
+{
+    for (uint32 i = 0; i < g->started; i++)
+        g->streams[i].cmd = cmd;
+    for (uint32 i = 0; i < g->started; i++)
+        PlatPutMsg(g->streams[i].port, &g->streams[i].msg);
+}
+
+/* Block until every running stream has replied */
+static void WaitAll(StreamGroup *g)
+{
+    for (uint32 replies = 0; replies < g->started; replies++)
+        PlatWaitMsg(g->reply_port);
+}
+
+StreamGroup *StreamsStart(const BenchWorkload *workload, const char *target_path, uint32 block_size,
+                          const BenchOptions *opts, uint32 count)
+{
+    StreamGroup *g = PlatAllocClear(sizeof(StreamGroup));
+    if (!g)
+        return NULL;
+
+    g->workload = workload;
+    g->count = count;
+    g->streams = PlatAllocClear(sizeof(StreamCtx) * count);
+    g->reply_port = PlatCreatePort();
+    if (!g->streams || !g->reply_port) {
+        StreamsStop(g);
+        return NULL;
+    }
+
+    /* Workloads append their file names directly to the target path */
+    size_t len = strlen(target_path);
+    const char *sep = (len > 0 && (target_path[len - 1] == ':' || target_path[len - 1] == '/')) ? "" : "/";
+
+    for (uint32 i = 0; i < count; i++) {
+        StreamCtx *ctx = &g->streams[i];
+        snprintf(ctx->dir, sizeof(ctx->dir), "%s%s%s%u", target_path, sep, STREAMS_DIR_NAME, (unsigned int)(i + 1));
+        snprintf(ctx->path, sizeof(ctx->path), "%s/", ctx->dir);
+
+        /* The directory may be left over from an interrupted run */
+        if (!PlatCreateDir(ctx->dir)) {
+            LogUser("ERROR: Streams: cannot create directory %s", ctx->dir);
+            break;
+        }
+
+        char name[32];
+        snprintf(name, sizeof(name), "AmigaDiskBench_Stream%u", (unsigned int)(i + 1));
+        PlatPort *port = PlatStartProcess(name, StreamProcess, STREAMS_STACK_SIZE);
+        if (!port) {
+            LogUser("ERROR: Streams: cannot start process for stream %u", (unsigned int)(i + 1));
+            PlatDelete(ctx->dir);
+            break;
+        }
+
+        PlatInitMsg(&ctx->msg, g->reply_port, sizeof(StreamCtx));
+        ctx->workload = workload;
+        ctx->opts = opts;
+        ctx->block_size = block_size;
+        ctx->port = port;
+        g->started++;
+    }
+
+    /* Every stream sets up concurrently; the group is only usable if all of them succeeded */
+    BOOL ok = (g->started == count);
+    if (ok) {
+        PostAll(g, STREAM_CMD_SETUP);
+        WaitAll(g);
+        for (uint32 i = 0; i < g->started; i++) {
+            if (!g->streams[i].ok) {
+                LogUser("ERROR: Streams: %s setup failed in %s", workload->name, g->streams[i].path);
+                ok = FALSE;
+            }
+        }
+    }
+
+    if (!ok) {
+        StreamsStop(g);
+        return NULL;
+    }
+    LOG_DEBUG("Streams: %u x '%s' ready", (unsigned int)count, workload->name);
+    return g;
+}
+
+BOOL StreamsRunPass(StreamGroup *g, uint64 *bytes, uint32 *ops)
+{
+    /* Per-pass preparation happens before the barrier, so it is not timed */
+    if (g->workload->PreparePass) {
+        for (uint32 i = 0; i < g->count; i++)
+            g->workload->PreparePass(g->streams[i].workload_data);
+    }
+
+    BenchTicks start = TimerNow();
+    PostAll(g, STREAM_CMD_RUN);
+    WaitAll(g);
+    BenchTicks end = TimerNow();
+
+    BOOL ok = TRUE;
+    uint64 total_bytes = 0;
+    uint32 total_ops = 0;
+    double sum_rate = 0.0;
+    double sum_op_rate = 0.0; /* Workloads that move no data (Directory Scaling) are timed on their ops */
+    double rampup = 0.0;
+    double verify = 0.0;
+    uint64 slowest_bytes = 0;
+    BOOL any = FALSE;
+    g->slowest_mbps = 0.0f;
+
+    for (uint32 i = 0; i < g->count; i++) {
+        StreamCtx *ctx = &g->streams[i];
+        if (!ctx->ok || ctx->secs <= 0.0) {
+            ok = FALSE;
+            continue;
+        }
+        if (!any || ctx->bytes < slowest_bytes)
+            slowest_bytes = ctx->bytes;
+        any = TRUE;
+        sum_rate += (double)ctx->bytes / ctx->secs;
+        sum_op_rate += (double)ctx->ops / ctx->secs;
+        total_bytes += ctx->bytes;
+        total_ops += ctx->ops;
+        rampup += ctx->rampup_secs;
+        if (ctx->verify_secs > verify)
+            verify = ctx->verify_secs;
+    }
+
+    /* Fixed work: the pass lasts until the slowest stream finishes. Time-bounded: the streams'
+     * measurement windows differ, so the aggregate is the sum of their steady-state rates. */
+    if (g->streams[0].sampler.duration_us > 0 && sum_rate > 0.0)
+        g->pass_secs = (double)total_bytes / sum_rate;
+    else if (g->streams[0].sampler.duration_us > 0)
+        g->pass_secs = (sum_op_rate > 0.0) ? (double)total_ops / sum_op_rate : 0.0;
+    else
+        g->pass_secs = TimerSeconds(start, end) - verify; /* The slowest stream's verify time at most */
+    g->rampup_secs = rampup / (double)g->count;
+
+    /* On the aggregate's time base, so the slowest stream is never above the per-stream mean */
+    if (any && g->pass_secs > 0.0)
+        g->slowest_mbps = (float)(((double)slowest_bytes / (1024.0 * 1024.0)) / g->pass_secs);
+
+    *bytes = total_bytes;
+    *ops = total_ops;
+    return ok;
+}
+
+void StreamsMergeLatency(StreamGroup *g, LatencyHistogram *dest)
+{
+    if (!g->workload->GetLatency)
+        return;
+    for (uint32 i = 0; i < g->count; i++)
+        LatencyMerge(dest, g->workload->GetLatency(g->streams[i].workload_data));
+}
+
+void StreamsMergeVerify(StreamGroup *g, VerifyState *dest)
+{
+    if (!g->workload->GetVerify)
+        return;
+    for (uint32 i = 0; i < g->count; i++)
+        VerifyMerge(dest, g->workload->GetVerify(g->streams[i].workload_data));
+}
+
+void StreamsMergeMetaOps(StreamGroup *g, MetaOpStats *dest)
+{
+    if (!g->workload->GetMetaOps)
+        return;
+    for (uint32 i = 0; i < g->count; i++)
+        MetaOpsMerge(dest, g->workload->GetMetaOps(g->streams[i].workload_data));
+}
+
+void StreamsMergeZones(StreamGroup *g, ZoneStats *dest)
+{
+    if (!g->workload->GetZones)
+        return;
+    for (uint32 i = 0; i < g->count; i++)
+        ZoneStatsMerge(dest, g->workload->GetZones(g->streams[i].workload_data));
+}
+
+void StreamsMergeSeeks(StreamGroup *g, SeekStats *dest)
+{
+    if (!g->workload->GetSeeks)
+        return;
+    for (uint32 i = 0; i < g->count; i++)
+        SeekStatsMerge(dest, g->workload->GetSeeks(g->streams[i].workload_data));
+}
+
+void StreamsMergeStrides(StreamGroup *g, StrideStats *dest)
+{
+    if (!g->workload->GetStrides)
+        return;
+    for (uint32 i = 0; i < g->count; i++)
+        StrideStatsMerge(dest, g->workload->GetStrides(g->streams[i].workload_data));
+}
+
+void StreamsStop(StreamGroup *g)
+{
+    if (!g)
+        return;
+
+    if (g->streams && g->started > 0) {
+        PostAll(g, STREAM_CMD_QUIT);
+        WaitAll(g);
+        for (uint32 i = 0; i < g->started; i++)
+            PlatDelete(g->streams[i].dir);
+    }
+
+    if (g->reply_port)
+        PlatDeletePort(g->reply_port);
+    if (g->streams)
+        PlatFree(g->streams);
+    PlatFree(g);
+}
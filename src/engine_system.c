@@ -12,8 +12,7 @@ BOOL FlushDiskCache(const char *path)
 
     LOG_DEBUG("Flushing volume cache for %s...", path);
 
-    /* Modern OS4 approach (dos.library 53.58+) */
-    if (IDOS->FlushVolume(path)) {
+    if (PlatFlushVolume(path)) {
         LOG_DEBUG("FlushVolume() succeeded.");
         return TRUE;
     }
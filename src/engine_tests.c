@@ -4,40 +4,52 @@
  */
 
 #include "engine_internal.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
 #include <stdlib.h>
 
 /*
  * Writes a dummy file of the specified size using the given chunk size.
  * Returns the number of bytes actually written, or 0 on failure.
  */
-uint32 WriteDummyFile(const char *path, uint32 size, uint32 chunk_size)
+uint64 WriteDummyFile(const char *path, uint64 size, uint32 chunk_size, struct BenchSampler *sampler,
+                      DataPattern *pattern, VerifyState *verify)
 {
-    BPTR file = IDOS->Open(path, MODE_NEWFILE);
+    PlatFile file = PlatOpen(path, PLAT_OPEN_NEW);
     if (!file)
         return 0;
 
-    uint8 *buffer = IExec->AllocVecTags(chunk_size, AVT_Type, MEMF_SHARED, TAG_DONE);
-    if (!buffer) {
-        IDOS->Close(file);
-        return 0;
+    uint8 *buffer = NULL;
+    if (!pattern) {
+        buffer = PlatAlloc(chunk_size);
+        if (!buffer) {
+            PlatClose(file);
+            return 0;
+        }
+        /* Fill with non-zero data to avoid sparse file optimizations if any */
+        memset(buffer, FIXTURE_FILL_BYTE, chunk_size);
     }
 
-    /* Fill with non-zero data to avoid sparse file optimizations if any */
-    memset(buffer, 0xAA, chunk_size);
-
-    uint32 written = 0;
-    while (written < size) {
-        uint32 to_write = size - written;
-        if (to_write > chunk_size)
-            to_write = chunk_size;
-
-        if (IDOS->Write(file, buffer, to_write) != (int32)to_write)
+    uint64 written = 0;
+    /* A time-bounded pass may end mid-file; the caller deletes the partial file */
+    while (written < size && !SamplerExpired(sampler)) {
+        uint32 to_write = chunk_size;
+        if (size - written < to_write)
+            to_write = (uint32)(size - written);
+
+        uint8 *data = pattern ? DataPatternNext(pattern, to_write) : buffer;
+        if (verify && verify->enabled)
+            VerifyStamp(verify, sampler, data, to_write, written);
+        SamplerTraceIO(sampler, TRACE_OP_WRITE, written, to_write);
+        if (PlatWrite(file, data, to_write) != (int32)to_write)
             break;
         written += to_write;
+        SamplerUpdate(sampler, to_write, 1);
     }
 
-    IExec->FreeVec(buffer);
-    IDOS->Close(file);
+    if (buffer)
+        PlatFree(buffer);
+    PlatClose(file);
     return written;
 }
 
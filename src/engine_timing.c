@@ -0,0 +1,99 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Benchmark clock and its overhead calibration.
+ */
+
+#include "engine_timing.h"
+#include "engine_internal.h"
+#include <stdlib.h>
+
+static TimingCalibration calibration = {1000000, 0.0, 0.0, 0};
+
+static int CompareTicks(const void *a, const void *b)
+{
+    BenchTicks ta = *(const BenchTicks *)a;
+    BenchTicks tb = *(const BenchTicks *)b;
+    return (ta > tb) - (ta < tb);
+}
+
+/* Kept out of line so the calibration loop looks like a workload's call into the I/O layer */
+static void __attribute__((noinline)) EmptyOp(volatile uint32 *sink)
+{
+    (*sink)++;
+}
+
+void TimingInit(void)
+{
+    uint64 freq = PlatTickFrequency();
+    calibration.frequency = freq ? freq : 1;
+
+    /* Read cost: a long run of reads, so the two reads bracketing it hardly count */
+    BenchTicks start = TimerNow();
+    for (uint32 i = 0; i < TIMING_CALIBRATE_READS; i++)
+        (void)TimerNow();
+    BenchTicks end = TimerNow();
+    calibration.read_ns = (double)TimerNanos(start, end) / TIMING_CALIBRATE_READS;
+
+    /* Empty op: the median resists the odd interrupt landing inside a region */
+    BenchTicks *samples = PlatAlloc(sizeof(BenchTicks) * TIMING_CALIBRATE_OPS);
+    if (samples) {
+        volatile uint32 sink = 0;
+        for (uint32 i = 0; i < TIMING_CALIBRATE_OPS; i++) {
+            BenchTicks op_start = TimerNow();
+            EmptyOp(&sink);
+            BenchTicks op_end = TimerNow();
+            samples[i] = (op_end > op_start) ? op_end - op_start : 0;
+        }
+        qsort(samples, TIMING_CALIBRATE_OPS, sizeof(BenchTicks), CompareTicks);
+        calibration.empty_op_ticks = samples[TIMING_CALIBRATE_OPS / 2];
+        calibration.empty_op_ns = (double)calibration.empty_op_ticks * 1e9 / (double)calibration.frequency;
+        PlatFree(samples);
+    }
+
+    LOG_DEBUG("Timing: clock %llu Hz (%.1f ns/tick), read %.1f ns, empty op %.1f ns",
+              (unsigned long long)calibration.frequency, 1e9 / (double)calibration.frequency, calibration.read_ns,
+              calibration.empty_op_ns);
+}
+
+const TimingCalibration *GetTimingCalibration(void)
+{
+    return &calibration;
+}
+
+double TimerSeconds(BenchTicks start, BenchTicks end)
+{
+    if (end <= start)
+        return 0.0;
+    return (double)(end - start) / (double)calibration.frequency;
+}
+
+uint64 TimerNanos(BenchTicks start, BenchTicks end)
+{
+    if (end <= start)
+        return 0;
+    uint64 ticks = end - start;
+    /* Split to keep ticks * 1e9 from overflowing on long spans */
+    uint64 secs = ticks / calibration.frequency;
+    uint64 rem = ticks % calibration.frequency;
+    return secs * 1000000000ULL + rem * 1000000000ULL / calibration.frequency;
+}
+
+uint32 TimerMicros(BenchTicks start, BenchTicks end)
+{
+    uint64 micros = TimerNanos(start, end) / 1000;
+    return (micros > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32)micros;
+}
+
+uint32 TimerOpMicros(BenchTicks start, BenchTicks end)
+{
+    if (end <= start + calibration.empty_op_ticks)
+        return 0;
+    return TimerMicros(start + calibration.empty_op_ticks, end);
+}
+
+uint64 GetMicroTimestamp(void)
+{
+    return TimerNanos(0, TimerNow()) / 1000;
+}
@@ -0,0 +1,276 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * I/O trace format, recorder and replay scheduler.
+ */
+
+#include "engine_trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Big-endian field access, independent of host byte order */
+static uint32 GetBE16(const uint8 *p)
+{
+    return ((uint32)p[0] << 8) | p[1];
+}
+
+static uint32 GetBE32(const uint8 *p)
+{
+    return ((uint32)p[0] << 24) | ((uint32)p[1] << 16) | ((uint32)p[2] << 8) | p[3];
+}
+
+static uint64 GetBE64(const uint8 *p)
+{
+    return ((uint64)GetBE32(p) << 32) | GetBE32(p + 4);
+}
+
+static void PutBE16(uint8 *p, uint32 v)
+{
+    p[0] = (uint8)(v >> 8);
+    p[1] = (uint8)v;
+}
+
+static void PutBE32(uint8 *p, uint32 v)
+{
+    p[0] = (uint8)(v >> 24);
+    p[1] = (uint8)(v >> 16);
+    p[2] = (uint8)(v >> 8);
+    p[3] = (uint8)v;
+}
+
+static void PutBE64(uint8 *p, uint64 v)
+{
+    PutBE32(p, (uint32)(v >> 32));
+    PutBE32(p + 4, (uint32)v);
+}
+
+static void SetError(char *err, uint32 err_size, const char *msg)
+{
+    if (err && err_size > 0)
+        snprintf(err, err_size, "%s", msg);
+}
+
+BOOL TraceAlloc(TraceData *t, uint32 capacity)
+{
+    memset(t, 0, sizeof(TraceData));
+    if (capacity == 0 || capacity > TRACE_MAX_RECORDS)
+        return FALSE;
+
+    t->records = malloc(sizeof(TraceRecord) * capacity);
+    if (!t->records)
+        return FALSE;
+    t->capacity = capacity;
+    return TRUE;
+}
+
+BOOL TraceAppend(TraceData *t, uint8 op, uint64 offset, uint32 length, uint32 think_us)
+{
+    if (t->count >= t->capacity || op >= TRACE_OP_COUNT)
+        return FALSE;
+
+    if (op == TRACE_OP_FLUSH) {
+        offset = 0;
+        length = 0;
+    } else {
+        /* Zero-length I/O is meaningless; the offset check guards the span against overflow */
+        if (length == 0 || length > TRACE_MAX_IO_LENGTH || offset > ~(uint64)0 - length)
+            return FALSE;
+        if (offset + length > t->span_bytes)
+            t->span_bytes = offset + length;
+        if (length > t->max_length)
+            t->max_length = length;
+        t->total_bytes += length;
+    }
+
+    TraceRecord *rec = &t->records[t->count++];
+    rec->op = op;
+    rec->offset = offset;
+    rec->length = length;
+    rec->think_us = think_us;
+    t->duration_us += think_us;
+    return TRUE;
+}
+
+void TraceFree(TraceData *t)
+{
+    if (t->records)
+        free(t->records);
+    memset(t, 0, sizeof(TraceData));
+}
+
+BOOL TraceDecode(TraceData *t, const uint8 *buf, uint32 size, char *err, uint32 err_size)
+{
+    memset(t, 0, sizeof(TraceData));
+
+    if (size < TRACE_HEADER_SIZE || GetBE32(buf) != TRACE_MAGIC) {
+        SetError(err, err_size, "not a trace file (bad magic)");
+        return FALSE;
+    }
+    if (GetBE16(buf + 4) != TRACE_VERSION) {
+        SetError(err, err_size, "unsupported trace version");
+        return FALSE;
+    }
+
+    uint32 count = GetBE32(buf + 8);
+    if (count == 0 || count > TRACE_MAX_RECORDS) {
+        SetError(err, err_size, "record count is zero or too large");
+        return FALSE;
+    }
+    if ((size - TRACE_HEADER_SIZE) / TRACE_RECORD_SIZE < count) {
+        SetError(err, err_size, "trace is truncated");
+        return FALSE;
+    }
+
+    if (!TraceAlloc(t, count)) {
+        SetError(err, err_size, "out of memory");
+        return FALSE;
+    }
+
+    const uint8 *p = buf + TRACE_HEADER_SIZE;
+    for (uint32 i = 0; i < count; i++, p += TRACE_RECORD_SIZE) {
+        if (!TraceAppend(t, p[0], GetBE64(p + 8), GetBE32(p + 4), GetBE32(p + 16))) {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "invalid record %u", (unsigned int)i);
+            SetError(err, err_size, msg);
+            TraceFree(t);
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+BOOL TraceLoad(TraceData *t, const char *path, char *err, uint32 err_size)
+{
+    memset(t, 0, sizeof(TraceData));
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        SetError(err, err_size, "cannot open trace file");
+        return FALSE;
+    }
+
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0)
+        size = ftell(fp);
+    if (size < TRACE_HEADER_SIZE ||
+        (unsigned long)size > TRACE_HEADER_SIZE + (unsigned long)TRACE_MAX_RECORDS * TRACE_RECORD_SIZE) {
+        SetError(err, err_size, "trace file is empty or too large");
+        fclose(fp);
+        return FALSE;
+    }
+
+    uint8 *buf = malloc((size_t)size);
+    if (!buf) {
+        SetError(err, err_size, "out of memory");
+        fclose(fp);
+        return FALSE;
+    }
+    rewind(fp);
+    size_t got = fread(buf, 1, (size_t)size, fp);
+    fclose(fp);
+
+    BOOL ok = FALSE;
+    if (got != (size_t)size)
+        SetError(err, err_size, "read error");
+    else
+        ok = TraceDecode(t, buf, (uint32)size, err, err_size);
+
+    free(buf);
+    return ok;
+}
+
+BOOL TraceSave(const TraceData *t, const char *path)
+{
+    FILE *fp = fopen(path, "wb");
+    if (!fp)
+        return FALSE;
+
+    uint8 hdr[TRACE_HEADER_SIZE];
+    memset(hdr, 0, sizeof(hdr));
+    PutBE32(hdr, TRACE_MAGIC);
+    PutBE16(hdr + 4, TRACE_VERSION);
+    PutBE32(hdr + 8, t->count);
+    BOOL ok = (fwrite(hdr, 1, sizeof(hdr), fp) == sizeof(hdr));
+
+    for (uint32 i = 0; ok && i < t->count; i++) {
+        const TraceRecord *rec = &t->records[i];
+        uint8 raw[TRACE_RECORD_SIZE];
+        memset(raw, 0, sizeof(raw));
+        raw[0] = rec->op;
+        PutBE32(raw + 4, rec->length);
+        PutBE64(raw + 8, rec->offset);
+        PutBE32(raw + 16, rec->think_us);
+        ok = (fwrite(raw, 1, sizeof(raw), fp) == sizeof(raw));
+    }
+
+    if (fclose(fp) != 0)
+        ok = FALSE;
+    return ok;
+}
+
+BOOL TraceRecorderInit(TraceRecorder *r, uint32 capacity)
+{
+    memset(r, 0, sizeof(TraceRecorder));
+    return TraceAlloc(&r->data, capacity);
+}
+
+void TraceRecorderAdd(TraceRecorder *r, uint8 op, uint64 offset, uint32 length, uint64 now_us)
+{
+    if (!r)
+        return;
+
+    uint64 think = r->started ? now_us - r->last_us : 0;
+    if (think > 0xFFFFFFFFULL)
+        think = 0xFFFFFFFFULL;
+    r->started = TRUE;
+    r->last_us = now_us;
+
+    if (!TraceAppend(&r->data, op, offset, length, (uint32)think))
+        r->dropped++;
+}
+
+void TraceRecorderFree(TraceRecorder *r)
+{
+    TraceFree(&r->data);
+    r->dropped = 0;
+    r->started = FALSE;
+}
+
+void TraceReplayBegin(TraceReplayer *r, const TraceData *t, BOOL open_loop, uint64 now_us)
+{
+    memset(r, 0, sizeof(TraceReplayer));
+    r->trace = t;
+    r->open_loop = open_loop;
+    r->due_us = now_us;
+}
+
+const TraceRecord *TraceReplayNext(TraceReplayer *r, uint64 now_us, uint64 *wait_us)
+{
+    *wait_us = 0;
+    if (!r->trace || r->trace->count == 0)
+        return NULL;
+
+    const TraceRecord *rec = &r->trace->records[r->next];
+    if (++r->next >= r->trace->count) {
+        r->next = 0;
+        r->loops++;
+    }
+
+    if (r->open_loop) {
+        r->due_us += rec->think_us;
+        if (r->due_us > now_us) {
+            *wait_us = r->due_us - now_us;
+        } else {
+            uint64 lag = now_us - r->due_us;
+            if (lag > 0) {
+                r->late_ops++;
+                r->total_lag_us += lag;
+                if (lag > r->max_lag_us)
+                    r->max_lag_us = lag;
+            }
+        }
+    }
+    return rec;
+}
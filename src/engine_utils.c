@@ -25,6 +25,17 @@ static const struct
     {TEST_SEQUENTIAL_READ, "SequentialRead", "Sequential Read", "SequentialRead"},
     {TEST_RANDOM_READ, "Random4KRead", "Random Read", "RandomRead"},
     {TEST_MIXED_RW_70_30, "MixedRW70/30", "Mixed R/W 70/30", "Mixed"},
+    {TEST_TRACE_REPLAY, "TraceReplay", "Trace Replay", "Trace"},
+    {TEST_RAW_SEQ_READ, "RawSeqRead", "Raw Sequential Read", "RawSeqRead"},
+    {TEST_RAW_RANDOM_READ, "RawRandomRead", "Raw Random Read", "RawRandomRead"},
+    {TEST_CACHE_SWEEP, "CacheSweep", "Cache Sweep", "CacheSweep"},
+    {TEST_DIR_SCALING, "DirScaling", "Directory Scaling", "DirScaling"},
+    {TEST_COMMIT_LOG, "CommitLog", "Commit Latency", "CommitLog"},
+    {TEST_RAW_ZONE_SCAN, "RawZoneScan", "Raw Zone Scan", "RawZoneScan"},
+    {TEST_RAW_SEEK_PROFILE, "RawSeekProfile", "Raw Seek Profile", "RawSeekProfile"},
+    {TEST_RAW_QUEUE_DEPTH, "RawQueueDepth", "Raw Queue Depth", "RawQueueDepth"},
+    {TEST_READ_AHEAD, "ReadAhead", "Read-Ahead Probe", "ReadAhead"},
+    {TEST_BUFFERED_IO, "BufferedIO", "Buffered I/O", "BufferedIO"},
 };
 
 #define TEST_TYPE_TABLE_SIZE (sizeof(test_type_table) / sizeof(test_type_table[0]))
@@ -0,0 +1,199 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Verify mode: sector stamps and the CRC32C check kernel.
+ */
+
+#include "engine_verify.h"
+#include "engine_internal.h"
+
+#define CRC32C_POLY 0x82F63B78 /* Castagnoli, bit-reflected */
+#define VERIFY_HEADER_BYTES 16
+#define VERIFY_CRC_AT (VERIFY_SECTOR_BYTES - 4)
+
+/* Slicing-by-8: table k advances a byte that sits k bytes before the end of the 8-byte step */
+static uint32 crc_tables[8][256];
+
+void VerifyTablesInit(void)
+{
+    for (uint32 n = 0; n < 256; n++) {
+        uint32 crc = n;
+        for (uint32 bit = 0; bit < 8; bit++)
+            crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+        crc_tables[0][n] = crc;
+    }
+    for (uint32 n = 0; n < 256; n++) {
+        for (uint32 k = 1; k < 8; k++)
+            crc_tables[k][n] = (crc_tables[k - 1][n] >> 8) ^ crc_tables[0][crc_tables[k - 1][n] & 0xFF];
+    }
+}
+
+uint32 Crc32c(uint32 crc, const void *data, uint32 len)
+{
+    const uint8 *p = (const uint8 *)data;
+    crc = ~crc;
+
+    /* Bytes are assembled explicitly, so the same code runs on the big-endian PPC and the host */
+    while (len >= 8) {
+        uint32 lo = crc ^ ((uint32)p[0] | ((uint32)p[1] << 8) | ((uint32)p[2] << 16) | ((uint32)p[3] << 24));
+        uint32 hi = (uint32)p[4] | ((uint32)p[5] << 8) | ((uint32)p[6] << 16) | ((uint32)p[7] << 24);
+        crc = crc_tables[7][lo & 0xFF] ^ crc_tables[6][(lo >> 8) & 0xFF] ^ crc_tables[5][(lo >> 16) & 0xFF] ^
+              crc_tables[4][lo >> 24] ^ crc_tables[3][hi & 0xFF] ^ crc_tables[2][(hi >> 8) & 0xFF] ^
+              crc_tables[1][(hi >> 16) & 0xFF] ^ crc_tables[0][hi >> 24];
+        p += 8;
+        len -= 8;
+    }
+    while (len--)
+        crc = (crc >> 8) ^ crc_tables[0][(crc ^ *p++) & 0xFF];
+
+    return ~crc;
+}
+
+void VerifyInit(VerifyState *v, const BenchOptions *opts)
+{
+    memset(v, 0, sizeof(*v));
+    v->enabled = opts->verify;
+    v->seed = opts->access_seed ? opts->access_seed : VERIFY_DEFAULT_SEED;
+}
+
+void VerifyReset(VerifyState *v)
+{
+    v->bytes_checked = 0;
+    v->bad_sectors = 0;
+    v->first_bad_offset = 0;
+    v->ticks = 0;
+}
+
+void VerifyMerge(VerifyState *dest, const VerifyState *src)
+{
+    if (src->bad_sectors > 0 && dest->bad_sectors == 0)
+        dest->first_bad_offset = src->first_bad_offset;
+    dest->bytes_checked += src->bytes_checked;
+    dest->bad_sectors += src->bad_sectors;
+    dest->ticks += src->ticks;
+}
+
+double VerifySeconds(const VerifyState *v)
+{
+    return TimerSeconds(0, v->ticks);
+}
+
+/* First whole sector of a buffer at offset, as an index into the buffer */
+static uint32 FirstSector(uint64 offset)
+{
+    uint32 into = (uint32)(offset % VERIFY_SECTOR_BYTES);
+    return into ? VERIFY_SECTOR_BYTES - into : 0;
+}
+
+static void StampSector(uint8 *p, uint32 seed, uint64 offset)
+{
+    uint32 header[4] = {VERIFY_MAGIC, seed, (uint32)(offset >> 32), (uint32)offset};
+    memcpy(p, header, sizeof(header));
+
+    /* xorshift32 seeded per sector; never 0, which would stay 0 */
+    uint32 x = seed ^ ((uint32)(offset / VERIFY_SECTOR_BYTES) * 0x9E3779B9U) ^ (uint32)(offset >> 32);
+    if (x == 0)
+        x = VERIFY_DEFAULT_SEED;
+    for (uint32 i = VERIFY_HEADER_BYTES; i < VERIFY_CRC_AT; i += 4) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        memcpy(p + i, &x, 4);
+    }
+
+    uint32 crc = Crc32c(0, p, VERIFY_CRC_AT);
+    memcpy(p + VERIFY_CRC_AT, &crc, 4);
+}
+
+static BOOL SectorMatches(const uint8 *p, uint32 seed, uint64 offset)
+{
+    uint32 header[4], crc;
+    memcpy(header, p, sizeof(header));
+    memcpy(&crc, p + VERIFY_CRC_AT, 4);
+    return header[0] == VERIFY_MAGIC && header[1] == seed && header[2] == (uint32)(offset >> 32) &&
+           header[3] == (uint32)offset && crc == Crc32c(0, p, VERIFY_CRC_AT);
+}
+
+void VerifyStamp(VerifyState *v, BenchSampler *s, uint8 *buf, uint32 len, uint64 offset)
+{
+    BenchTicks start = TimerNow();
+    uint64 end = offset + len;
+    for (uint64 pos = offset - offset % VERIFY_SECTOR_BYTES; pos < end; pos += VERIFY_SECTOR_BYTES) {
+        if (pos >= offset && pos + VERIFY_SECTOR_BYTES <= end) {
+            StampSector(buf + (pos - offset), v->seed, pos);
+            continue;
+        }
+        /* A sector split across writes gets its share of the full stamp, so it reads back whole */
+        uint8 sector[VERIFY_SECTOR_BYTES];
+        StampSector(sector, v->seed, pos);
+        uint64 from = (pos < offset) ? offset : pos;
+        uint64 to = (pos + VERIFY_SECTOR_BYTES < end) ? pos + VERIFY_SECTOR_BYTES : end;
+        memcpy(buf + (from - offset), sector + (from - pos), (size_t)(to - from));
+    }
+    BenchTicks spent = TimerNow() - start;
+    v->ticks += spent;
+    SamplerExclude(s, spent);
+}
+
+BOOL VerifyCheck(VerifyState *v, BenchSampler *s, const uint8 *buf, uint32 len, uint64 offset)
+{
+    BenchTicks start = TimerNow();
+    uint32 bad = 0;
+    for (uint32 i = FirstSector(offset); i + VERIFY_SECTOR_BYTES <= len; i += VERIFY_SECTOR_BYTES) {
+        if (!SectorMatches(buf + i, v->seed, offset + i)) {
+            if (v->bad_sectors + bad == 0)
+                v->first_bad_offset = offset + i;
+            LOG_DEBUG("Verify: sector at offset %llu does not match", (unsigned long long)(offset + i));
+            bad++;
+        }
+        v->bytes_checked += VERIFY_SECTOR_BYTES;
+    }
+    v->bad_sectors += bad;
+    BenchTicks spent = TimerNow() - start;
+    v->ticks += spent;
+    SamplerExclude(s, spent);
+    return (bad == 0);
+}
+
+BOOL VerifyFile(VerifyState *v, BenchSampler *s, const char *path, const char *volume, uint64 size, uint32 chunk)
+{
+    BenchTicks start = TimerNow();
+    BenchTicks before = v->ticks;
+    BOOL ok = FALSE;
+
+    FlushDiskCache(volume);
+    if (!PlatDropVolumeCache(volume) && !v->cache_warned) {
+        LogUser("Verify: cannot drop the cache of '%s' - the read-back may come from memory, not the medium",
+                volume);
+        v->cache_warned = TRUE;
+    }
+    PlatFile file = PlatOpen(path, PLAT_OPEN_EXISTING);
+    uint8 *buffer = PlatAlloc(chunk);
+
+    if (file && buffer) {
+        ok = TRUE;
+        for (uint64 pos = 0; pos < size;) {
+            uint32 to_read = (size - pos < chunk) ? (uint32)(size - pos) : chunk;
+            if (PlatRead(file, buffer, to_read) != (int32)to_read) {
+                LOG_DEBUG("Verify: read-back of %s failed at offset %llu", path, (unsigned long long)pos);
+                ok = FALSE;
+                break;
+            }
+            if (!VerifyCheck(v, NULL, buffer, to_read, pos))
+                ok = FALSE;
+            pos += to_read;
+        }
+    }
+
+    if (buffer)
+        PlatFree(buffer);
+    if (file)
+        PlatClose(file);
+
+    /* The whole read-back is verify time, not just the checks it made */
+    BenchTicks spent = TimerNow() - start;
+    v->ticks = before + spent;
+    SamplerExclude(s, spent);
+    return ok;
+}
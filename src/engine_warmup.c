@@ -15,16 +15,15 @@
 #define WARMUP_THRESHOLD_SECS 5.0f
 
 static char last_warmup_path[MAX_PATH_LEN] = "";
-static struct TimeVal last_warmup_time = {0, 0};
+static BenchTicks last_warmup_time = 0;
 
 void RunWarmup(const char *target_path)
 {
-    struct TimeVal current_time;
-    GetMicroTime(&current_time);
+    BenchTicks current_time = TimerNow();
 
     /* Check for recent warmup session to avoid redundancy */
     if (last_warmup_path[0] != '\0' && strncmp(last_warmup_path, target_path, sizeof(last_warmup_path)) == 0) {
-        float delta = GetDuration(&last_warmup_time, &current_time);
+        double delta = TimerSeconds(last_warmup_time, current_time);
         if (delta < WARMUP_THRESHOLD_SECS) {
             LOG_DEBUG("Warmup: Skipped (Recent warmup on '%s' %.2fs ago matches threshold < %.1fs)", target_path, delta,
                       WARMUP_THRESHOLD_SECS);
@@ -46,7 +45,7 @@ void RunWarmup(const char *target_path)
     strncat(full_path, WARMUP_FILE_NAME, sizeof(full_path) - strlen(full_path) - 1);
 
     /* Allocate buffer */
-    void *buffer = IExec->AllocVecTags(BUFFER_SIZE, AVT_Type, MEMF_SHARED, TAG_DONE);
+    void *buffer = PlatAlloc(BUFFER_SIZE);
     if (!buffer) {
         LOG_DEBUG("Warmup: Failed to allocate buffer.");
         return;
@@ -59,49 +58,48 @@ void RunWarmup(const char *target_path)
     }
 
     /* 1. WRITE Phase */
-    BPTR file = IDOS->FOpen(full_path, MODE_NEWFILE, BUFFER_SIZE);
+    PlatFile file = PlatOpen(full_path, PLAT_OPEN_NEW);
     if (file) {
         uint32 bytes_written = 0;
         while (bytes_written < WARMUP_SIZE) {
-            int32 res = IDOS->Write(file, buffer, BUFFER_SIZE);
+            int32 res = PlatWrite(file, buffer, BUFFER_SIZE);
             if (res == -1)
                 break;
             bytes_written += res;
         }
-        IDOS->FClose(file);
+        PlatClose(file);
     } else {
         LOG_DEBUG("Warmup: Failed to open file for writing: %s", full_path);
-        IExec->FreeVec(buffer);
+        PlatFree(buffer);
         return;
     }
 
     /* 2. READ Phase */
-    file = IDOS->FOpen(full_path, MODE_OLDFILE, BUFFER_SIZE);
+    file = PlatOpen(full_path, PLAT_OPEN_EXISTING);
     if (file) {
         uint32 bytes_read = 0;
         while (bytes_read < WARMUP_SIZE) {
-            int32 res = IDOS->Read(file, buffer, BUFFER_SIZE);
+            int32 res = PlatRead(file, buffer, BUFFER_SIZE);
             if (res == -1 || res == 0)
                 break;
             bytes_read += res;
         }
-        IDOS->FClose(file);
+        PlatClose(file);
     } else {
         LOG_DEBUG("Warmup: Failed to open file for reading: %s", full_path);
     }
 
     /* 3. CLEANUP Phase */
-    int32 result = IDOS->Delete(full_path);
-    if (result == 0) {
+    if (!PlatDelete(full_path)) {
         LOG_DEBUG("Warmup: Warning - Failed to delete warmup file.");
     }
 
-    IExec->FreeVec(buffer);
+    PlatFree(buffer);
 
     /* Update Session Cache */
     snprintf(last_warmup_path, sizeof(last_warmup_path), "%s", target_path);
     last_warmup_path[sizeof(last_warmup_path) - 1] = '\0';
-    GetMicroTime(&last_warmup_time);
+    last_warmup_time = TimerNow();
 
     LOG_DEBUG("Warmup: Complete.");
 }
@@ -10,7 +10,7 @@
 void RegisterWorkload(const BenchWorkload *workload);
 
 /* Maximum number of registered workloads */
-#define MAX_WORKLOADS 16
+#define MAX_WORKLOADS 32
 
 static const BenchWorkload *WorkloadRegistry[MAX_WORKLOADS];
 static uint32 WorkloadCount = 0;
@@ -34,6 +34,29 @@ void InitWorkloadRegistry(void)
     RegisterWorkload(&Workload_SequentialRead);
     RegisterWorkload(&Workload_Random4KRead);
     RegisterWorkload(&Workload_MixedRW);
+
+    /* Register trace replay */
+    RegisterWorkload(&Workload_TraceReplay);
+
+    /* Register raw device workloads */
+    RegisterWorkload(&Workload_RawSeqRead);
+    RegisterWorkload(&Workload_RawRandomRead);
+    RegisterWorkload(&Workload_RawZoneScan);
+    RegisterWorkload(&Workload_RawSeekProfile);
+    RegisterWorkload(&Workload_RawQueueDepth);
+
+    /* Register cache characterisation workloads */
+    RegisterWorkload(&Workload_CacheSweep);
+    RegisterWorkload(&Workload_ReadAhead);
+
+    /* Register metadata scaling workloads */
+    RegisterWorkload(&Workload_DirScaling);
+
+    /* Register durability workloads */
+    RegisterWorkload(&Workload_CommitLog);
+
+    /* Register API comparison workloads */
+    RegisterWorkload(&Workload_BufferedIo);
 }
 
 void CleanupWorkloadRegistry(void)
@@ -0,0 +1,83 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * Throughput map over the LBA range of a raw device.
+ */
+
+#include "engine_zonemap.h"
+#include "engine_internal.h"
+
+BOOL ZoneStatsInit(ZoneStats *z, uint64 capacity_bytes, uint32 block_bytes, uint32 zones, uint64 span_bytes)
+{
+    memset(z, 0, sizeof(*z));
+    if (zones < 2 || zones > ZONE_MAP_MAX || span_bytes == 0 || span_bytes * zones > capacity_bytes)
+        return FALSE;
+
+    z->zones = zones;
+    z->span_bytes = span_bytes;
+    uint64 last = capacity_bytes - span_bytes;
+    for (uint32 i = 0; i < zones; i++) {
+        uint64 offset = last / (zones - 1) * i;
+        z->offset[i] = offset / block_bytes * block_bytes;
+    }
+    return TRUE;
+}
+
+void ZoneStatsReset(ZoneStats *z)
+{
+    memset(z->bytes, 0, sizeof(z->bytes));
+    memset(z->ticks, 0, sizeof(z->ticks));
+}
+
+void ZoneStatsMerge(ZoneStats *dest, const ZoneStats *src)
+{
+    if (dest->zones == 0) {
+        dest->zones = src->zones;
+        dest->span_bytes = src->span_bytes;
+        memcpy(dest->offset, src->offset, sizeof(dest->offset));
+    }
+    for (uint32 i = 0; i < dest->zones && i < src->zones; i++) {
+        dest->bytes[i] += src->bytes[i];
+        dest->ticks[i] += src->ticks[i];
+    }
+}
+
+void ZoneStatsRecord(ZoneStats *z, uint32 zone, uint64 bytes, BenchTicks start)
+{
+    z->bytes[zone] += bytes;
+    z->ticks[zone] += TimerNow() - start;
+}
+
+void ZoneStatsToResult(const ZoneStats *z, BenchResult *out)
+{
+    out->zone_count = z->zones;
+    out->zone_weak_mask = 0;
+    for (uint32 i = 0; i < z->zones; i++) {
+        double secs = TimerSeconds(0, z->ticks[i]);
+        out->zone_mbps[i] = (secs > 0.0) ? (float)((double)z->bytes[i] / (1024.0 * 1024.0) / secs) : 0.0f;
+    }
+    if (z->zones < 4)
+        return; /* Too few points for a trend */
+
+    /* Least-squares line through (zone, MB/s): the expected outer-to-inner falloff */
+    double n = (double)z->zones, sx = 0.0, sy = 0.0, sxx = 0.0, sxy = 0.0;
+    for (uint32 i = 0; i < z->zones; i++) {
+        sx += i;
+        sy += out->zone_mbps[i];
+        sxx += (double)i * i;
+        sxy += (double)i * out->zone_mbps[i];
+    }
+    double slope = (n * sxy - sx * sy) / (n * sxx - sx * sx);
+    double icept = (sy - slope * sx) / n;
+
+    for (uint32 i = 0; i < z->zones; i++) {
+        double trend = icept + slope * i;
+        if (trend > 0.0 && out->zone_mbps[i] < trend * (100 - ZONE_WEAK_PCT) / 100.0) {
+            out->zone_weak_mask |= 1UL << i;
+            LogUser("Zone Scan: zone %u (%u%% into the disk) reads %.1f MB/s against a trend of %.1f - possible "
+                    "weak area",
+                    (unsigned int)i, (unsigned int)(i * 100 / (z->zones - 1)), out->zone_mbps[i], trend);
+        }
+    }
+}
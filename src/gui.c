@@ -311,7 +311,8 @@ int StartGUI(void)
         UpdateBulkTabInfo();
 
         /* Initial Block Size State configuration */
-        if (ui.current_test_type == TEST_DAILY_GRIND || ui.current_test_type == TEST_PROFILER) {
+        if (ui.current_test_type == TEST_DAILY_GRIND || ui.current_test_type == TEST_PROFILER ||
+            ui.current_test_type == TEST_DIR_SCALING || ui.current_test_type == TEST_BUFFERED_IO) {
             SetGadgetState(GID_BLOCK_SIZE, TRUE);
         }
         RefreshHistory();
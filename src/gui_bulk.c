@@ -100,6 +100,9 @@ void LaunchBulkJobs(void)
     if (run_all_tests) {
         /* Dynamically add all available tests */
         for (int i = 0; i < TEST_COUNT; i++) {
+            /* Trace replay needs a trace file; leave it out of "all tests" when none is set */
+            if (i == TEST_TRACE_REPLAY && !ui.bench_options.trace_path[0])
+                continue;
             tests[num_tests++] = i;
         }
     } else {
@@ -134,7 +137,8 @@ void LaunchBulkJobs(void)
                 /* Nested Loops for Permutations: Tests -> Blocks */
                 for (int t = 0; t < num_tests; t++) {
                     /* FORCE specific tests to only run ONCE (ignoring Block Size loop) */
-                    BOOL force_single_run = (tests[t] == TEST_DAILY_GRIND || tests[t] == TEST_PROFILER);
+                    BOOL force_single_run = (tests[t] == TEST_DAILY_GRIND || tests[t] == TEST_PROFILER ||
+                                             tests[t] == TEST_DIR_SCALING || tests[t] == TEST_BUFFERED_IO);
 
                     int effective_num_blocks = force_single_run ? 1 : num_blocks;
 
@@ -151,6 +155,7 @@ void LaunchBulkJobs(void)
                                 force_single_run ? 0 : blocks[b]; /* 0 or default will be handled by Setup */
                             job->averaging_method = ui.averaging_method;
                             job->flush_cache = ui.flush_cache;
+                            job->options = ui.bench_options;
                             job->msg.mn_ReplyPort = ui.worker_reply_port;
 
                             LOG_DEBUG("Bulk: Queueing job for '%s' (Test=%d, BS=%u)", ddata->bare_name, tests[t],
@@ -3,10 +3,14 @@
  * Copyright (c) 2026 Team Derfs. All rights reserved.
  */
 
+#include "engine_buffer.h"
 #include "gui_internal.h"
 #include <intuition/pointerclass.h>
 
-static char report_buffer[4096];
+#define DETAILS_ZONE_BAR 30 /* Characters of the longest Zone Map bar */
+#define DETAILS_SEEK_BAR 30 /* Characters of the slowest Seek Profile bar */
+
+static char report_buffer[8192];
 
 void ShowBenchmarkDetails(Object *list_obj)
 {
@@ -75,7 +79,8 @@ void OpenDetailsWindow(BenchResult *res)
              res->timestamp, TestTypeToDisplayName(res->type), res->volume_name, res->result_id, res->fs_type,
              (unsigned int)res->passes,
              (res->averaging_method == AVERAGE_TRIMMED_MEAN) ? "Trimmed Mean" :
-             (res->averaging_method == AVERAGE_MEDIAN) ? "Median" : "All Passes",
+             (res->averaging_method == AVERAGE_MEDIAN) ? "Median" :
+             (res->averaging_method == AVERAGE_ADAPTIVE) ? "Adaptive" : "All Passes",
              FormatPresetBlockSize(res->block_size),
              res->mb_per_sec, res->min_mbps, res->max_mbps, (unsigned int)res->iops, res->total_duration,
              (double)res->cumulative_bytes / 1048576.0, res->max_mbps - res->min_mbps, res->device_name,
@@ -86,6 +91,224 @@ void OpenDetailsWindow(BenchResult *res)
                                    : "(SAME)",
              res->app_version);
 
+    /* Per-operation latency section (only for workloads that track it) */
+    if (res->lat_max_us > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Latency (per operation):\n"
+                 "  p50:        %.0f us\n"
+                 "  p90:        %.0f us\n"
+                 "  p99:        %.0f us\n"
+                 "  p99.9:      %.0f us\n"
+                 "  Max:        %.0f us\n",
+                 res->lat_p50_us, res->lat_p90_us, res->lat_p99_us, res->lat_p999_us, res->lat_max_us);
+    }
+
+    /* Pass-to-pass confidence (needs at least two passes) */
+    if (res->cv_pct > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Confidence:\n"
+                 "  95%% CI:     +/- %.2f%% of mean\n"
+                 "  CV:         %.2f%%\n",
+                 res->ci95_pct, res->cv_pct);
+    }
+
+    /* Non-default data-set size */
+    if (res->dataset_bytes > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "\n Data Set:     %s\n",
+                 FormatByteSize(res->dataset_bytes));
+    }
+
+    /* Concurrent streams */
+    if (res->streams > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Streams:      %u concurrent\n"
+                 "  Per Stream:  %.2f MB/s, %u IOPS\n"
+                 "  Slowest:     %.2f MB/s\n",
+                 (unsigned int)res->streams, res->stream_mbps, (unsigned int)res->stream_iops, res->slow_stream_mbps);
+    }
+
+    /* Cache Sweep point */
+    if (res->working_set_bytes > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, " Working Set:  %s\n",
+                 FormatByteSize(res->working_set_bytes));
+    }
+
+    /* Metadata rates per operation class (Directory Scaling, Profiler) */
+    if (res->dir_entries > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "\n Directory:    %u entries\n",
+                 (unsigned int)res->dir_entries);
+    } else if (res->meta_ops[META_OP_CREATE].count > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "\n Operations:\n");
+    }
+    for (uint32 op = 0; op < META_OP_COUNT; op++) {
+        const MetaOpResult *m = &res->meta_ops[op];
+        if (m->count > 0 && m->secs > 0.0f) {
+            size_t used = strlen(report_buffer);
+            snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                     "  %-12s %.0f ops/s (%u ops), p50 %.0f us, p99 %.0f us\n", MetaOpName((MetaOp)op),
+                     (double)MetaOpRate(m), (unsigned int)m->count, m->p50_us, m->p99_us);
+        }
+    }
+
+    /* Group commit (Commit Latency): IOPS are commits, the latency figures are per commit */
+    if (res->commit_group > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Commits:      %u/s, %u records per flush (%.0f records/s)\n", (unsigned int)res->iops,
+                 (unsigned int)res->commit_group, (double)res->iops * res->commit_group);
+    }
+
+    /* Raw Queue Depth: the latency figures include the wait behind the other requests in flight */
+    if (res->queue_depth > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Queue Depth:  %u requests in flight (latency from submit to completion)\n",
+                 (unsigned int)res->queue_depth);
+    }
+
+    /* Buffered I/O: which DOS calls moved the records */
+    if (res->io_buffer == IO_BUFFER_NONE) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n I/O Calls:    Read/Write, unbuffered (one packet per record)\n");
+    } else if (res->io_buffer > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n I/O Calls:    FRead/FWrite, %s FOpen buffer\n", FormatByteSize(res->io_buffer));
+    }
+
+    /* Buffer alignment sweep: where the transfer buffer was placed */
+    if (res->buffer_mem != BUFFER_MEM_DEFAULT) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Buffers:      %s memory, %u bytes past an 8 KB boundary\n", BufferMemName(res->buffer_mem),
+                 (unsigned int)res->buffer_offset);
+    }
+
+    /* Raw Zone Scan: MB/s from the first LBA to the last, as a bar per zone */
+    if (res->zone_count > 1) {
+        float peak = 0.0f;
+        for (uint32 z = 0; z < res->zone_count; z++)
+            if (res->zone_mbps[z] > peak)
+                peak = res->zone_mbps[z];
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "\n Zone Map:     (outer to inner)\n");
+        for (uint32 z = 0; z < res->zone_count; z++) {
+            char bar[DETAILS_ZONE_BAR + 1];
+            uint32 len = (peak > 0.0f) ? (uint32)(res->zone_mbps[z] / peak * DETAILS_ZONE_BAR + 0.5f) : 0;
+            memset(bar, '#', len);
+            bar[len] = '\0';
+            used = strlen(report_buffer);
+            snprintf(report_buffer + used, sizeof(report_buffer) - used, "  %3u%% %7.1f %-*s%s\n",
+                     (unsigned int)(z * 100 / (res->zone_count - 1)), res->zone_mbps[z], DETAILS_ZONE_BAR, bar,
+                     (res->zone_weak_mask & (1UL << z)) ? " weak" : "");
+        }
+    }
+
+    /* Raw Seek Profile: mean latency per seek distance, then the estimates drawn from the curve */
+    if (res->seek_levels > 1) {
+        float slowest = 0.0f;
+        for (uint32 i = 0; i < res->seek_levels; i++)
+            if (res->seek_us[i] > slowest)
+                slowest = res->seek_us[i];
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "\n Seek Profile: (distance, mean latency)\n");
+        for (uint32 i = 0; i < res->seek_levels; i++) {
+            char bar[DETAILS_SEEK_BAR + 1];
+            uint32 len = (slowest > 0.0f) ? (uint32)(res->seek_us[i] / slowest * DETAILS_SEEK_BAR + 0.5f) : 0;
+            memset(bar, '#', len);
+            bar[len] = '\0';
+            used = strlen(report_buffer);
+            snprintf(report_buffer + used, sizeof(report_buffer) - used, "  %10s %8.0f us %s\n",
+                     FormatByteSize(res->seek_dist_bytes[i]), res->seek_us[i], bar);
+        }
+        used = strlen(report_buffer);
+        if (res->seek_rotation_us > 0.0f)
+            snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                     "  Rotation:    %.0f us average (~%.0f RPM)\n", res->seek_rotation_us,
+                     30.0e6 / res->seek_rotation_us);
+        else
+            snprintf(report_buffer + used, sizeof(report_buffer) - used, "  Rotation:    none seen\n");
+        used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "  Track Seek:  %.0f us\n"
+                 "  Full Stroke: %.0f us\n",
+                 res->seek_track_us, res->seek_full_us);
+    }
+
+    /* Read-Ahead Probe: mean latency per gap, both directions, against the uncached reference */
+    if (res->stride_levels > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Read-Ahead:   (gap between reads, mean latency)\n"
+                 "         Gap    Forward   Backward\n");
+        for (uint32 i = 0; i < res->stride_levels; i++) {
+            used = strlen(report_buffer);
+            snprintf(report_buffer + used, sizeof(report_buffer) - used, "  %10s %7.0f us %7.0f us\n",
+                     FormatByteSize(res->stride_gap_bytes[i]), res->stride_fwd_us[i], res->stride_back_us[i]);
+        }
+        used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "      Random %7.0f us\n"
+                 "  Prefetch:    %s ahead, ",
+                 res->stride_random_us, FormatByteSize(res->readahead_bytes));
+        used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "%s behind\n",
+                 FormatByteSize(res->readbehind_bytes));
+    }
+
+    /* Data written, for tests that write */
+    if (res->data_pattern[0]) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, " Write Data:   %s\n", res->data_pattern);
+    }
+
+    /* Verify mode: data checked on read, timed apart from the passes */
+    if (res->verify_bytes > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Verify:       %s checked, %u bad sectors\n"
+                 "  Verify Time: %.2f s (not in MB/s)\n",
+                 FormatByteSize(res->verify_bytes), (unsigned int)res->verify_errors, res->verify_secs);
+    }
+
+    /* Cold-cache passes (and the warm reruns of paired mode) */
+    if (res->cache_mode[0]) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, "\n Cache:        %s (MB/s measured cold)\n",
+                 res->cache_mode);
+        if (res->warm_mbps > 0.0f) {
+            used = strlen(report_buffer);
+            snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                     "  Warm:        %.2f MB/s\n"
+                     "  Speed-up:    %.2fx from the cache\n",
+                     res->warm_mbps, res->cache_speedup);
+        }
+    }
+
+    /* Access pattern of random-I/O workloads */
+    if (res->access_pattern[0]) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used, " Access:       %s\n", res->access_pattern);
+    }
+
+    /* Time-bounded run mode */
+    if (res->pass_duration_secs > 0) {
+        size_t used = strlen(report_buffer);
+        snprintf(report_buffer + used, sizeof(report_buffer) - used,
+                 "\n Run Mode:\n"
+                 "  Pass Length: %u seconds\n"
+                 "  Ramp-up:     %.2f seconds discarded per pass\n",
+                 (unsigned int)res->pass_duration_secs, res->rampup_secs);
+    }
+
     /* Fixed labels and shortcut display:
        - Titlebar (Window Menu): Use clean "Copy" + MA_Key. Icon is auto-added.
        - Context Menu: Use "C|Copy" to attempt to force hint rendering.
@@ -43,8 +43,8 @@ void UpdateBulkTabInfo(void)
         block_str = FormatPresetBlockSize(ui.current_block_size);
     }
 
-    static const char *avg_method_short[] = {"All Passes", "Trimmed Mean", "Median"};
-    const char *avg_name = (ui.averaging_method < 3) ? avg_method_short[ui.averaging_method] : "All Passes";
+    static const char *avg_method_short[] = {"All Passes", "Trimmed Mean", "Median", "Adaptive"};
+    const char *avg_name = (ui.averaging_method < 4) ? avg_method_short[ui.averaging_method] : "All Passes";
 
     snprintf(buf, sizeof(buf), "Settings: %s / %u Passes (%s) / %s",
              test_name, (unsigned int)ui.current_passes, avg_name, block_str);
@@ -370,7 +370,8 @@ void HandleGUIEvent(uint32 result, uint16 code, BOOL *running)
             LOG_DEBUG("GUI: Test Type changed to %u", ui.current_test_type);
 
             /* Disable Block Size chooser for Fixed-Behavior tests */
-            BOOL disable_blocks = (ui.current_test_type == TEST_DAILY_GRIND || ui.current_test_type == TEST_PROFILER);
+            BOOL disable_blocks = (ui.current_test_type == TEST_DAILY_GRIND || ui.current_test_type == TEST_PROFILER ||
+                                   ui.current_test_type == TEST_DIR_SCALING || ui.current_test_type == TEST_BUFFERED_IO);
 
             SetGadgetState(GID_BLOCK_SIZE, disable_blocks);
 
@@ -42,7 +42,7 @@ void RefreshHistory(void)
     int count = 0;
     if (file) {
         LOG_DEBUG("RefreshHistory: Opened CSV file");
-        char line[1024];
+        char line[3072]; /* Must hold a full CSV record including extended metric columns */
         BOOL first = TRUE;
         BOOL needs_sanitization = FALSE;
         while (IDOS->FGets(file, line, sizeof(line))) {
@@ -66,12 +66,14 @@ void RefreshHistory(void)
             ver[0] = passes[0] = bs_str[0] = trimmed[0] = min_str[0] = max_str[0] = dur_str[0] = bytes_str[0] = 0;
             vendor[0] = product[0] = firmware[0] = serial[0] = 0;
 
-            /* Parse CSV based on column count */
+            /* Parse CSV based on column count; 'consumed' marks the start of the extended metric columns */
+            int consumed = 0;
             int fields = sscanf(line,
                                 "%31[^,],%31[^,],%63[^,],%63[^,],%127[^,],%31[^,],%31[^,],%63[^,],%31[^,],%31[^,],%15[^"
-                                ",],%31[^,],%15[^,],%31[^,],%31[^,],%31[^,],%31[^,],%31[^,],%63[^,],%31[^,],%31s",
+                                ",],%31[^,],%15[^,],%31[^,],%31[^,],%31[^,],%31[^,],%31[^,],%63[^,],%31[^,],%31[^,]%n",
                                 id, timestamp, type, disk, fs, mbs_str, iops_str, device, unit_str, ver, passes, bs_str,
-                                trimmed, min_str, max_str, dur_str, bytes_str, vendor, product, firmware, serial);
+                                trimmed, min_str, max_str, dur_str, bytes_str, vendor, product, firmware, serial,
+                                &consumed);
 
             if (fields < 8) {
                 LOG_DEBUG("RefreshHistory: Skipping invalid line (fields=%d): '%s'", fields, line);
@@ -125,6 +127,8 @@ void RefreshHistory(void)
                         res->averaging_method = AVERAGE_TRIMMED_MEAN;
                     } else if (strcasecmp(trimmed, "Median") == 0) {
                         res->averaging_method = AVERAGE_MEDIAN;
+                    } else if (strcasecmp(trimmed, "Adaptive") == 0) {
+                        res->averaging_method = AVERAGE_ADAPTIVE;
                     } else if (strtoul(trimmed, NULL, 10) == 1) {
                         /* Legacy: numeric 1 = TrimmedMean */
                         res->averaging_method = AVERAGE_TRIMMED_MEAN;
@@ -143,11 +147,13 @@ void RefreshHistory(void)
                 snprintf(res->product, sizeof(res->product), "%s", (fields >= 19) ? product : "N/A");
                 snprintf(res->firmware_rev, sizeof(res->firmware_rev), "%s", (fields >= 20) ? firmware : "N/A");
                 snprintf(res->serial_number, sizeof(res->serial_number), "%s", (fields >= 21) ? serial : "N/A");
+                if (fields >= 21 && consumed > 0)
+                    ParseExtendedCSVFields(line + consumed, res);
 
                 res->type = StringToTestType(type);
 
                 /* Sanitization: Force Block Size to 0 (Mixed) for fixed-behavior tests */
-                if (res->type == TEST_DAILY_GRIND || res->type == TEST_PROFILER) {
+                if (res->type == TEST_DAILY_GRIND || res->type == TEST_PROFILER || res->type == TEST_DIR_SCALING) {
                     if (res->block_size != 0) {
                         LOG_DEBUG("Sanitizing record %s: test type %d had block size %u, forcing to 0", res->result_id,
                                   res->type, (unsigned int)res->block_size);
@@ -209,9 +215,7 @@ void RefreshHistory(void)
         /* Create empty history file with full header if it doesn't exist */
         file = IDOS->FOpen(ui.csv_path, MODE_NEWFILE, 0);
         if (file) {
-            IDOS->FPuts(file, "ID,DateTime,Type,Volume,FS,MB/"
-                              "s,IOPS,Hardware,Unit,AppVersion,Passes,BlockSize,Trimmed,Min,Max,Duration,TotalBytes,"
-                              "Vendor,Product,Firmware,Serial\n");
+            IDOS->FPuts(file, BENCH_CSV_HEADER);
             IDOS->FClose(file);
             LOG_DEBUG("RefreshHistory: Created new CSV at '%s'", ui.csv_path);
         } else {
@@ -315,8 +319,7 @@ static void SaveHistoryToCSV(const char *filename)
         return;
     }
 
-    IDOS->FPuts(file, "ID,DateTime,Type,Volume,FS,MB/s,IOPS,Hardware,Unit,AppVersion,Passes,BlockSize,Trimmed,Min,Max,"
-                      "Duration,TotalBytes,Vendor,Product,Firmware,Serial\n");
+    IDOS->FPuts(file, BENCH_CSV_HEADER);
 
     /* History list is Newest-First (Head->Tail).
        CSV should be Oldest-First (Append).
@@ -333,17 +336,20 @@ static void SaveHistoryToCSV(const char *filename)
                 /* Map test type enum to CSV string via centralised lookup */
                 const char *typeName = TestTypeToString(result->type);
 
-                char line[1024];
+                char line[3072];
+                char ext[2048];
                 const char *avg_method_str = (result->averaging_method == AVERAGE_TRIMMED_MEAN) ? "TrimmedMean" :
-                                             (result->averaging_method == AVERAGE_MEDIAN) ? "Median" : "AllPasses";
+                                             (result->averaging_method == AVERAGE_MEDIAN)   ? "Median" :
+                                             (result->averaging_method == AVERAGE_ADAPTIVE) ? "Adaptive" : "AllPasses";
+                FormatExtendedCSVFields(result, ext, sizeof(ext));
                 snprintf(line, sizeof(line),
-                         "%s,%s,%s,%s,%s,%.2f,%u,%s,%u,%s,%u,%u,%s,%.2f,%.2f,%.2f,%llu,%s,%s,%s,%s\n",
+                         "%s,%s,%s,%s,%s,%.2f,%u,%s,%u,%s,%u,%u,%s,%.2f,%.2f,%.2f,%llu,%s,%s,%s,%s%s\n",
                          result->result_id, result->timestamp, typeName, result->volume_name, result->fs_type,
                          result->mb_per_sec, (unsigned int)result->iops, result->device_name,
                          (unsigned int)result->device_unit, result->app_version, (unsigned int)result->passes,
                          (unsigned int)result->block_size, avg_method_str, result->min_mbps,
                          result->max_mbps, result->total_duration, (unsigned long long)result->cumulative_bytes,
-                         result->vendor, result->product, result->firmware_rev, result->serial_number);
+                         result->vendor, result->product, result->firmware_rev, result->serial_number, ext);
                 IDOS->FPuts(file, line);
             }
             node = node->ln_Pred;
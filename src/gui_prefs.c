@@ -11,8 +11,9 @@ static const char *avg_label_strs[] = {
     "Average: All Passes",
     "Average: Trimmed Mean (Excl. Top/Bottom)",
     "Average: Median (Middle Value Only)",
+    "Average: Adaptive (Until 95% CI Is Tight)",
 };
-#define NUM_AVG_LABELS 3
+#define NUM_AVG_LABELS 4
 
 void UpdateAvgMethodLabel(void)
 {
@@ -108,6 +109,30 @@ void LoadPrefs(void)
         uint32 p_num = IPrefs->DictGetIntegerForKey(dict, "DefaultPasses", DEFAULT_PASSES);
         IIntuition->SetGadgetAttrs((struct Gadget *)ui.pass_gad, ui.window, NULL, INTEGER_Number, p_num, TAG_DONE);
         ui.averaging_method = IPrefs->DictGetIntegerForKey(dict, "AveragingMethod", DEFAULT_AVERAGING_METHOD);
+        /* Run-mode options have no gadgets yet; they are read from the prefs file only */
+        ui.bench_options.duration_secs = IPrefs->DictGetIntegerForKey(dict, "PassDurationSecs", 0);
+        ui.bench_options.adaptive_ci_pct = (float)IPrefs->DictGetIntegerForKey(dict, "AdaptiveTargetCIPct", 0);
+        ui.bench_options.adaptive_budget_secs = IPrefs->DictGetIntegerForKey(dict, "AdaptiveBudgetSecs", 0);
+        ui.bench_options.dataset_bytes = (uint64)IPrefs->DictGetIntegerForKey(dict, "DataSetMB", 0) * 1024 * 1024;
+        ui.bench_options.access_pattern = IPrefs->DictGetIntegerForKey(dict, "AccessPattern", ACCESS_UNIFORM);
+        ui.bench_options.zipf_theta = (float)IPrefs->DictGetIntegerForKey(dict, "ZipfThetaPct", 0) / 100.0f;
+        ui.bench_options.hot_ops_pct = IPrefs->DictGetIntegerForKey(dict, "HotOpsPct", 0);
+        ui.bench_options.hot_data_pct = IPrefs->DictGetIntegerForKey(dict, "HotDataPct", 0);
+        ui.bench_options.stride_bytes = IPrefs->DictGetIntegerForKey(dict, "StrideBytes", 0);
+        ui.bench_options.access_seed = IPrefs->DictGetIntegerForKey(dict, "AccessSeed", 0);
+        CONST_STRPTR trace = IPrefs->DictGetStringForKey(dict, "TracePath", "");
+        snprintf(ui.bench_options.trace_path, sizeof(ui.bench_options.trace_path), "%s", trace ? (const char *)trace : "");
+        ui.bench_options.trace_open_loop = IPrefs->DictGetIntegerForKey(dict, "TraceOpenLoop", 0) ? TRUE : FALSE;
+        ui.bench_options.trace_record = IPrefs->DictGetIntegerForKey(dict, "TraceRecord", 0) ? TRUE : FALSE;
+        ui.bench_options.streams = IPrefs->DictGetIntegerForKey(dict, "Streams", 0);
+        ui.bench_options.cache_mode = IPrefs->DictGetIntegerForKey(dict, "CacheMode", CACHE_MODE_NORMAL);
+        ui.bench_options.evict_strategy = IPrefs->DictGetIntegerForKey(dict, "EvictStrategy", EVICT_FILE);
+        ui.bench_options.verify = IPrefs->DictGetIntegerForKey(dict, "Verify", 0) ? TRUE : FALSE;
+        ui.bench_options.data_random_pct = IPrefs->DictGetIntegerForKey(dict, "DataRandomPct", 0);
+        ui.bench_options.buffer_sweep = IPrefs->DictGetIntegerForKey(dict, "BufferSweep", 0) ? TRUE : FALSE;
+        CONST_STRPTR image = IPrefs->DictGetStringForKey(dict, "RawImagePath", "");
+        snprintf(ui.bench_options.raw_image_path, sizeof(ui.bench_options.raw_image_path), "%s",
+                 image ? (const char *)image : "");
         CONST_STRPTR p = IPrefs->DictGetStringForKey(dict, "CSVPath", DEFAULT_CSV_PATH);
         LOG_DEBUG("LoadPrefs: DictGetStringForKey(CSVPath) returned '%s'", (const char *)(p ? p : "NULL"));
         if (p) {
@@ -217,7 +217,10 @@ static void ValidateVizFile(const char *path, struct List *findings,
         }
         if (ci_cmp(current_section, "XAxis") == 0 && ci_cmp(key, "Source") == 0) {
             has_x_source = TRUE;
-            if (ci_cmp(val, "block_size") != 0 && ci_cmp(val, "timestamp") != 0 && ci_cmp(val, "test_index") != 0) {
+            if (ci_cmp(val, "block_size") != 0 && ci_cmp(val, "timestamp") != 0 && ci_cmp(val, "test_index") != 0 &&
+                ci_cmp(val, "working_set") != 0 && ci_cmp(val, "dir_entries") != 0 &&
+                ci_cmp(val, "commit_group") != 0 && ci_cmp(val, "queue_depth") != 0 &&
+                ci_cmp(val, "io_buffer") != 0) {
                 AddFinding(findings, lineno, 'E', "%s:%lu: Unknown XAxis Source '%s'", fname, lineno, val);
                 (*errors)++;
             }
@@ -226,7 +229,10 @@ static void ValidateVizFile(const char *path, struct List *findings,
             has_y_source = TRUE;
             if (ci_cmp(val, "mb_per_sec") != 0 && ci_cmp(val, "iops") != 0 &&
                 ci_cmp(val, "min_mbps") != 0 && ci_cmp(val, "max_mbps") != 0 &&
-                ci_cmp(val, "duration_secs") != 0 && ci_cmp(val, "total_bytes") != 0) {
+                ci_cmp(val, "duration_secs") != 0 && ci_cmp(val, "total_bytes") != 0 &&
+                ci_cmp(val, "create_ops") != 0 && ci_cmp(val, "lookup_ops") != 0 && ci_cmp(val, "scan_ops") != 0 &&
+                ci_cmp(val, "rename_ops") != 0 && ci_cmp(val, "delete_ops") != 0 && ci_cmp(val, "mkdir_ops") != 0 &&
+                ci_cmp(val, "rmdir_ops") != 0) {
                 AddFinding(findings, lineno, 'E', "%s:%lu: Unknown YAxis Source '%s'", fname, lineno, val);
                 (*errors)++;
             }
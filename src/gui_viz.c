@@ -138,6 +138,95 @@ static int compare_by_block_size(const void *a, const void *b)
     return 0;
 }
 
+/**
+ * @brief Comparison function for qsort to sort results by Cache Sweep working set.
+ */
+static int compare_by_working_set(const void *a, const void *b)
+{
+    BenchResult *resA = *(BenchResult **)a;
+    BenchResult *resB = *(BenchResult **)b;
+    if (resA->working_set_bytes < resB->working_set_bytes)
+        return -1;
+    if (resA->working_set_bytes > resB->working_set_bytes)
+        return 1;
+    return 0;
+}
+
+/**
+ * @brief Comparison function for qsort to sort results by Directory Scaling size.
+ */
+static int compare_by_dir_entries(const void *a, const void *b)
+{
+    BenchResult *resA = *(BenchResult **)a;
+    BenchResult *resB = *(BenchResult **)b;
+    if (resA->dir_entries < resB->dir_entries)
+        return -1;
+    if (resA->dir_entries > resB->dir_entries)
+        return 1;
+    return 0;
+}
+
+/**
+ * @brief Comparison function for qsort to sort results by Commit Latency group size.
+ */
+static int compare_by_commit_group(const void *a, const void *b)
+{
+    BenchResult *resA = *(BenchResult **)a;
+    BenchResult *resB = *(BenchResult **)b;
+    if (resA->commit_group < resB->commit_group)
+        return -1;
+    if (resA->commit_group > resB->commit_group)
+        return 1;
+    return 0;
+}
+
+/**
+ * @brief Comparison function for qsort to sort results by Raw Queue Depth depth.
+ */
+static int compare_by_queue_depth(const void *a, const void *b)
+{
+    BenchResult *resA = *(BenchResult **)a;
+    BenchResult *resB = *(BenchResult **)b;
+    if (resA->queue_depth < resB->queue_depth)
+        return -1;
+    if (resA->queue_depth > resB->queue_depth)
+        return 1;
+    return 0;
+}
+
+/**
+ * @brief Comparison function for qsort to sort results by Buffered I/O buffer size (unbuffered first).
+ */
+static int compare_by_io_buffer(const void *a, const void *b)
+{
+    BenchResult *resA = *(BenchResult **)a;
+    BenchResult *resB = *(BenchResult **)b;
+    if (resA->io_buffer < resB->io_buffer)
+        return -1;
+    if (resA->io_buffer > resB->io_buffer)
+        return 1;
+    return 0;
+}
+
+/**
+ * @brief Numeric X value for the value-ordered sources (block size, working set, directory size, group size, depth,
+ * buffer size).
+ */
+static uint64 GetXKey(const BenchResult *res, VizXSource src)
+{
+    if (src == VIZ_SRC_WORKING_SET)
+        return res->working_set_bytes;
+    if (src == VIZ_SRC_DIR_ENTRIES)
+        return res->dir_entries;
+    if (src == VIZ_SRC_COMMIT_GROUP)
+        return res->commit_group;
+    if (src == VIZ_SRC_QUEUE_DEPTH)
+        return res->queue_depth;
+    if (src == VIZ_SRC_IO_BUFFER)
+        return res->io_buffer;
+    return res->block_size;
+}
+
 /**
  * @brief Internal helper to find/create a data series for a given categorical label.
  */
@@ -204,6 +293,7 @@ static const char *AveragingToString(uint32 method)
     switch (method) {
     case AVERAGE_TRIMMED_MEAN: return "TrimmedMean";
     case AVERAGE_MEDIAN:       return "Median";
+    case AVERAGE_ADAPTIVE:     return "Adaptive";
     default:                   return "AllPasses";
     }
 }
@@ -219,7 +309,33 @@ static float GetYValue(BenchResult *res, VizYSource src)
     case VIZ_SRC_MAX_MBPS:      return res->max_mbps;
     case VIZ_SRC_DURATION_SECS: return res->total_duration;
     case VIZ_SRC_TOTAL_BYTES:   return (float)res->cumulative_bytes;
-    default:                    return res->mb_per_sec;
+    default:
+        if (VIZ_SRC_IS_META_OP(src))
+            return MetaOpRate(&res->meta_ops[src - VIZ_SRC_CREATE_OPS]);
+        return res->mb_per_sec;
+    }
+}
+
+/**
+ * @brief Store a collapsed Y value back into the field GetYValue reads it from.
+ */
+static void SetYValue(BenchResult *res, VizYSource src, float y)
+{
+    switch (src) {
+    case VIZ_SRC_IOPS:          res->iops = (uint32)y; break;
+    case VIZ_SRC_MIN_MBPS:      res->min_mbps = y; break;
+    case VIZ_SRC_MAX_MBPS:      res->max_mbps = y; break;
+    case VIZ_SRC_DURATION_SECS: res->total_duration = y; break;
+    case VIZ_SRC_TOTAL_BYTES:   res->cumulative_bytes = (uint64)y; break;
+    default:
+        if (VIZ_SRC_IS_META_OP(src)) {
+            /* Keep the count, rescale the time so count / secs gives y */
+            MetaOpResult *m = &res->meta_ops[src - VIZ_SRC_CREATE_OPS];
+            m->secs = (y > 0.0f) ? (float)m->count / y : 0.0f;
+        } else {
+            res->mb_per_sec = y;
+        }
+        break;
     }
 }
 
@@ -343,7 +459,17 @@ static uint32 CollectVizData(VizData *vd)
 
     /* Sort results within each series based on profile X-axis source */
     for (uint32 i = 0; i < vd->series_count; i++) {
-        if (profile && profile->sort_x_by_value) {
+        if (profile && profile->x_source == VIZ_SRC_WORKING_SET) {
+            qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_working_set);
+        } else if (profile && profile->x_source == VIZ_SRC_DIR_ENTRIES) {
+            qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_dir_entries);
+        } else if (profile && profile->x_source == VIZ_SRC_COMMIT_GROUP) {
+            qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_commit_group);
+        } else if (profile && profile->x_source == VIZ_SRC_QUEUE_DEPTH) {
+            qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_queue_depth);
+        } else if (profile && profile->x_source == VIZ_SRC_IO_BUFFER) {
+            qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_io_buffer);
+        } else if (profile && profile->sort_x_by_value) {
             qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_block_size);
         } else if (profile && profile->x_source == VIZ_SRC_BLOCK_SIZE) {
             qsort(vd->series[i].results, vd->series[i].count, sizeof(BenchResult *), compare_by_block_size);
@@ -362,7 +488,9 @@ static uint32 CollectVizData(VizData *vd)
             VizSeries *s = &vd->series[si];
             if (s->count < 2) continue;
 
-            if (profile->x_source != VIZ_SRC_BLOCK_SIZE) {
+            if (profile->x_source != VIZ_SRC_BLOCK_SIZE && profile->x_source != VIZ_SRC_WORKING_SET &&
+                profile->x_source != VIZ_SRC_DIR_ENTRIES && profile->x_source != VIZ_SRC_COMMIT_GROUP &&
+                profile->x_source != VIZ_SRC_QUEUE_DEPTH && profile->x_source != VIZ_SRC_IO_BUFFER) {
                 /* Non-block_size X: collapse entire series into one point */
                 if (buf_idx >= MAX_SERIES * 200) continue;
                 float y_vals[200];
@@ -371,27 +499,20 @@ static uint32 CollectVizData(VizData *vd)
                     y_vals[k] = GetYValue(s->results[k], ysrc);
                 float collapsed_y = CollapseYValues(y_vals, n, profile->collapse_method);
                 collapsed_buf[buf_idx] = *s->results[0];
-                switch (ysrc) {
-                case VIZ_SRC_IOPS:          collapsed_buf[buf_idx].iops = (uint32)collapsed_y; break;
-                case VIZ_SRC_MIN_MBPS:      collapsed_buf[buf_idx].min_mbps = collapsed_y; break;
-                case VIZ_SRC_MAX_MBPS:      collapsed_buf[buf_idx].max_mbps = collapsed_y; break;
-                case VIZ_SRC_DURATION_SECS: collapsed_buf[buf_idx].total_duration = collapsed_y; break;
-                case VIZ_SRC_TOTAL_BYTES:   collapsed_buf[buf_idx].cumulative_bytes = (uint64)collapsed_y; break;
-                default:                    collapsed_buf[buf_idx].mb_per_sec = collapsed_y; break;
-                }
+                SetYValue(&collapsed_buf[buf_idx], ysrc, collapsed_y);
                 vd->total_points -= (s->count - 1);
                 s->results[0] = &collapsed_buf[buf_idx];
                 s->count = 1;
                 buf_idx++;
             } else {
-                /* Block size X: collapse runs of same block size */
+                /* Block size / working set / directory size / group size X: collapse runs of the same X value */
                 uint32 out = 0;
                 uint32 j = 0;
                 while (j < s->count) {
                     uint32 run_start = j;
-                    uint32 x_key = s->results[j]->block_size;
+                    uint64 x_key = GetXKey(s->results[j], profile->x_source);
                     uint32 run_end = j + 1;
-                    while (run_end < s->count && s->results[run_end]->block_size == x_key)
+                    while (run_end < s->count && GetXKey(s->results[run_end], profile->x_source) == x_key)
                         run_end++;
                     uint32 run_len = run_end - run_start;
 
@@ -406,14 +527,7 @@ static uint32 CollectVizData(VizData *vd)
                         y_vals[k] = GetYValue(s->results[run_start + k], ysrc);
                     float collapsed_y = CollapseYValues(y_vals, run_len, profile->collapse_method);
                     collapsed_buf[buf_idx] = *s->results[run_start];
-                    switch (ysrc) {
-                    case VIZ_SRC_IOPS:          collapsed_buf[buf_idx].iops = (uint32)collapsed_y; break;
-                    case VIZ_SRC_MIN_MBPS:      collapsed_buf[buf_idx].min_mbps = collapsed_y; break;
-                    case VIZ_SRC_MAX_MBPS:      collapsed_buf[buf_idx].max_mbps = collapsed_y; break;
-                    case VIZ_SRC_DURATION_SECS: collapsed_buf[buf_idx].total_duration = collapsed_y; break;
-                    case VIZ_SRC_TOTAL_BYTES:   collapsed_buf[buf_idx].cumulative_bytes = (uint64)collapsed_y; break;
-                    default:                    collapsed_buf[buf_idx].mb_per_sec = collapsed_y; break;
-                    }
+                    SetYValue(&collapsed_buf[buf_idx], ysrc, collapsed_y);
                     s->results[out++] = &collapsed_buf[buf_idx];
                     buf_idx++;
                     j = run_end;
@@ -204,6 +204,24 @@ static const char *GetXLabel(BenchResult *res, VizXSource src, uint32 index, cha
     switch (src) {
     case VIZ_SRC_BLOCK_SIZE:
         return FormatPresetBlockSize(res->block_size);
+    case VIZ_SRC_WORKING_SET:
+        snprintf(buf, buf_size, "%s", FormatByteSize(res->working_set_bytes));
+        return buf;
+    case VIZ_SRC_DIR_ENTRIES:
+        snprintf(buf, buf_size, "%u", (unsigned int)res->dir_entries);
+        return buf;
+    case VIZ_SRC_COMMIT_GROUP:
+        snprintf(buf, buf_size, "%u", (unsigned int)res->commit_group);
+        return buf;
+    case VIZ_SRC_QUEUE_DEPTH:
+        snprintf(buf, buf_size, "QD%u", (unsigned int)res->queue_depth);
+        return buf;
+    case VIZ_SRC_IO_BUFFER:
+        if (res->io_buffer == IO_BUFFER_NONE)
+            snprintf(buf, buf_size, "None");
+        else
+            snprintf(buf, buf_size, "%uK", (unsigned int)(res->io_buffer / 1024));
+        return buf;
     case VIZ_SRC_TIMESTAMP:
         /* Show date portion only (first 10 chars of "YYYY-MM-DD HH:MM:SS") */
         snprintf(buf, buf_size, "%.10s", res->timestamp);
@@ -266,7 +284,10 @@ static float GetYValue(BenchResult *res, VizYSource src)
     case VIZ_SRC_MAX_MBPS:      return res->max_mbps;
     case VIZ_SRC_DURATION_SECS: return res->total_duration;
     case VIZ_SRC_TOTAL_BYTES:   return (float)res->cumulative_bytes;
-    default:                    return res->mb_per_sec;
+    default:
+        if (VIZ_SRC_IS_META_OP(src))
+            return MetaOpRate(&res->meta_ops[src - VIZ_SRC_CREATE_OPS]);
+        return res->mb_per_sec;
     }
 }
 
@@ -477,15 +498,7 @@ static void RenderLineChart(struct RastPort *rp, struct IBox *box, VizData *vd,
             dx = px + (int)((float)i * (float)pw / (float)(vd->series[s].count > 1 ? vd->series[s].count - 1 : 1));
 
             /* Calculate Y position normalized to global maximum */
-            float v;
-            switch (ysrc) {
-            case VIZ_SRC_IOPS:          v = (float)res->iops; break;
-            case VIZ_SRC_MIN_MBPS:      v = res->min_mbps; break;
-            case VIZ_SRC_MAX_MBPS:      v = res->max_mbps; break;
-            case VIZ_SRC_DURATION_SECS: v = res->total_duration; break;
-            case VIZ_SRC_TOTAL_BYTES:   v = (float)res->cumulative_bytes; break;
-            default:                    v = res->mb_per_sec; break;
-            }
+            float v = GetYValue(res, ysrc);
             int dy = py + ph - (int)((v / (max_y > 0 ? max_y : 1)) * (float)ph);
             dx = ClampInt(dx, px, px + pw);
             dy = ClampInt(dy, py, py + ph);
@@ -560,15 +573,7 @@ static void RenderBarChart(struct RastPort *rp, struct IBox *box, VizData *vd, B
         IGraphics->SetAPen(rp, spen);
         for (uint32 i = 0; i < vd->series[s].count; i++) {
             BenchResult *res = vd->series[s].results[i];
-            float v;
-            switch (bysrc) {
-            case VIZ_SRC_IOPS:          v = (float)res->iops; break;
-            case VIZ_SRC_MIN_MBPS:      v = res->min_mbps; break;
-            case VIZ_SRC_MAX_MBPS:      v = res->max_mbps; break;
-            case VIZ_SRC_DURATION_SECS: v = res->total_duration; break;
-            case VIZ_SRC_TOTAL_BYTES:   v = (float)res->cumulative_bytes; break;
-            default:                    v = res->mb_per_sec; break;
-            }
+            float v = GetYValue(res, bysrc);
             int h = (int)((v / (bar_max_y > 0 ? bar_max_y : 1)) * (float)ph);
             if (h > ph) h = ph;
             if (h < 0) h = 0;
@@ -5,12 +5,127 @@
  * Background worker process for executing benchmark jobs asynchronously.
  */
 
+#include "engine_buffer.h"
+#include "engine_cache.h"
+#include "engine_fixture.h"
+#include "engine_workloads.h"
 #include "gui_internal.h"
 #include <stdint.h>
 
 /* Static pointer to GUI reply port for progress callback */
 static struct MsgPort *s_gui_reply_port = NULL;
 
+/* Raw Queue Depth sweep in progress: IOPS per depth, for the saturation point after its deepest job */
+static uint32 s_qd_depths[QUEUE_DEPTH_MAX_LEVELS];
+static float s_qd_iops[QUEUE_DEPTH_MAX_LEVELS];
+static uint32 s_qd_count = 0;
+
+/**
+ * @brief Start a new sweep's series as its shallowest job starts, even if that job then fails.
+ */
+static void StartQueueDepth(const BenchOptions *opts)
+{
+    uint32 levels[QUEUE_DEPTH_MAX_LEVELS];
+    if (GetQueueDepthLevels(levels, QUEUE_DEPTH_MAX_LEVELS) > 0 && opts->queue_depth == levels[0])
+        s_qd_count = 0;
+}
+
+/**
+ * @brief Log a Raw Queue Depth result and, once a sweep reaches its deepest level, its saturation depth.
+ */
+static void TrackQueueDepth(const BenchResult *res)
+{
+    LogUser("      Queue: %u in flight - %u IOPS, p50 %.0f us, p99 %.0f us", (unsigned int)res->queue_depth,
+            (unsigned int)res->iops, res->lat_p50_us, res->lat_p99_us);
+
+    uint32 levels[QUEUE_DEPTH_MAX_LEVELS];
+    uint32 num_levels = GetQueueDepthLevels(levels, QUEUE_DEPTH_MAX_LEVELS);
+    if (s_qd_count < QUEUE_DEPTH_MAX_LEVELS) {
+        s_qd_depths[s_qd_count] = res->queue_depth;
+        s_qd_iops[s_qd_count++] = (float)res->iops;
+    }
+    if (res->queue_depth == levels[num_levels - 1] && s_qd_count > 1) {
+        uint32 saturation = GetQueueDepthSaturation(s_qd_depths, s_qd_iops, s_qd_count);
+        LogUser("      Queue depth saturates at %u requests in flight (%u IOPS at %u, %u at %u)",
+                (unsigned int)saturation, (unsigned int)s_qd_iops[0], (unsigned int)s_qd_depths[0],
+                (unsigned int)s_qd_iops[s_qd_count - 1], (unsigned int)s_qd_depths[s_qd_count - 1]);
+        s_qd_count = 0;
+    }
+}
+
+/* Buffered I/O sweep in progress: the plain Read/Write rate that every buffer is compared with */
+static float s_unbuffered_mbps = 0.0f;
+
+/**
+ * @brief Clear the unbuffered rate as a sweep's Read/Write job starts.
+ *
+ * If that job fails, its buffers are then logged without a comparison rather
+ * than against an earlier sweep, possibly on another volume.
+ */
+static void StartBufferedIo(const BenchOptions *opts)
+{
+    if (opts->io_buffer == IO_BUFFER_NONE)
+        s_unbuffered_mbps = 0.0f;
+}
+
+/**
+ * @brief Log a Buffered I/O result against the unbuffered job of its sweep.
+ */
+static void TrackBufferedIo(const BenchResult *res)
+{
+    if (res->io_buffer == IO_BUFFER_NONE) {
+        s_unbuffered_mbps = res->mb_per_sec;
+        LogUser("      Read/Write: %.2f MB/s, %u calls/s, p50 %.0f us", res->mb_per_sec, (unsigned int)res->iops,
+                res->lat_p50_us);
+    } else if (s_unbuffered_mbps > 0.0f) {
+        LogUser("      FRead/FWrite, %s buffer: %.2f MB/s, %u calls/s (%.1fx Read/Write)",
+                FormatByteSize(res->io_buffer), res->mb_per_sec, (unsigned int)res->iops,
+                res->mb_per_sec / s_unbuffered_mbps);
+    } else {
+        LogUser("      FRead/FWrite, %s buffer: %.2f MB/s, %u calls/s", FormatByteSize(res->io_buffer),
+                res->mb_per_sec, (unsigned int)res->iops);
+    }
+}
+
+/* Buffer alignment sweep in progress: the 8 KB aligned rate of each memory type, for its other offsets */
+static float s_aligned_mbps[BUFFER_MEM_COUNT];
+
+/**
+ * @brief Clear a memory type's aligned rate as its aligned job starts.
+ *
+ * Each sweep then compares against its own aligned job, never one from an
+ * earlier sweep on another volume or block size, even if its own fails.
+ */
+static void StartBufferPlacement(const BenchOptions *opts)
+{
+    if (opts->buffer_offset == 0 && opts->buffer_mem < BUFFER_MEM_COUNT)
+        s_aligned_mbps[opts->buffer_mem] = 0.0f;
+}
+
+/**
+ * @brief Log a buffer-placement result against the aligned job of the same memory type.
+ */
+static void TrackBufferPlacement(const BenchResult *res)
+{
+    if (res->buffer_mem >= BUFFER_MEM_COUNT)
+        return;
+    if (res->buffer_offset == 0) {
+        s_aligned_mbps[res->buffer_mem] = res->mb_per_sec;
+        LogUser("      Buffer: %s memory, 8 KB aligned - %.2f MB/s", BufferMemName(res->buffer_mem), res->mb_per_sec);
+        return;
+    }
+    float aligned = s_aligned_mbps[res->buffer_mem];
+    if (aligned <= 0.0f) {
+        LogUser("      Buffer: %s memory, +%u bytes - %.2f MB/s", BufferMemName(res->buffer_mem),
+                (unsigned int)res->buffer_offset, res->mb_per_sec);
+        return;
+    }
+    float pct = res->mb_per_sec / aligned * 100.0f;
+    LogUser("      Buffer: %s memory, +%u bytes - %.2f MB/s, %.0f%% of aligned%s", BufferMemName(res->buffer_mem),
+            (unsigned int)res->buffer_offset, res->mb_per_sec, pct,
+            (pct < 100.0f - BUFFER_FALLBACK_PCT) ? " - the driver may be bounce buffering" : "");
+}
+
 /**
  * @brief Send progress update to GUI
  *
@@ -84,12 +199,58 @@ void BenchmarkWorker(void)
                                 TestTypeToString(job->type),
                                 (unsigned int)job->num_passes);
                         LogUser("           Target: %s", job->target_path);
+                        if (job->options.duration_secs > 0)
+                            LogUser("           Time-bounded: %u s per pass", (unsigned int)job->options.duration_secs);
+                        if (job->options.dataset_bytes > 0)
+                            LogUser("           Data set: %s", FormatByteSize(job->options.dataset_bytes));
+                        if (job->options.streams > 1)
+                            LogUser("           Streams: %u concurrent", (unsigned int)job->options.streams);
+                        if (job->type == TEST_CACHE_SWEEP && job->options.working_set_bytes > 0)
+                            LogUser("           Working set: %s", FormatByteSize(job->options.working_set_bytes));
+                        if (job->type == TEST_DIR_SCALING && job->options.dir_entries > 0)
+                            LogUser("           Directory: %u entries", (unsigned int)job->options.dir_entries);
+                        if (job->type == TEST_COMMIT_LOG && job->options.commit_group > 0)
+                            LogUser("           Group commit: %u records per flush",
+                                    (unsigned int)job->options.commit_group);
+                        if (job->type == TEST_RAW_QUEUE_DEPTH && job->options.queue_depth > 0)
+                            LogUser("           Queue depth: %u requests in flight",
+                                    (unsigned int)job->options.queue_depth);
+                        if (job->type == TEST_RAW_QUEUE_DEPTH)
+                            StartQueueDepth(&job->options);
+                        if (job->type == TEST_BUFFERED_IO && job->options.io_buffer > IO_BUFFER_NONE)
+                            LogUser("           I/O: FRead/FWrite, %s FOpen buffer",
+                                    FormatByteSize(job->options.io_buffer));
+                        else if (job->type == TEST_BUFFERED_IO)
+                            LogUser("           I/O: Read/Write, unbuffered");
+                        if (job->type == TEST_BUFFERED_IO)
+                            StartBufferedIo(&job->options);
+                        if (job->options.buffer_mem != BUFFER_MEM_DEFAULT) {
+                            LogUser("           Buffers: %s memory, +%u bytes from 8 KB alignment",
+                                    BufferMemName(job->options.buffer_mem), (unsigned int)job->options.buffer_offset);
+                            StartBufferPlacement(&job->options);
+                        }
+                        if (job->options.cache_mode != CACHE_MODE_NORMAL)
+                            LogUser("           Cache: %s, %s eviction", CacheModeName(job->options.cache_mode),
+                                    EvictStrategyName(job->options.evict_strategy));
+                        if (job->options.verify)
+                            LogUser("           Verify: stamping and checking data");
+                        else if (job->options.data_random_pct > 0)
+                            LogUser("           Write data: %u%% random", (unsigned int)job->options.data_random_pct);
+                        if (job->type == TEST_TRACE_REPLAY)
+                            LogUser("           Trace: %s (%s-loop)", job->options.trace_path,
+                                    job->options.trace_open_loop ? "open" : "closed");
+                        else if (job->options.trace_record && job->options.trace_path[0])
+                            LogUser("           Recording trace to %s", job->options.trace_path);
 
                         status->success = RunBenchmark(job->type, job->target_path, job->num_passes, job->block_size,
-                                                       job->averaging_method, job->flush_cache, SendProgressUpdate,
-                                                       &status->result, &status->sample_data);
+                                                       job->averaging_method, job->flush_cache, &job->options,
+                                                       SendProgressUpdate, &status->result, &status->sample_data);
                         status->finished = TRUE;
 
+                        /* Queue drained: remove the data files kept for later jobs */
+                        if (job->last_in_queue)
+                            FixtureCacheFlush();
+
                         /* Clear static pointer */
                         s_gui_reply_port = NULL;
 
@@ -100,6 +261,27 @@ void BenchmarkWorker(void)
                                 TestTypeToString(job->type),
                                 status->result.mb_per_sec,
                                 (unsigned int)status->result.passes);
+                            if (status->result.streams > 0)
+                                LogUser("      Scaling: %u streams - %.2f MB/s total, %.2f MB/s per stream "
+                                        "(slowest %.2f), %u IOPS total",
+                                        (unsigned int)status->result.streams, status->result.mb_per_sec,
+                                        status->result.stream_mbps, status->result.slow_stream_mbps,
+                                        (unsigned int)status->result.iops);
+                            if (status->result.warm_mbps > 0.0f)
+                                LogUser("      Cache: cold %.2f MB/s, warm %.2f MB/s, speed-up %.2fx (%s)",
+                                        status->result.mb_per_sec, status->result.warm_mbps,
+                                        status->result.cache_speedup, status->result.cache_mode);
+                            if (status->result.verify_bytes > 0)
+                                LogUser("      Verify: %s checked in %.2f s, %u bad sectors%s",
+                                        FormatByteSize(status->result.verify_bytes), status->result.verify_secs,
+                                        (unsigned int)status->result.verify_errors,
+                                        status->result.verify_errors ? " - DATA CORRUPTION" : "");
+                            if (status->result.queue_depth > 0)
+                                TrackQueueDepth(&status->result);
+                            if (status->result.io_buffer > 0)
+                                TrackBufferedIo(&status->result);
+                            if (status->result.buffer_mem != BUFFER_MEM_DEFAULT)
+                                TrackBufferPlacement(&status->result);
                         } else {
                             snprintf(status->status_text, sizeof(status->status_text), "Failed");
                             LogUser("FAILED: %s on %s (see errors above for details)",
@@ -152,10 +334,69 @@ void LaunchBenchmarkJob(void)
         IIntuition->GetAttr(INTEGER_Number, ui.pass_gad, &passes);
     }
 
+    /* Concurrent streams run as a scaling curve: one job each for N = 1, 2, 4, ... up to the configured count */
+    uint32 stream_levels[STREAMS_MAX_LEVELS];
+    uint32 num_levels = 0;
+    if (ui.bench_options.streams > 1)
+        num_levels = GetStreamLevels(ui.bench_options.streams, stream_levels, STREAMS_MAX_LEVELS);
+    else
+        stream_levels[num_levels++] = 0;
+
+    /* A Cache Sweep is one job per working-set size, all reading one file sized for the largest */
+    uint64 ws_levels[CACHE_SWEEP_MAX_LEVELS];
+    uint32 num_ws = 0;
+    if (test_type_idx == TEST_CACHE_SWEEP && ui.bench_options.working_set_bytes == 0) {
+        num_ws = GetCacheSweepLevels(path, ui.bench_options.dataset_bytes, ws_levels, CACHE_SWEEP_MAX_LEVELS);
+        num_levels = num_ws;
+    }
+
+    /* Directory Scaling is one job per directory size */
+    uint32 dir_levels[DIR_SCALING_MAX_LEVELS];
+    uint32 num_dirs = 0;
+    if (test_type_idx == TEST_DIR_SCALING && ui.bench_options.dir_entries == 0) {
+        num_dirs = GetDirScalingLevels(path, dir_levels, DIR_SCALING_MAX_LEVELS);
+        num_levels = num_dirs;
+    }
+
+    /* Commit Latency is one job per group-commit size */
+    uint32 commit_levels[COMMIT_MAX_LEVELS];
+    uint32 num_commits = 0;
+    if (test_type_idx == TEST_COMMIT_LOG && ui.bench_options.commit_group == 0) {
+        num_commits = GetCommitGroupLevels(commit_levels, COMMIT_MAX_LEVELS);
+        num_levels = num_commits;
+    }
+
+    /* Raw Queue Depth is one job per depth */
+    uint32 qd_levels[QUEUE_DEPTH_MAX_LEVELS];
+    uint32 num_qd = 0;
+    if (test_type_idx == TEST_RAW_QUEUE_DEPTH && ui.bench_options.queue_depth == 0) {
+        num_qd = GetQueueDepthLevels(qd_levels, QUEUE_DEPTH_MAX_LEVELS);
+        num_levels = num_qd;
+    }
+
+    /* Buffered I/O is one job per buffer size, plain Read/Write first */
+    uint32 buf_levels[IO_BUFFER_MAX_LEVELS];
+    uint32 num_bufs = 0;
+    if (test_type_idx == TEST_BUFFERED_IO && ui.bench_options.io_buffer == 0) {
+        num_bufs = GetIoBufferLevels(buf_levels, IO_BUFFER_MAX_LEVELS);
+        num_levels = num_bufs;
+    }
+
+    /* The buffer alignment sweep is one job per memory type and offset, for the tests that place their buffers */
+    uint32 offset_levels[BUFFER_OFFSET_MAX_LEVELS];
+    uint32 num_offsets = 0;
+    uint32 num_placements = 0;
+    const BenchWorkload *workload = GetWorkloadByType((BenchTestType)test_type_idx);
+    if (ui.bench_options.buffer_sweep && workload && (workload->flags & WORKLOAD_F_BUFFER_PLACEMENT)) {
+        num_offsets = GetBufferOffsetLevels(offset_levels, BUFFER_OFFSET_MAX_LEVELS);
+        num_placements = num_offsets * (BUFFER_MEM_COUNT - BUFFER_MEM_SHARED);
+        num_levels = num_placements;
+    }
+
     /* Update Visual Indicators */
 
     /* Increment total_jobs to support appending to an active queue (cumulative progress) */
-    ui.total_jobs++;
+    ui.total_jobs += num_levels;
     /* ui.completed_jobs preserves its value */
 
     if (ui.fuel_gauge) {
@@ -182,26 +423,48 @@ void LaunchBenchmarkJob(void)
     }
 
     /* Force Block Size to 0 (Mixed) for fixed-behavior tests */
-    if (test_type_idx == TEST_DAILY_GRIND || test_type_idx == TEST_PROFILER) {
+    if (test_type_idx == TEST_DAILY_GRIND || test_type_idx == TEST_PROFILER || test_type_idx == TEST_DIR_SCALING ||
+        test_type_idx == TEST_BUFFERED_IO) {
         block_val = 0;
     }
 
     LOG_DEBUG("LaunchJob: path='%s', test=%u, passes=%u, block_val=%u, avg_method=%u", path, (unsigned int)test_type_idx,
               passes, block_val, (unsigned int)ui.averaging_method);
 
-    BenchJob *job = IExec->AllocVecTags(sizeof(BenchJob), AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
-    if (job) {
-        job->msg_type = MSG_TYPE_JOB;
-        job->type = (BenchTestType)test_type_idx;
-        snprintf(job->target_path, sizeof(job->target_path), "%s", path);
-        job->target_path[sizeof(job->target_path) - 1] = '\0';
-        job->num_passes = passes;
-        job->block_size = block_val;
-        job->averaging_method = ui.averaging_method;
-        job->flush_cache = ui.flush_cache;
-        job->msg.mn_ReplyPort = ui.worker_reply_port;
-
-        /* Queue the job instead of sending directly */
-        EnqueueBenchmarkJob(job);
+    for (uint32 l = 0; l < num_levels; l++) {
+        BenchJob *job =
+            IExec->AllocVecTags(sizeof(BenchJob), AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
+        if (job) {
+            job->msg_type = MSG_TYPE_JOB;
+            job->type = (BenchTestType)test_type_idx;
+            snprintf(job->target_path, sizeof(job->target_path), "%s", path);
+            job->target_path[sizeof(job->target_path) - 1] = '\0';
+            job->num_passes = passes;
+            job->block_size = block_val;
+            job->averaging_method = ui.averaging_method;
+            job->flush_cache = ui.flush_cache;
+            job->options = ui.bench_options;
+            if (num_ws > 0) {
+                job->options.working_set_bytes = ws_levels[l];
+                job->options.dataset_bytes = ws_levels[num_ws - 1];
+            } else if (num_dirs > 0) {
+                job->options.dir_entries = dir_levels[l];
+            } else if (num_commits > 0) {
+                job->options.commit_group = commit_levels[l];
+            } else if (num_qd > 0) {
+                job->options.queue_depth = qd_levels[l];
+            } else if (num_bufs > 0) {
+                job->options.io_buffer = buf_levels[l];
+            } else if (num_placements > 0) {
+                job->options.buffer_mem = BUFFER_MEM_SHARED + l / num_offsets;
+                job->options.buffer_offset = offset_levels[l % num_offsets];
+            } else {
+                job->options.streams = stream_levels[l];
+            }
+            job->msg.mn_ReplyPort = ui.worker_reply_port;
+
+            /* Queue the job instead of sending directly */
+            EnqueueBenchmarkJob(job);
+        }
     }
 }
@@ -0,0 +1,314 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * AmigaOS 4 platform layer: dos.library, exec memory and timer.device.
+ */
+
+#include "platform.h"
+#include "debug.h"
+#include <proto/timer.h>
+
+/* Global library bases and interfaces */
+static struct Device *BenchTimerBase = NULL;
+static struct TimerIFace *IBenchTimer = NULL;
+static struct MsgPort *BenchTimerPort = NULL;
+static struct TimeRequest *BenchTimerReq = NULL;
+
+/*
+ * Opens timer.device for the engine's EClock.
+ */
+BOOL PlatInit(void)
+{
+    BenchTimerPort = IExec->AllocSysObjectTags(ASOT_PORT, TAG_DONE);
+    if (BenchTimerPort) {
+        BenchTimerReq = (struct TimeRequest *)IExec->AllocSysObjectTags(
+            ASOT_IOREQUEST, ASOIOR_Size, sizeof(struct TimeRequest), ASOIOR_ReplyPort, BenchTimerPort, TAG_DONE);
+        if (BenchTimerReq) {
+            if (IExec->OpenDevice("timer.device", UNIT_MICROHZ, (struct IORequest *)BenchTimerReq, 0) == 0) {
+                BenchTimerBase = (struct Device *)BenchTimerReq->Request.io_Device;
+                IBenchTimer =
+                    (struct TimerIFace *)IExec->GetInterface((struct Library *)BenchTimerBase, "main", 1, NULL);
+                if (IBenchTimer)
+                    return TRUE;
+                LOG_DEBUG("FAILED to get Timer interface");
+            } else {
+                LOG_DEBUG("FAILED to open timer.device");
+            }
+        } else {
+            LOG_DEBUG("FAILED to allocate TimeRequest");
+        }
+    } else {
+        LOG_DEBUG("FAILED to allocate TimerPort");
+    }
+    PlatCleanup();
+    return FALSE;
+}
+
+/*
+ * Safe to call even if partially initialized.
+ */
+void PlatCleanup(void)
+{
+    if (IBenchTimer) {
+        IExec->DropInterface((struct Interface *)IBenchTimer);
+        IBenchTimer = NULL;
+    }
+    if (BenchTimerBase) {
+        IExec->CloseDevice((struct IORequest *)BenchTimerReq);
+        BenchTimerBase = NULL;
+    }
+    if (BenchTimerReq) {
+        IExec->FreeSysObject(ASOT_IOREQUEST, BenchTimerReq);
+        BenchTimerReq = NULL;
+    }
+    if (BenchTimerPort) {
+        IExec->FreeSysObject(ASOT_PORT, BenchTimerPort);
+        BenchTimerPort = NULL;
+    }
+}
+
+/* --- Files --- */
+
+PlatFile PlatOpen(const char *path, uint32 mode)
+{
+    static const int32 dos_modes[] = {MODE_OLDFILE, MODE_NEWFILE, MODE_READWRITE};
+    return IDOS->Open(path, dos_modes[mode]);
+}
+
+void PlatClose(PlatFile file)
+{
+    IDOS->Close(file);
+}
+
+int32 PlatRead(PlatFile file, void *buffer, uint32 length)
+{
+    return IDOS->Read(file, buffer, length);
+}
+
+int32 PlatWrite(PlatFile file, const void *buffer, uint32 length)
+{
+    return IDOS->Write(file, buffer, length);
+}
+
+PlatFile PlatFOpen(const char *path, uint32 mode, uint32 buffer_size)
+{
+    static const int32 dos_modes[] = {MODE_OLDFILE, MODE_NEWFILE, MODE_READWRITE};
+    return IDOS->FOpen(path, dos_modes[mode], buffer_size);
+}
+
+BOOL PlatFClose(PlatFile file)
+{
+    return IDOS->FClose(file) ? TRUE : FALSE;
+}
+
+int32 PlatFRead(PlatFile file, void *buffer, uint32 length)
+{
+    /* FRead counts blocks; one-byte blocks make that a byte count */
+    return (int32)IDOS->FRead(file, buffer, 1, length);
+}
+
+int32 PlatFWrite(PlatFile file, const void *buffer, uint32 length)
+{
+    return (int32)IDOS->FWrite(file, buffer, 1, length);
+}
+
+BOOL PlatSeek(PlatFile file, uint64 offset)
+{
+    /* ChangeFilePosition returns the old position, not a success flag.
+     * A return of -1 indicates error; any other value (including 0) is valid. */
+    return (IDOS->ChangeFilePosition(file, offset, OFFSET_BEGINNING) != -1);
+}
+
+BOOL PlatSyncFile(PlatFile file, const char *path)
+{
+    if (!IDOS->FFlush(file))
+        return FALSE;
+    return IDOS->FlushVolume(path) ? TRUE : FALSE;
+}
+
+BOOL PlatDelete(const char *path)
+{
+    return IDOS->Delete(path) ? TRUE : FALSE;
+}
+
+BOOL PlatRename(const char *from, const char *to)
+{
+    return IDOS->Rename(from, to) ? TRUE : FALSE;
+}
+
+BOOL PlatCreateDir(const char *path)
+{
+    BPTR lock = IDOS->CreateDir(path);
+    if (!lock)
+        lock = IDOS->Lock(path, SHARED_LOCK);
+    if (!lock)
+        return FALSE;
+    IDOS->UnLock(lock);
+    return TRUE;
+}
+
+BOOL PlatExists(const char *path)
+{
+    BPTR lock = IDOS->Lock(path, SHARED_LOCK);
+    if (!lock)
+        return FALSE;
+    IDOS->UnLock(lock);
+    return TRUE;
+}
+
+int32 PlatScanDir(const char *path)
+{
+    APTR context = IDOS->ObtainDirContextTags(EX_StringNameInput, path, EX_DataFields, EXF_NAME, TAG_DONE);
+    if (!context)
+        return -1;
+
+    int32 entries = 0;
+    while (IDOS->ExamineDir(context))
+        entries++;
+    BOOL complete = (IDOS->IoErr() == ERROR_NO_MORE_ENTRIES);
+    IDOS->ReleaseDirContext(context);
+    return complete ? entries : -1;
+}
+
+BOOL PlatFlushVolume(const char *path)
+{
+    /* Modern OS4 approach (dos.library 53.58+) */
+    return IDOS->FlushVolume(path) ? TRUE : FALSE;
+}
+
+/* "DH0:" for a path on any volume, as Inhibit and AddBuffers expect */
+static BOOL DeviceOfPath(const char *path, char *out, uint32 size)
+{
+    BPTR lock = IDOS->Lock(path, SHARED_LOCK);
+    if (!lock)
+        return FALSE;
+    BOOL ok = IDOS->DevNameFromLock(lock, out, size, DN_DEVICEONLY) ? TRUE : FALSE;
+    IDOS->UnLock(lock);
+    return ok;
+}
+
+BOOL PlatInhibit(const char *path, BOOL inhibit)
+{
+    char device[64];
+    if (!DeviceOfPath(path, device, sizeof(device)))
+        return FALSE;
+    return IDOS->Inhibit(device, inhibit ? DOSTRUE : DOSFALSE) ? TRUE : FALSE;
+}
+
+BOOL PlatDropVolumeCache(const char *path)
+{
+    char device[64];
+    if (!DeviceOfPath(path, device, sizeof(device)))
+        return FALSE;
+
+    /* AddBuffers(0) reports the current pool size in IoErr(); shrinking to one buffer discards the rest */
+    if (!IDOS->AddBuffers(device, 0))
+        return FALSE;
+    int32 buffers = IDOS->IoErr();
+    if (buffers <= 1)
+        return FALSE;
+    if (!IDOS->AddBuffers(device, -(buffers - 1)))
+        return FALSE;
+    return IDOS->AddBuffers(device, buffers - 1) ? TRUE : FALSE;
+}
+
+/* --- Memory --- */
+
+void *PlatAlloc(uint32 size)
+{
+    return IExec->AllocVecTags(size, AVT_Type, MEMF_SHARED, TAG_DONE);
+}
+
+void *PlatAllocClear(uint32 size)
+{
+    return IExec->AllocVecTags(size, AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
+}
+
+void *PlatAllocAligned(uint32 size, uint32 align, uint32 mem_type)
+{
+    BOOL locked = (mem_type == PLAT_MEM_LOCKED);
+    return IExec->AllocVecTags(size, AVT_Type, (mem_type == PLAT_MEM_PRIVATE) ? MEMF_PRIVATE : MEMF_SHARED,
+                               AVT_Alignment, align, AVT_Contiguous, locked, AVT_Lock, locked, TAG_DONE);
+}
+
+void PlatFree(void *mem)
+{
+    IExec->FreeVec(mem);
+}
+
+uint64 PlatAvailMemory(void)
+{
+    return IExec->AvailMem(MEMF_ANY);
+}
+
+/* --- Time --- */
+
+uint64 PlatReadTicks(void)
+{
+    struct EClockVal ev = {0, 0};
+    if (IBenchTimer)
+        IBenchTimer->ReadEClock(&ev);
+    return ((uint64)ev.ev_hi << 32) | ev.ev_lo;
+}
+
+uint64 PlatTickFrequency(void)
+{
+    struct EClockVal ev;
+    return IBenchTimer ? IBenchTimer->ReadEClock(&ev) : 0;
+}
+
+void PlatSleepMicros(uint32 micros)
+{
+    uint32 ticks = micros / 20000; /* 1/50 s */
+    if (ticks > 0)
+        IDOS->Delay(ticks);
+}
+
+/* --- Processes and messages --- */
+
+PlatPort *PlatCreatePort(void)
+{
+    return (struct MsgPort *)IExec->AllocSysObject(ASOT_PORT, NULL);
+}
+
+void PlatDeletePort(PlatPort *port)
+{
+    IExec->FreeSysObject(ASOT_PORT, port);
+}
+
+void PlatInitMsg(PlatMsg *msg, PlatPort *reply_port, uint32 length)
+{
+    msg->mn_ReplyPort = reply_port;
+    msg->mn_Length = length;
+}
+
+void PlatPutMsg(PlatPort *port, PlatMsg *msg)
+{
+    IExec->PutMsg(port, msg);
+}
+
+PlatMsg *PlatWaitMsg(PlatPort *port)
+{
+    PlatMsg *msg;
+    while (!(msg = IExec->GetMsg(port)))
+        IExec->WaitPort(port);
+    return msg;
+}
+
+void PlatReplyMsg(PlatMsg *msg)
+{
+    IExec->ReplyMsg(msg);
+}
+
+PlatPort *PlatStartProcess(const char *name, void (*entry)(void), uint32 stack_size)
+{
+    struct Process *proc = IDOS->CreateNewProcTags(NP_Entry, (uint32)entry, NP_Name, (uint32)name, NP_Child, TRUE,
+                                                   NP_StackSize, stack_size, TAG_DONE);
+    return proc ? &proc->pr_MsgPort : NULL;
+}
+
+PlatPort *PlatOwnPort(void)
+{
+    return &((struct Process *)IExec->FindTask(NULL))->pr_MsgPort;
+}
@@ -0,0 +1,404 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ *
+ * POSIX platform layer for the host build: file descriptors, malloc,
+ * CLOCK_MONOTONIC and pthreads.
+ */
+
+#define _GNU_SOURCE
+#include "platform.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+struct PlatPort
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    PlatMsg *head;
+    PlatMsg *tail;
+};
+
+/* Port of the calling thread, set for threads started by PlatStartProcess */
+static __thread PlatPort *own_port = NULL;
+
+BOOL PlatInit(void)
+{
+    return TRUE;
+}
+
+void PlatCleanup(void)
+{
+}
+
+/* --- Files --- */
+
+/* Handles are descriptor + 1, so 0 means "not open" as with a BPTR */
+PlatFile PlatOpen(const char *path, uint32 mode)
+{
+    static const int flags[] = {O_RDWR, O_RDWR | O_CREAT | O_TRUNC, O_RDWR | O_CREAT};
+    int fd = open(path, flags[mode], 0644);
+    if (fd < 0 && mode == PLAT_OPEN_EXISTING)
+        fd = open(path, O_RDONLY); /* MODE_OLDFILE also opens read-only files */
+    return (fd < 0) ? 0 : (PlatFile)fd + 1;
+}
+
+void PlatClose(PlatFile file)
+{
+    if (file)
+        close((int)(file - 1));
+}
+
+int32 PlatRead(PlatFile file, void *buffer, uint32 length)
+{
+    ssize_t got;
+    do {
+        got = read((int)(file - 1), buffer, length);
+    } while (got < 0 && errno == EINTR);
+    return (got < 0) ? -1 : (int32)got;
+}
+
+int32 PlatWrite(PlatFile file, const void *buffer, uint32 length)
+{
+    ssize_t put;
+    do {
+        put = write((int)(file - 1), buffer, length);
+    } while (put < 0 && errno == EINTR);
+    return (put < 0) ? -1 : (int32)put;
+}
+
+/* Buffered handles are stdio streams; a FILE pointer fits the long of a PlatFile */
+PlatFile PlatFOpen(const char *path, uint32 mode, uint32 buffer_size)
+{
+    PlatFile raw = PlatOpen(path, mode);
+    if (!raw)
+        return 0;
+    FILE *fp = fdopen((int)(raw - 1), "r+b");
+    if (!fp)
+        fp = fdopen((int)(raw - 1), "rb"); /* Opened read-only by PlatOpen */
+    if (!fp) {
+        PlatClose(raw);
+        return 0;
+    }
+    if (buffer_size > 0)
+        setvbuf(fp, NULL, _IOFBF, buffer_size);
+    return (PlatFile)fp;
+}
+
+BOOL PlatFClose(PlatFile file)
+{
+    return (fclose((FILE *)file) == 0);
+}
+
+int32 PlatFRead(PlatFile file, void *buffer, uint32 length)
+{
+    return (int32)fread(buffer, 1, length, (FILE *)file);
+}
+
+int32 PlatFWrite(PlatFile file, const void *buffer, uint32 length)
+{
+    return (int32)fwrite(buffer, 1, length, (FILE *)file);
+}
+
+BOOL PlatSeek(PlatFile file, uint64 offset)
+{
+    return (lseek((int)(file - 1), (off_t)offset, SEEK_SET) != (off_t)-1);
+}
+
+BOOL PlatSyncFile(PlatFile file, const char *path)
+{
+    (void)path;
+    int rc;
+    do {
+        rc = fdatasync((int)(file - 1));
+    } while (rc < 0 && errno == EINTR);
+    return (rc == 0);
+}
+
+BOOL PlatDelete(const char *path)
+{
+    return (remove(path) == 0);
+}
+
+BOOL PlatRename(const char *from, const char *to)
+{
+    /* dos.library refuses to replace an existing file; keep that behaviour */
+    if (access(to, F_OK) == 0)
+        return FALSE;
+    return (rename(from, to) == 0);
+}
+
+BOOL PlatCreateDir(const char *path)
+{
+    struct stat st;
+    if (mkdir(path, 0755) == 0)
+        return TRUE;
+    return (errno == EEXIST && stat(path, &st) == 0 && S_ISDIR(st.st_mode));
+}
+
+BOOL PlatExists(const char *path)
+{
+    struct stat st;
+    return (stat(path, &st) == 0);
+}
+
+int32 PlatScanDir(const char *path)
+{
+    DIR *dir = opendir(path);
+    if (!dir)
+        return -1;
+
+    /* ExamineDir does not return "." and ".." */
+    int32 entries = 0;
+    struct dirent *entry;
+    while ((entry = readdir(dir)) != NULL) {
+        if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+            entries++;
+    }
+    closedir(dir);
+    return entries;
+}
+
+BOOL PlatFlushVolume(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return FALSE;
+    int rc = syncfs(fd);
+    close(fd);
+    return (rc == 0);
+}
+
+BOOL PlatInhibit(const char *path, BOOL inhibit)
+{
+    /* Unmounting needs root and an idle filesystem; not attempted on a host */
+    (void)path;
+    (void)inhibit;
+    return FALSE;
+}
+
+/* posix_fadvise(DONTNEED) on every file below dir; returns the number of files advised */
+static uint32 AdviseDontNeed(const char *dir, uint32 depth)
+{
+    DIR *d = opendir(dir);
+    if (!d)
+        return 0;
+
+    uint32 count = 0;
+    struct dirent *e;
+    while ((e = readdir(d))) {
+        if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0)
+            continue;
+        char path[4096];
+        snprintf(path, sizeof(path), "%s/%s", dir, e->d_name);
+        struct stat st;
+        if (lstat(path, &st) != 0)
+            continue;
+        if (S_ISDIR(st.st_mode) && depth > 0) {
+            count += AdviseDontNeed(path, depth - 1);
+        } else if (S_ISREG(st.st_mode)) {
+            int fd = open(path, O_RDONLY);
+            if (fd >= 0) {
+                if (posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED) == 0)
+                    count++;
+                close(fd);
+            }
+        }
+    }
+    closedir(d);
+    return count;
+}
+
+BOOL PlatDropVolumeCache(const char *path)
+{
+    PlatFlushVolume(path);
+
+    /* The whole page cache when running as root ... */
+    int fd = open("/proc/sys/vm/drop_caches", O_WRONLY);
+    if (fd >= 0) {
+        BOOL ok = (write(fd, "1", 1) == 1);
+        close(fd);
+        if (ok)
+            return TRUE;
+    }
+
+    /* ... otherwise the cached pages of the benchmark's own files (the target and its stream directories) */
+    return (AdviseDontNeed(path, 1) > 0);
+}
+
+/* --- Memory --- */
+
+void *PlatAlloc(uint32 size)
+{
+    return malloc(size ? size : 1);
+}
+
+void *PlatAllocClear(uint32 size)
+{
+    return calloc(1, size ? size : 1);
+}
+
+void *PlatAllocAligned(uint32 size, uint32 align, uint32 mem_type)
+{
+    (void)mem_type;
+    void *mem = NULL;
+    if (align < sizeof(void *))
+        align = sizeof(void *);
+    return (posix_memalign(&mem, align, size ? size : 1) == 0) ? mem : NULL;
+}
+
+void PlatFree(void *mem)
+{
+    free(mem);
+}
+
+uint64 PlatAvailMemory(void)
+{
+    long pages = sysconf(_SC_AVPHYS_PAGES);
+    long page_size = sysconf(_SC_PAGESIZE);
+    return (pages > 0 && page_size > 0) ? (uint64)pages * (uint64)page_size : 0;
+}
+
+/* --- Time --- */
+
+uint64 PlatReadTicks(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000000ULL + (uint64)ts.tv_nsec;
+}
+
+uint64 PlatTickFrequency(void)
+{
+    return 1000000000ULL;
+}
+
+void PlatSleepMicros(uint32 micros)
+{
+    struct timespec ts = {micros / 1000000, (long)(micros % 1000000) * 1000};
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+        ;
+}
+
+/* --- Processes and messages --- */
+
+PlatPort *PlatCreatePort(void)
+{
+    PlatPort *port = calloc(1, sizeof(PlatPort));
+    if (!port)
+        return NULL;
+    pthread_mutex_init(&port->lock, NULL);
+    pthread_cond_init(&port->cond, NULL);
+    return port;
+}
+
+void PlatDeletePort(PlatPort *port)
+{
+    if (!port)
+        return;
+    pthread_cond_destroy(&port->cond);
+    pthread_mutex_destroy(&port->lock);
+    free(port);
+}
+
+void PlatInitMsg(PlatMsg *msg, PlatPort *reply_port, uint32 length)
+{
+    (void)length;
+    msg->next = NULL;
+    msg->reply_port = reply_port;
+}
+
+void PlatPutMsg(PlatPort *port, PlatMsg *msg)
+{
+    pthread_mutex_lock(&port->lock);
+    msg->next = NULL;
+    if (port->tail)
+        port->tail->next = msg;
+    else
+        port->head = msg;
+    port->tail = msg;
+    pthread_cond_signal(&port->cond);
+    pthread_mutex_unlock(&port->lock);
+}
+
+PlatMsg *PlatWaitMsg(PlatPort *port)
+{
+    pthread_mutex_lock(&port->lock);
+    while (!port->head)
+        pthread_cond_wait(&port->cond, &port->lock);
+    PlatMsg *msg = port->head;
+    port->head = msg->next;
+    if (!port->head)
+        port->tail = NULL;
+    pthread_mutex_unlock(&port->lock);
+    return msg;
+}
+
+void PlatReplyMsg(PlatMsg *msg)
+{
+    if (msg->reply_port)
+        PlatPutMsg(msg->reply_port, msg);
+}
+
+typedef struct
+{
+    void (*entry)(void);
+    PlatPort *port;
+} ProcStart;
+
+static void *ProcessTrampoline(void *arg)
+{
+    ProcStart start = *(ProcStart *)arg;
+    free(arg);
+
+    own_port = start.port;
+    start.entry();
+
+    /* Like a process's pr_MsgPort, the port goes away with the process; the parent
+     * stops using it once its last command has been replied */
+    PlatDeletePort(start.port);
+    return NULL;
+}
+
+/* Host threads keep the default stack, which is far larger than an AmigaOS process needs */
+PlatPort *PlatStartProcess(const char *name, void (*entry)(void), uint32 stack_size)
+{
+    (void)name;
+    (void)stack_size;
+    ProcStart *start = malloc(sizeof(ProcStart));
+    PlatPort *port = PlatCreatePort();
+    if (!start || !port) {
+        free(start);
+        PlatDeletePort(port);
+        return NULL;
+    }
+    start->entry = entry;
+    start->port = port;
+
+    pthread_attr_t attr;
+    pthread_t thread;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    int rc = pthread_create(&thread, &attr, ProcessTrampoline, start);
+    pthread_attr_destroy(&attr);
+
+    if (rc != 0) {
+        free(start);
+        PlatDeletePort(port);
+        return NULL;
+    }
+    return port;
+}
+
+PlatPort *PlatOwnPort(void)
+{
+    return own_port;
+}
@@ -83,6 +83,11 @@ static VizXSource ParseXSource(const char *val)
     if (StrCaseCmp(val, "block_size") == 0)  return VIZ_SRC_BLOCK_SIZE;
     if (StrCaseCmp(val, "timestamp") == 0)   return VIZ_SRC_TIMESTAMP;
     if (StrCaseCmp(val, "test_index") == 0)  return VIZ_SRC_TEST_INDEX;
+    if (StrCaseCmp(val, "working_set") == 0) return VIZ_SRC_WORKING_SET;
+    if (StrCaseCmp(val, "dir_entries") == 0) return VIZ_SRC_DIR_ENTRIES;
+    if (StrCaseCmp(val, "commit_group") == 0) return VIZ_SRC_COMMIT_GROUP;
+    if (StrCaseCmp(val, "queue_depth") == 0) return VIZ_SRC_QUEUE_DEPTH;
+    if (StrCaseCmp(val, "io_buffer") == 0) return VIZ_SRC_IO_BUFFER;
     return VIZ_SRC_TEST_INDEX; /* default */
 }
 
@@ -94,6 +99,13 @@ static VizYSource ParseYSource(const char *val)
     if (StrCaseCmp(val, "max_mbps") == 0)      return VIZ_SRC_MAX_MBPS;
     if (StrCaseCmp(val, "duration_secs") == 0) return VIZ_SRC_DURATION_SECS;
     if (StrCaseCmp(val, "total_bytes") == 0)   return VIZ_SRC_TOTAL_BYTES;
+    if (StrCaseCmp(val, "create_ops") == 0)    return VIZ_SRC_CREATE_OPS;
+    if (StrCaseCmp(val, "lookup_ops") == 0)    return VIZ_SRC_LOOKUP_OPS;
+    if (StrCaseCmp(val, "scan_ops") == 0)      return VIZ_SRC_SCAN_OPS;
+    if (StrCaseCmp(val, "rename_ops") == 0)    return VIZ_SRC_RENAME_OPS;
+    if (StrCaseCmp(val, "delete_ops") == 0)    return VIZ_SRC_DELETE_OPS;
+    if (StrCaseCmp(val, "mkdir_ops") == 0)     return VIZ_SRC_MKDIR_OPS;
+    if (StrCaseCmp(val, "rmdir_ops") == 0)     return VIZ_SRC_RMDIR_OPS;
     return VIZ_SRC_MB_PER_SEC; /* default */
 }
 
@@ -254,7 +266,9 @@ static BOOL ParseVizFile(const char *path, VizProfile *profile)
             {
                 profile->x_source = ParseXSource(val);
                 /* Adjust sort default based on source */
-                if (profile->x_source != VIZ_SRC_BLOCK_SIZE)
+                if (profile->x_source != VIZ_SRC_BLOCK_SIZE && profile->x_source != VIZ_SRC_WORKING_SET &&
+                    profile->x_source != VIZ_SRC_DIR_ENTRIES && profile->x_source != VIZ_SRC_COMMIT_GROUP &&
+                    profile->x_source != VIZ_SRC_QUEUE_DEPTH && profile->x_source != VIZ_SRC_IO_BUFFER)
                     profile->sort_x_by_value = FALSE;
             }
             else if (StrCaseCmp(key, "Label") == 0)
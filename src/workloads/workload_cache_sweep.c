@@ -0,0 +1,247 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ */
+
+#include "engine_internal.h"
+#include "engine_access.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
+#include "workload_interface.h"
+
+#define CACHE_SWEEP_DEFAULT_BLOCK (64 * 1024)
+#define CACHE_SWEEP_MIN_BYTES (64ULL * 1024)             /* First working set of a sweep */
+#define CACHE_SWEEP_STEP 4                               /* Each working set is 4x the previous one */
+#define CACHE_SWEEP_MAX_BYTES (4096ULL * 1024 * 1024)    /* Largest working set derived from free memory */
+#define CACHE_SWEEP_RAM_MAX_BYTES (32ULL * 1024 * 1024)  /* RAM: is all cache; keep its file small */
+#define CACHE_SWEEP_PASS_BYTES (64ULL * 1024 * 1024)     /* Minimum data read per pass */
+#define CACHE_SWEEP_FILL_CHUNK (256 * 1024)
+#define CACHE_SWEEP_SECTOR_ALIGN 512
+
+struct CacheSweepData
+{
+    char file_path[MAX_PATH_LEN * 2];
+    PlatFile file;
+    uint8 *buffer;
+    uint64 file_size;
+    uint64 working_set;
+    uint32 block_size;
+    uint32 num_ios;
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+    OffsetGenerator offsets;
+    VerifyState verify;
+};
+
+uint32 GetCacheSweepLevels(const char *target_path, uint64 max_bytes, uint64 *levels, uint32 max_levels)
+{
+    uint64 top = max_bytes;
+    if (top == 0) {
+        top = PlatAvailMemory() * 2;
+        if (top > CACHE_SWEEP_MAX_BYTES)
+            top = CACHE_SWEEP_MAX_BYTES;
+        if (strncasecmp(target_path, "RAM:", 4) == 0)
+            top = CACHE_SWEEP_RAM_MAX_BYTES;
+    }
+    if (top < CACHE_SWEEP_MIN_BYTES)
+        top = CACHE_SWEEP_MIN_BYTES;
+
+    uint32 count = 0;
+    for (uint64 ws = CACHE_SWEEP_MIN_BYTES; count < max_levels; ws *= CACHE_SWEEP_STEP) {
+        if (ws >= top) {
+            levels[count++] = top;
+            break;
+        }
+        levels[count++] = ws;
+    }
+    return count;
+}
+
+static BOOL Setup_CacheSweep(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    struct CacheSweepData *cd = PlatAllocClear(sizeof(struct CacheSweepData));
+    if (!cd)
+        return FALSE;
+
+    cd->block_size = block_size ? block_size : CACHE_SWEEP_DEFAULT_BLOCK;
+    cd->working_set = opts->working_set_bytes ? opts->working_set_bytes : CACHE_SWEEP_DEFAULT_BYTES;
+    if (cd->working_set < cd->block_size)
+        cd->working_set = cd->block_size;
+
+    /* A sweep sizes the file for its largest working set, so every job of the queue shares it */
+    cd->file_size = (opts->dataset_bytes > cd->working_set) ? opts->dataset_bytes : cd->working_set;
+
+    /* At least one working set, and enough reads for a stable figure when it is small */
+    uint64 pass_bytes = (cd->working_set > CACHE_SWEEP_PASS_BYTES) ? cd->working_set : CACHE_SWEEP_PASS_BYTES;
+    cd->num_ios = (uint32)(pass_bytes / cd->block_size);
+
+    snprintf(cd->file_path, sizeof(cd->file_path), "%sbench_cache_sweep.tmp", path);
+
+    VerifyInit(&cd->verify, opts);
+    if (!FixtureAcquire(path, cd->file_path, cd->file_size, CACHE_SWEEP_FILL_CHUNK, FALSE, opts)) {
+        PlatFree(cd);
+        return FALSE;
+    }
+
+    cd->file = PlatOpen(cd->file_path, PLAT_OPEN_EXISTING);
+    if (!cd->file) {
+        FixtureRelease(cd->file_path, FALSE);
+        PlatFree(cd);
+        return FALSE;
+    }
+
+    cd->buffer = PlatAlloc(cd->block_size);
+    if (!cd->buffer) {
+        PlatClose(cd->file);
+        FixtureRelease(cd->file_path, FALSE);
+        PlatFree(cd);
+        return FALSE;
+    }
+
+    /*
+     * Offsets cover the working set only; block-aligned so each read maps onto whole cache buffers.
+     * A pass draws num_ios offsets over the whole set, precomputed when memory allows and refilled
+     * otherwise, so the largest levels really do outgrow the cache.
+     */
+    uint32 align = ((cd->block_size & (cd->block_size - 1)) == 0) ? cd->block_size : CACHE_SWEEP_SECTOR_ALIGN;
+    uint32 batch = OffsetGenBatchSize(opts, cd->num_ios);
+    if (!OffsetGenInit(&cd->offsets, opts, cd->working_set, cd->block_size, align, batch)) {
+        PlatFree(cd->buffer);
+        PlatClose(cd->file);
+        FixtureRelease(cd->file_path, FALSE);
+        PlatFree(cd);
+        return FALSE;
+    }
+
+    *data = cd;
+    return TRUE;
+}
+
+static BOOL Run_CacheSweep(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct CacheSweepData *cd = (struct CacheSweepData *)data;
+    uint64 total_bytes = 0;
+
+    LatencyReset(&cd->latency);
+    VerifyReset(&cd->verify);
+
+    uint32 done = 0;
+    for (; SamplerKeepRunning(cd->sampler, done, cd->num_ios); done++) {
+        uint64 offset = OffsetGenNext(&cd->offsets, cd->sampler);
+        uint64 bytes_before = total_bytes;
+
+        SamplerTraceIO(cd->sampler, TRACE_OP_READ, offset, cd->block_size);
+        BenchTicks op_start = TimerNow();
+        int32 bytes_read = 0;
+        if (PlatSeek(cd->file, offset)) {
+            bytes_read = PlatRead(cd->file, cd->buffer, cd->block_size);
+            if (bytes_read > 0)
+                total_bytes += bytes_read;
+        }
+        LatencyRecord(&cd->latency, TimerOpMicros(op_start, TimerNow()));
+        if (cd->verify.enabled && bytes_read > 0)
+            VerifyCheck(&cd->verify, cd->sampler, cd->buffer, (uint32)bytes_read, offset);
+        SamplerUpdate(cd->sampler, (uint32)(total_bytes - bytes_before), 1);
+    }
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (total_bytes > 0);
+}
+
+static void Cleanup_CacheSweep(void *data)
+{
+    if (data) {
+        struct CacheSweepData *cd = (struct CacheSweepData *)data;
+        if (cd->file)
+            PlatClose(cd->file);
+        if (cd->buffer)
+            PlatFree(cd->buffer);
+        OffsetGenFree(&cd->offsets);
+        FixtureRelease(cd->file_path, FALSE);
+        PlatFree(cd);
+    }
+}
+
+static const LatencyHistogram *GetLatency_CacheSweep(void *data)
+{
+    return &((struct CacheSweepData *)data)->latency;
+}
+
+/* Untimed: read the working set once so the pass measures re-reads, then draw the pass's offsets */
+static void PreparePass_CacheSweep(void *data)
+{
+    struct CacheSweepData *cd = (struct CacheSweepData *)data;
+    if (PlatSeek(cd->file, 0)) {
+        for (uint64 pos = 0; pos < cd->working_set; pos += cd->block_size) {
+            if (PlatRead(cd->file, cd->buffer, cd->block_size) <= 0)
+                break;
+        }
+    }
+    OffsetGenPrepare(&cd->offsets);
+}
+
+static void SetSampler_CacheSweep(void *data, BenchSampler *sampler)
+{
+    ((struct CacheSweepData *)data)->sampler = sampler;
+}
+
+static BOOL SetFilesOpen_CacheSweep(void *data, BOOL open)
+{
+    struct CacheSweepData *cd = (struct CacheSweepData *)data;
+    if (open && !cd->file)
+        cd->file = PlatOpen(cd->file_path, PLAT_OPEN_EXISTING);
+    else if (!open && cd->file) {
+        PlatClose(cd->file);
+        cd->file = 0;
+    }
+    return (open == (cd->file != 0));
+}
+
+static const VerifyState *GetVerify_CacheSweep(void *data)
+{
+    return &((struct CacheSweepData *)data)->verify;
+}
+
+static void GetDefaultSettings_CacheSweep(uint32 *block_size, uint32 *passes)
+{
+    *block_size = CACHE_SWEEP_DEFAULT_BLOCK;
+    *passes = 3;
+}
+
+const BenchWorkload Workload_CacheSweep = {
+    .type = TEST_CACHE_SWEEP,
+    .name = "Cache Sweep",
+    .description = "Cache-hit bandwidth: re-reads of a growing working set",
+    .detailed_info =
+        "Cache Sweep\n"
+        "\n"
+        "Shows how much of a read result comes from caches rather\n"
+        "than the disk. Each job reads a working set once (not\n"
+        "timed), then re-reads random blocks within it.\n"
+        "\n"
+        "  Working sets:   64 KB, 256 KB, 1 MB ... up to twice the\n"
+        "                  free memory (one job per size)\n"
+        "  Per pass:       One working set, at least 64 MB\n"
+        "  Block size:     Configurable (default 64 KB)\n"
+        "  Metric:         MB/s per working-set size\n"
+        "  Default passes: 3\n"
+        "\n"
+        "While the working set fits in the filesystem buffers the\n"
+        "re-reads run at memory speed. Throughput drops in steps\n"
+        "once it outgrows the buffers, then the drive's own cache,\n"
+        "until it settles at the drive's random-read speed. Plot\n"
+        "the results with the Cache Curve profile.\n"
+        "\n"
+        "Good for: Sizing buffers, telling cache from disk speed.\n"
+        "Simulates: Repeated access to a data set of a given size.\n",
+    .Setup = Setup_CacheSweep,
+    .Run = Run_CacheSweep,
+    .Cleanup = Cleanup_CacheSweep,
+    .GetDefaultSettings = GetDefaultSettings_CacheSweep,
+    .GetLatency = GetLatency_CacheSweep,
+    .SetSampler = SetSampler_CacheSweep,
+    .PreparePass = PreparePass_CacheSweep,
+    .SetFilesOpen = SetFilesOpen_CacheSweep,
+    .GetVerify = GetVerify_CacheSweep,
+    .flags = WORKLOAD_F_ACCESS_PATTERN | WORKLOAD_F_TRACEABLE};
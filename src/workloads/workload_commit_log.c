@@ -0,0 +1,212 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ */
+
+#include "engine_internal.h"
+#include "workload_interface.h"
+
+#define COMMIT_LOG_NAME "bench_commit.log"
+#define COMMIT_RECORD_SIZE 4096                   /* Default record */
+#define COMMIT_MIN_RECORD 512                     /* One sector */
+#define COMMIT_MAX_RECORD (16 * 1024)             /* Larger appends are streaming, not commits */
+#define COMMIT_RECORDS 512                        /* Records per pass, whatever the group size */
+#define COMMIT_LOG_MAX_BYTES (64ULL * 1024 * 1024) /* A time-bounded pass starts a new log past this */
+
+/* Records per flush of a sweep: one commit per record, then group commit */
+static const uint32 commit_group_levels[] = {1, 4, 16};
+#define COMMIT_NUM_LEVELS (sizeof(commit_group_levels) / sizeof(commit_group_levels[0]))
+
+struct CommitData
+{
+    char log_path[MAX_PATH_LEN * 2];
+    PlatFile file;
+    DataPattern pattern; /* Record data, generated in Setup */
+    uint32 record_size;
+    uint32 group;        /* Records appended per flush */
+    uint64 log_bytes;    /* Size of the current log */
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+};
+
+uint32 GetCommitGroupLevels(uint32 *levels, uint32 max_levels)
+{
+    uint32 count = 0;
+    for (uint32 i = 0; i < COMMIT_NUM_LEVELS && count < max_levels; i++)
+        levels[count++] = commit_group_levels[i];
+    return count;
+}
+
+/* Start an empty log, as a database does after a checkpoint */
+static BOOL RestartLog(struct CommitData *cd)
+{
+    if (cd->file)
+        PlatClose(cd->file);
+    cd->file = PlatOpen(cd->log_path, PLAT_OPEN_NEW);
+    cd->log_bytes = 0;
+    return (cd->file != 0);
+}
+
+/**
+ * Setup_CommitLog
+ *
+ * Creates the log file and the record data. The record size is the job's
+ * block size, which must lie between 512 bytes and 16 KB.
+ */
+static BOOL Setup_CommitLog(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    uint32 record_size = block_size ? block_size : COMMIT_RECORD_SIZE;
+    if (record_size < COMMIT_MIN_RECORD || record_size > COMMIT_MAX_RECORD) {
+        LogUser("Commit Latency: records are 512 B to 16 KB, not %u bytes - choose a smaller block size",
+                (unsigned int)record_size);
+        return FALSE;
+    }
+
+    struct CommitData *cd = PlatAllocClear(sizeof(struct CommitData));
+    if (!cd)
+        return FALSE;
+
+    cd->record_size = record_size;
+    cd->group = opts->commit_group ? opts->commit_group : 1;
+    snprintf(cd->log_path, sizeof(cd->log_path), "%s%s", path, COMMIT_LOG_NAME);
+
+    if (!DataPatternInit(&cd->pattern, opts, cd->record_size, 0xC7)) {
+        PlatFree(cd);
+        return FALSE;
+    }
+    if (!RestartLog(cd)) {
+        DataPatternFree(&cd->pattern);
+        PlatFree(cd);
+        return FALSE;
+    }
+
+    *data = cd;
+    return TRUE;
+}
+
+/**
+ * PreparePass_CommitLog
+ *
+ * Every pass appends to a new, empty log (untimed).
+ */
+static void PreparePass_CommitLog(void *data)
+{
+    struct CommitData *cd = (struct CommitData *)data;
+    if (cd->log_bytes > 0)
+        RestartLog(cd);
+}
+
+/**
+ * Run_CommitLog
+ *
+ * Appends records to the log and makes each group of them durable before
+ * the next: write K records, then flush the file and its volume. One commit
+ * is one flush; its latency covers the appends and the flush, as a caller
+ * waiting for the commit would see it.
+ */
+static BOOL Run_CommitLog(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct CommitData *cd = (struct CommitData *)data;
+    uint64 total_bytes = 0;
+    uint32 records = 0;
+    uint32 commits = 0;
+    uint32 failed = 0;
+    uint32 commit_bytes = cd->group * cd->record_size;
+
+    LatencyReset(&cd->latency);
+
+    /* Fixed number of records, or as many commits as fit before the deadline of a time-bounded pass */
+    while (cd->file && SamplerKeepRunning(cd->sampler, records, COMMIT_RECORDS)) {
+        if (cd->log_bytes + commit_bytes > COMMIT_LOG_MAX_BYTES && !RestartLog(cd))
+            break;
+
+        BenchTicks start = TimerNow();
+        uint32 written = 0;
+        for (uint32 r = 0; r < cd->group; r++) {
+            uint8 *record = DataPatternNext(&cd->pattern, cd->record_size);
+            if (PlatWrite(cd->file, record, cd->record_size) == (int32)cd->record_size)
+                written += cd->record_size;
+        }
+        BOOL durable = PlatSyncFile(cd->file, cd->log_path);
+        LatencyRecord(&cd->latency, TimerOpMicros(start, TimerNow()));
+
+        if (written < commit_bytes || !durable)
+            failed++;
+        cd->log_bytes += written;
+        total_bytes += written;
+        records += cd->group;
+        commits++;
+        SamplerUpdate(cd->sampler, written, 1);
+    }
+
+    if (failed > 0)
+        LogUser("Commit Latency: %u of %u commits failed on %s", (unsigned int)failed, (unsigned int)commits,
+                cd->log_path);
+
+    *bytes_processed = total_bytes;
+    *op_count = commits;
+    return (total_bytes > 0 && failed == 0);
+}
+
+static void Cleanup_CommitLog(void *data)
+{
+    if (data) {
+        struct CommitData *cd = (struct CommitData *)data;
+        if (cd->file)
+            PlatClose(cd->file);
+        PlatDelete(cd->log_path);
+        DataPatternFree(&cd->pattern);
+        PlatFree(cd);
+    }
+}
+
+static const LatencyHistogram *GetLatency_CommitLog(void *data)
+{
+    return &((struct CommitData *)data)->latency;
+}
+
+static void SetSampler_CommitLog(void *data, BenchSampler *sampler)
+{
+    ((struct CommitData *)data)->sampler = sampler;
+}
+
+static void GetDefaultSettings_CommitLog(uint32 *block_size, uint32 *passes)
+{
+    *block_size = COMMIT_RECORD_SIZE;
+    *passes = 3;
+}
+
+const BenchWorkload Workload_CommitLog = {
+    .type = TEST_COMMIT_LOG,
+    .name = "Commit Latency",
+    .description = "Durability: Appends log records and flushes each commit to disk",
+    .detailed_info =
+        "Commit Latency\n"
+        "\n"
+        "Appends records to a log file and forces every commit to\n"
+        "the disk before the next one, the way a mail spool, a\n"
+        "database journal or a build log keeps its data safe.\n"
+        "\n"
+        "  Record size:    The block size, 512 B to 16 KB\n"
+        "  Records:        512 per pass\n"
+        "  Commit:         FFlush plus FlushVolume after each group\n"
+        "  Group commit:   1, 4 and 16 records per flush, one queued\n"
+        "                  job per group size\n"
+        "  Metric:         IOPS = commits/sec, latency = per commit\n"
+        "  Default passes: 3\n"
+        "\n"
+        "A flush per record shows what a durable write really costs\n"
+        "on each filesystem; batching records into one flush shows\n"
+        "how much of that cost group commit wins back. Plot the\n"
+        "results with the Group Commit profile.\n"
+        "\n"
+        "Good for: Filesystem and drive comparison for durable writes.\n"
+        "Simulates: Databases, mail spools, journals, build logs.\n",
+    .Setup = Setup_CommitLog,
+    .Run = Run_CommitLog,
+    .Cleanup = Cleanup_CommitLog,
+    .GetDefaultSettings = GetDefaultSettings_CommitLog,
+    .GetLatency = GetLatency_CommitLog,
+    .SetSampler = SetSampler_CommitLog,
+    .PreparePass = PreparePass_CommitLog,
+    .flags = WORKLOAD_F_DATA_PATTERN};
@@ -0,0 +1,252 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ */
+
+#include "engine_internal.h"
+#include "engine_access.h"
+#include "workload_interface.h"
+
+#define DIRSCALE_DIR_NAME "bench_dirscale"
+#define DIRSCALE_RAM_MAX_ENTRIES 10000 /* RAM: keeps every entry in memory; stop the sweep early */
+#define DIRSCALE_NAME_LEN 16           /* "f00000" and "r00000" */
+
+/* Directory sizes of a sweep; hashed directories (FFS) and B-trees (SFS, NGFS) part ways past 1k */
+static const uint32 dir_scaling_levels[] = {100, 1000, 10000, 50000};
+#define DIRSCALE_NUM_LEVELS (sizeof(dir_scaling_levels) / sizeof(dir_scaling_levels[0]))
+
+struct DirScalingData
+{
+    char dir_path[MAX_PATH_LEN];  /* Test directory, without the trailing '/' */
+    char file_path[MAX_PATH_LEN + DIRSCALE_NAME_LEN];
+    char rename_path[MAX_PATH_LEN + DIRSCALE_NAME_LEN];
+    uint32 entries;
+    uint32 *lookup_order; /* Shuffled entry numbers, so lookups do not follow creation order */
+    uint32 failed;        /* Operations that failed in the last Run */
+    MetaOpStats meta;
+    BenchSampler *sampler;
+};
+
+uint32 GetDirScalingLevels(const char *target_path, uint32 *levels, uint32 max_levels)
+{
+    BOOL ram = (strncasecmp(target_path, "RAM:", 4) == 0);
+    uint32 count = 0;
+    for (uint32 i = 0; i < DIRSCALE_NUM_LEVELS && count < max_levels; i++) {
+        if (ram && dir_scaling_levels[i] > DIRSCALE_RAM_MAX_ENTRIES)
+            break;
+        levels[count++] = dir_scaling_levels[i];
+    }
+    return count;
+}
+
+static const char *EntryPath(struct DirScalingData *dd, char *buf, char prefix, uint32 n)
+{
+    snprintf(buf, MAX_PATH_LEN + DIRSCALE_NAME_LEN, "%s/%c%05u", dd->dir_path, prefix, (unsigned int)n);
+    return buf;
+}
+
+/* Remove whatever a failed Run left behind (only its own names, never foreign files) */
+static void ClearEntries(struct DirScalingData *dd)
+{
+    for (uint32 i = 0; i < dd->entries; i++) {
+        PlatDelete(EntryPath(dd, dd->file_path, 'f', i));
+        PlatDelete(EntryPath(dd, dd->rename_path, 'r', i));
+    }
+}
+
+/**
+ * Setup_DirScaling
+ *
+ * Creates the empty test directory and the shuffled lookup order. A directory
+ * that is not empty would skew every rate, so it is reported instead of used.
+ */
+static BOOL Setup_DirScaling(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    struct DirScalingData *dd = PlatAllocClear(sizeof(struct DirScalingData));
+    if (!dd)
+        return FALSE;
+
+    dd->entries = opts->dir_entries ? opts->dir_entries : DIR_SCALING_DEFAULT_ENTRIES;
+    snprintf(dd->dir_path, sizeof(dd->dir_path), "%s%s", path, DIRSCALE_DIR_NAME);
+
+    if (!PlatCreateDir(dd->dir_path)) {
+        PlatFree(dd);
+        return FALSE;
+    }
+    if (PlatScanDir(dd->dir_path) != 0) {
+        LogUser("Directory Scaling: %s is not empty (left over from an earlier run?) - delete it and retry",
+                dd->dir_path);
+        PlatFree(dd);
+        return FALSE;
+    }
+
+    dd->lookup_order = PlatAlloc(dd->entries * sizeof(uint32));
+    if (!dd->lookup_order) {
+        PlatDelete(dd->dir_path);
+        PlatFree(dd);
+        return FALSE;
+    }
+    FastRand rng;
+    FastRandSeed(&rng, opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED);
+    for (uint32 i = 0; i < dd->entries; i++)
+        dd->lookup_order[i] = i;
+    for (uint32 i = dd->entries - 1; i > 0; i--) {
+        uint32 j = (uint32)FastRandRange(&rng, i + 1);
+        uint32 tmp = dd->lookup_order[i];
+        dd->lookup_order[i] = dd->lookup_order[j];
+        dd->lookup_order[j] = tmp;
+    }
+
+    *data = dd;
+    return TRUE;
+}
+
+/**
+ * Run_DirScaling
+ *
+ * One cycle fills the directory and empties it again, timing each class:
+ * 1. Create every file (empty, open new and close).
+ * 2. Look every file up by name, in shuffled order.
+ * 3. Examine the whole directory once (each entry returned is one op).
+ * 4. Rename every file within the directory.
+ * 5. Delete every file.
+ */
+static BOOL Run_DirScaling(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct DirScalingData *dd = (struct DirScalingData *)data;
+    uint32 total_ops = 0;
+    uint32 cycles = 0;
+
+    MetaOpsReset(&dd->meta);
+    dd->failed = 0;
+
+    /* One cycle per pass, or repeated cycles until the deadline of a time-bounded pass */
+    do {
+        for (uint32 i = 0; i < dd->entries; i++) {
+            EntryPath(dd, dd->file_path, 'f', i);
+            BenchTicks start = TimerNow();
+            PlatFile fh = PlatOpen(dd->file_path, PLAT_OPEN_NEW);
+            if (fh)
+                PlatClose(fh);
+            MetaOpsRecord(&dd->meta, META_OP_CREATE, 1, start);
+            if (!fh)
+                dd->failed++;
+            SamplerUpdate(dd->sampler, 0, 1);
+        }
+
+        for (uint32 i = 0; i < dd->entries; i++) {
+            EntryPath(dd, dd->file_path, 'f', dd->lookup_order[i]);
+            BenchTicks start = TimerNow();
+            BOOL found = PlatExists(dd->file_path);
+            MetaOpsRecord(&dd->meta, META_OP_LOOKUP, 1, start);
+            if (!found)
+                dd->failed++;
+            SamplerUpdate(dd->sampler, 0, 1);
+        }
+
+        BenchTicks scan_start = TimerNow();
+        int32 listed = PlatScanDir(dd->dir_path);
+        if (listed >= 0) {
+            MetaOpsRecord(&dd->meta, META_OP_SCAN, (uint32)listed, scan_start);
+            SamplerUpdate(dd->sampler, 0, (uint32)listed);
+        }
+        if (listed != (int32)dd->entries)
+            dd->failed++;
+
+        for (uint32 i = 0; i < dd->entries; i++) {
+            EntryPath(dd, dd->file_path, 'f', i);
+            EntryPath(dd, dd->rename_path, 'r', i);
+            BenchTicks start = TimerNow();
+            BOOL renamed = PlatRename(dd->file_path, dd->rename_path);
+            MetaOpsRecord(&dd->meta, META_OP_RENAME, 1, start);
+            if (!renamed)
+                dd->failed++;
+            SamplerUpdate(dd->sampler, 0, 1);
+        }
+
+        for (uint32 i = 0; i < dd->entries; i++) {
+            EntryPath(dd, dd->rename_path, 'r', i);
+            BenchTicks start = TimerNow();
+            BOOL deleted = PlatDelete(dd->rename_path);
+            MetaOpsRecord(&dd->meta, META_OP_DELETE, 1, start);
+            if (!deleted)
+                dd->failed++;
+            SamplerUpdate(dd->sampler, 0, 1);
+        }
+        cycles++;
+    } while (SamplerKeepRunning(dd->sampler, cycles, 1));
+
+    if (dd->failed > 0) {
+        LogUser("Directory Scaling: %u operations failed in %s", (unsigned int)dd->failed, dd->dir_path);
+        ClearEntries(dd);
+    }
+
+    for (uint32 op = 0; op < META_OP_COUNT; op++)
+        total_ops += dd->meta.count[op];
+
+    *bytes_processed = 0; /* No data is written: the metric is IOPS and the per-class rates */
+    *op_count = total_ops;
+    return (total_ops > 0 && dd->failed == 0);
+}
+
+static void Cleanup_DirScaling(void *data)
+{
+    if (data) {
+        struct DirScalingData *dd = (struct DirScalingData *)data;
+        /* Every Run leaves the directory empty (a failed one clears up after itself) */
+        PlatDelete(dd->dir_path);
+        if (dd->lookup_order)
+            PlatFree(dd->lookup_order);
+        PlatFree(dd);
+    }
+}
+
+static void SetSampler_DirScaling(void *data, BenchSampler *sampler)
+{
+    ((struct DirScalingData *)data)->sampler = sampler;
+}
+
+static const MetaOpStats *GetMetaOps_DirScaling(void *data)
+{
+    return &((struct DirScalingData *)data)->meta;
+}
+
+static void GetDefaultSettings_DirScaling(uint32 *block_size, uint32 *passes)
+{
+    *block_size = 0; /* Not used */
+    *passes = 2;
+}
+
+const BenchWorkload Workload_DirScaling = {
+    .type = TEST_DIR_SCALING,
+    .name = "Directory Scaling",
+    .description = "Metadata Scaling: Create/Lookup/Scan/Rename/Delete in one large directory",
+    .detailed_info =
+        "Directory Scaling\n"
+        "\n"
+        "Fills a single directory with empty files, then looks each\n"
+        "one up, lists the directory, renames every file and deletes\n"
+        "them all, timing each kind of operation on its own.\n"
+        "\n"
+        "  Directory size: 100, 1k, 10k and 50k entries, one queued\n"
+        "                  job per size (10k at most on RAM:)\n"
+        "  Lookups:        By name (Lock), in shuffled order\n"
+        "  Listing:        One ExamineDir pass over the directory\n"
+        "  Metric:         IOPS overall, plus ops/sec per operation\n"
+        "  Block size:     N/A (pure metadata test)\n"
+        "  Default passes: 2\n"
+        "\n"
+        "Filesystems that are quick with a few hundred files can\n"
+        "slow to a crawl at tens of thousands: hashed directories\n"
+        "grow long chains, while B-tree directories stay nearly\n"
+        "flat. Plot the results with the Directory Scaling profile\n"
+        "to see where each filesystem falls off.\n"
+        "\n"
+        "Good for: Filesystem comparison with large directories.\n"
+        "Simulates: Build trees, mail spools, caches.\n",
+    .Setup = Setup_DirScaling,
+    .Run = Run_DirScaling,
+    .Cleanup = Cleanup_DirScaling,
+    .GetDefaultSettings = GetDefaultSettings_DirScaling,
+    .SetSampler = SetSampler_DirScaling,
+    .GetMetaOps = GetMetaOps_DirScaling};
@@ -14,11 +14,12 @@
 struct GrindData
 {
     char path[MAX_PATH_LEN];
+    BenchSampler *sampler;
 };
 
-static BOOL Setup_Grind(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Grind(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct GrindData *gd = IExec->AllocVecTags(sizeof(struct GrindData), AVT_Type, MEMF_SHARED, TAG_DONE);
+    struct GrindData *gd = PlatAllocClear(sizeof(struct GrindData));
     if (!gd)
         return FALSE;
 
@@ -27,24 +28,30 @@ static BOOL Setup_Grind(const char *path, uint32 block_size, void **data)
     return TRUE;
 }
 
-static BOOL Run_Grind(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Grind(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct GrindData *gd = (struct GrindData *)data;
     char temp_file[512];
-    uint32 total_bytes = 0;
+    uint64 total_bytes = 0;
     uint32 total_ops = 0;
 
-    srand(FIXED_SEED);
-    for (int i = 0; i < GRIND_ITERATIONS; i++) {
+    for (uint32 i = 0; SamplerKeepRunning(gd->sampler, i, GRIND_ITERATIONS); i++) {
         uint32 size, chunk;
-        if (i < 5)
+        /* Time-bounded passes repeat the same fixed mix of files */
+        if (i % GRIND_ITERATIONS == 0)
+            srand(FIXED_SEED);
+        if (i % GRIND_ITERATIONS < 5)
             size = (2 + (rand() % 9)) * 1024 * 1024;
         else
             size = (1 + (rand() % 64)) * 1024;
         chunk = (512 << (rand() % 7)); /* 512B, 1K, 2K, 4K, 8K, 16K, 32K */
-        snprintf(temp_file, sizeof(temp_file), "%sbench_grind_%d.tmp", gd->path, i);
-        total_bytes += WriteDummyFile(temp_file, size, chunk);
-        IDOS->Delete(temp_file);
+        snprintf(temp_file, sizeof(temp_file), "%sbench_grind_%u.tmp", gd->path,
+                 (unsigned int)(i % GRIND_ITERATIONS));
+        uint64 written = WriteDummyFile(temp_file, size, chunk, gd->sampler, NULL, NULL);
+        PlatDelete(temp_file);
+        if (written == 0)
+            break;
+        total_bytes += written;
         total_ops += 2;
     }
 
@@ -56,10 +63,15 @@ static BOOL Run_Grind(void *data, uint32 *bytes_processed, uint32 *op_count)
 static void Cleanup_Grind(void *data)
 {
     if (data) {
-        IExec->FreeVec(data);
+        PlatFree(data);
     }
 }
 
+static void SetSampler_Grind(void *data, BenchSampler *sampler)
+{
+    ((struct GrindData *)data)->sampler = sampler;
+}
+
 static void GetDefaultSettings_Grind(uint32 *block_size, uint32 *passes)
 {
     *block_size = 0; /* Not applicable */
@@ -95,4 +107,5 @@ const BenchWorkload Workload_Legacy_Grind = {
     .Setup = Setup_Grind,
     .Run = Run_Grind,
     .Cleanup = Cleanup_Grind,
-    .GetDefaultSettings = GetDefaultSettings_Grind};
+    .GetDefaultSettings = GetDefaultSettings_Grind,
+    .SetSampler = SetSampler_Grind};
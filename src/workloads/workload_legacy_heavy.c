@@ -25,17 +25,18 @@
 #include "workload_interface.h"
 
 #define HEAVY_DEFAULT_BLOCK (128 * 1024)   /* 128KB */
-#define HEAVY_FILE_SIZE (50 * 1024 * 1024) /* 50MB */
+#define HEAVY_FILE_SIZE (50ULL * 1024 * 1024) /* 50MB */
 
 struct HeavyData
 {
     char path[MAX_PATH_LEN];
     uint32 block_size;
+    BenchSampler *sampler;
 };
 
-static BOOL Setup_Heavy(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Heavy(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct HeavyData *hd = IExec->AllocVecTags(sizeof(struct HeavyData), AVT_Type, MEMF_SHARED, TAG_DONE);
+    struct HeavyData *hd = PlatAllocClear(sizeof(struct HeavyData));
     if (!hd)
         return FALSE;
 
@@ -45,28 +46,42 @@ static BOOL Setup_Heavy(const char *path, uint32 block_size, void **data)
     return TRUE;
 }
 
-static BOOL Run_Heavy(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Heavy(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct HeavyData *hd = (struct HeavyData *)data;
     char temp_file[512];
-    uint32 total_bytes = 0;
+    uint64 total_bytes = 0;
+    uint32 files = 0;
 
     snprintf(temp_file, sizeof(temp_file), "%sbench_heavy.tmp", hd->path);
-    total_bytes = WriteDummyFile(temp_file, HEAVY_FILE_SIZE, hd->block_size);
-    IDOS->Delete(temp_file);
+
+    /* One file per pass, or back-to-back files until the deadline of a time-bounded pass */
+    do {
+        uint64 written = WriteDummyFile(temp_file, HEAVY_FILE_SIZE, hd->block_size, hd->sampler, NULL, NULL);
+        PlatDelete(temp_file);
+        if (written == 0)
+            break;
+        total_bytes += written;
+        files++;
+    } while (SamplerKeepRunning(hd->sampler, files, 1));
 
     *bytes_processed = total_bytes;
-    *op_count = (hd->block_size > 0) ? (total_bytes / hd->block_size) : 1;
+    *op_count = (hd->block_size > 0) ? (uint32)(total_bytes / hd->block_size) : 1;
     return (total_bytes > 0);
 }
 
 static void Cleanup_Heavy(void *data)
 {
     if (data) {
-        IExec->FreeVec(data);
+        PlatFree(data);
     }
 }
 
+static void SetSampler_Heavy(void *data, BenchSampler *sampler)
+{
+    ((struct HeavyData *)data)->sampler = sampler;
+}
+
 static void GetDefaultSettings_Heavy(uint32 *block_size, uint32 *passes)
 {
     *block_size = HEAVY_DEFAULT_BLOCK;
@@ -98,4 +113,5 @@ const BenchWorkload Workload_Legacy_Heavy = {
     .Setup = Setup_Heavy,
     .Run = Run_Heavy,
     .Cleanup = Cleanup_Heavy,
-    .GetDefaultSettings = GetDefaultSettings_Heavy};
+    .GetDefaultSettings = GetDefaultSettings_Heavy,
+    .SetSampler = SetSampler_Heavy};
@@ -7,17 +7,18 @@
 #include "workload_interface.h"
 
 #define LEGACY_DEFAULT_BLOCK 512
-#define LEGACY_FILE_SIZE (50 * 1024 * 1024) /* 50MB */
+#define LEGACY_FILE_SIZE (50ULL * 1024 * 1024) /* 50MB */
 
 struct LegacyData
 {
     char path[MAX_PATH_LEN];
     uint32 block_size;
+    BenchSampler *sampler;
 };
 
-static BOOL Setup_Legacy(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Legacy(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct LegacyData *ld = IExec->AllocVecTags(sizeof(struct LegacyData), AVT_Type, MEMF_SHARED, TAG_DONE);
+    struct LegacyData *ld = PlatAllocClear(sizeof(struct LegacyData));
     if (!ld)
         return FALSE;
 
@@ -27,28 +28,42 @@ static BOOL Setup_Legacy(const char *path, uint32 block_size, void **data)
     return TRUE;
 }
 
-static BOOL Run_Legacy(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Legacy(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct LegacyData *ld = (struct LegacyData *)data;
     char temp_file[512];
-    uint32 total_bytes = 0;
+    uint64 total_bytes = 0;
+    uint32 files = 0;
 
     snprintf(temp_file, sizeof(temp_file), "%sbench_legacy.tmp", ld->path);
-    total_bytes = WriteDummyFile(temp_file, LEGACY_FILE_SIZE, ld->block_size);
-    IDOS->Delete(temp_file);
+
+    /* One file per pass, or back-to-back files until the deadline of a time-bounded pass */
+    do {
+        uint64 written = WriteDummyFile(temp_file, LEGACY_FILE_SIZE, ld->block_size, ld->sampler, NULL, NULL);
+        PlatDelete(temp_file);
+        if (written == 0)
+            break;
+        total_bytes += written;
+        files++;
+    } while (SamplerKeepRunning(ld->sampler, files, 1));
 
     *bytes_processed = total_bytes;
-    *op_count = (ld->block_size > 0) ? (total_bytes / ld->block_size) : 1;
+    *op_count = (ld->block_size > 0) ? (uint32)(total_bytes / ld->block_size) : 1;
     return (total_bytes > 0);
 }
 
 static void Cleanup_Legacy(void *data)
 {
     if (data) {
-        IExec->FreeVec(data);
+        PlatFree(data);
     }
 }
 
+static void SetSampler_Legacy(void *data, BenchSampler *sampler)
+{
+    ((struct LegacyData *)data)->sampler = sampler;
+}
+
 static void GetDefaultSettings_Legacy(uint32 *block_size, uint32 *passes)
 {
     *block_size = LEGACY_DEFAULT_BLOCK;
@@ -82,4 +97,5 @@ const BenchWorkload Workload_Legacy_Legacy = {
     .Setup = Setup_Legacy,
     .Run = Run_Legacy,
     .Cleanup = Cleanup_Legacy,
-    .GetDefaultSettings = GetDefaultSettings_Legacy};
+    .GetDefaultSettings = GetDefaultSettings_Legacy,
+    .SetSampler = SetSampler_Legacy};
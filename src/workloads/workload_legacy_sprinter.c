@@ -14,11 +14,12 @@ struct SprinterData
 {
     char path[MAX_PATH_LEN];
     uint32 block_size;
+    BenchSampler *sampler;
 };
 
-static BOOL Setup_Sprinter(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Sprinter(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct SprinterData *sd = IExec->AllocVecTags(sizeof(struct SprinterData), AVT_Type, MEMF_SHARED, TAG_DONE);
+    struct SprinterData *sd = PlatAllocClear(sizeof(struct SprinterData));
     if (!sd)
         return FALSE;
 
@@ -28,30 +29,40 @@ static BOOL Setup_Sprinter(const char *path, uint32 block_size, void **data)
     return TRUE;
 }
 
-static BOOL Run_Sprinter(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Sprinter(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct SprinterData *sd = (struct SprinterData *)data;
     char temp_file[512];
-    uint32 total_bytes = 0;
+    uint64 total_bytes = 0;
+    uint32 files = 0;
 
-    for (int i = 0; i < SPRINTER_FILE_COUNT; i++) {
-        snprintf(temp_file, sizeof(temp_file), "%sbench_sprinter_%d.tmp", sd->path, i);
-        total_bytes += WriteDummyFile(temp_file, SPRINTER_FILE_SIZE, sd->block_size);
-        IDOS->Delete(temp_file);
+    for (; SamplerKeepRunning(sd->sampler, files, SPRINTER_FILE_COUNT); files++) {
+        snprintf(temp_file, sizeof(temp_file), "%sbench_sprinter_%u.tmp", sd->path,
+                 (unsigned int)(files % SPRINTER_FILE_COUNT));
+        uint64 written = WriteDummyFile(temp_file, SPRINTER_FILE_SIZE, sd->block_size, sd->sampler, NULL, NULL);
+        PlatDelete(temp_file);
+        if (written == 0)
+            break;
+        total_bytes += written;
     }
 
     *bytes_processed = total_bytes;
-    *op_count = SPRINTER_FILE_COUNT * 2; /* Write + Delete per file */
+    *op_count = files * 2; /* Write + Delete per file */
     return (total_bytes > 0);
 }
 
 static void Cleanup_Sprinter(void *data)
 {
     if (data) {
-        IExec->FreeVec(data);
+        PlatFree(data);
     }
 }
 
+static void SetSampler_Sprinter(void *data, BenchSampler *sampler)
+{
+    ((struct SprinterData *)data)->sampler = sampler;
+}
+
 static void GetDefaultSettings_Sprinter(uint32 *block_size, uint32 *passes)
 {
     *block_size = SPRINTER_DEFAULT_BLOCK;
@@ -85,4 +96,5 @@ const BenchWorkload Workload_Legacy_Sprinter = {
     .Setup = Setup_Sprinter,
     .Run = Run_Sprinter,
     .Cleanup = Cleanup_Sprinter,
-    .GetDefaultSettings = GetDefaultSettings_Sprinter};
+    .GetDefaultSettings = GetDefaultSettings_Sprinter,
+    .SetSampler = SetSampler_Sprinter};
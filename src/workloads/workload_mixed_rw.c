@@ -4,12 +4,15 @@
  */
 
 #include "engine_internal.h"
+#include "engine_access.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
 #include "workload_interface.h"
 #include <stdlib.h>
 
 #define MIXED_BLOCK_SIZE 4096
-#define MIXED_FILE_SIZE (64 * 1024 * 1024)    /* 64MB data set */
-#define MIXED_RAM_FILE_SIZE (8 * 1024 * 1024) /* 8MB for RAM: */
+#define MIXED_FILE_SIZE (64ULL * 1024 * 1024)    /* 64MB data set */
+#define MIXED_RAM_FILE_SIZE (8ULL * 1024 * 1024) /* 8MB for RAM: */
 #define MIXED_NUM_OPS 2048
 #define MIXED_RAM_NUM_OPS 512
 #define MIXED_FILL_CHUNK (128 * 1024) /* 128KB fill chunk */
@@ -20,17 +23,22 @@ struct MixedRWData
 {
     char path[MAX_PATH_LEN];
     char file_path[MAX_PATH_LEN * 2];
-    BPTR file;
+    PlatFile file;
     uint8 *buffer;
-    uint32 file_size;
+    uint64 file_size;
     uint32 num_ops;
     uint32 block_size;
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+    OffsetGenerator offsets;
+    FastRand op_rng; /* Read/write choice */
+    VerifyState verify;
+    DataPattern pattern; /* Write data, generated in Setup */
 };
 
-static BOOL Setup_MixedRW(const char *path, uint32 block_size, void **data)
+static BOOL Setup_MixedRW(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct MixedRWData *md =
-        IExec->AllocVecTags(sizeof(struct MixedRWData), AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
+    struct MixedRWData *md = PlatAllocClear(sizeof(struct MixedRWData));
     if (!md)
         return FALSE;
 
@@ -45,35 +53,58 @@ static BOOL Setup_MixedRW(const char *path, uint32 block_size, void **data)
         md->num_ops = MIXED_RAM_NUM_OPS;
     }
 
+    /* An explicit data-set size overrides the defaults above, including the RAM: cap */
+    if (opts->dataset_bytes > 0)
+        md->file_size = opts->dataset_bytes;
+
     snprintf(md->file_path, sizeof(md->file_path), "%sbench_mixed_rw.tmp", path);
 
-    /* Pre-allocate and fill file for read operations */
-    if (WriteDummyFile(md->file_path, md->file_size, MIXED_FILL_CHUNK) == 0) {
-        IExec->FreeVec(md);
+    /* Pre-allocate and fill file for read operations (with the default pattern, writes keep it clean) */
+    VerifyInit(&md->verify, opts);
+    if (!FixtureAcquire(path, md->file_path, md->file_size, MIXED_FILL_CHUNK, FALSE, opts)) {
+        PlatFree(md);
         return FALSE;
     }
 
-    md->file = IDOS->Open(md->file_path, MODE_READWRITE);
+    md->file = PlatOpen(md->file_path, PLAT_OPEN_READWRITE);
     if (!md->file) {
-        IDOS->Delete(md->file_path);
-        IExec->FreeVec(md);
+        FixtureRelease(md->file_path, FALSE);
+        PlatFree(md);
         return FALSE;
     }
 
-    md->buffer = IExec->AllocVecTags(md->block_size, AVT_Type, MEMF_SHARED, TAG_DONE);
+    md->buffer = PlatAlloc(md->block_size);
     if (!md->buffer) {
-        IDOS->Close(md->file);
-        IDOS->Delete(md->file_path);
-        IExec->FreeVec(md);
+        PlatClose(md->file);
+        FixtureRelease(md->file_path, FALSE);
+        PlatFree(md);
+        return FALSE;
+    }
+    if (!DataPatternInit(&md->pattern, opts, md->block_size, FIXTURE_FILL_BYTE)) {
+        PlatFree(md->buffer);
+        PlatClose(md->file);
+        FixtureRelease(md->file_path, FALSE);
+        PlatFree(md);
+        return FALSE;
+    }
+
+    /* Offsets for each pass are precomputed in PreparePass, outside the timed loop */
+    uint32 batch = OffsetGenBatchSize(opts, md->num_ops);
+    if (!OffsetGenInit(&md->offsets, opts, md->file_size, md->block_size, MIXED_SECTOR_ALIGN + 1, batch)) {
+        DataPatternFree(&md->pattern);
+        PlatFree(md->buffer);
+        PlatClose(md->file);
+        FixtureRelease(md->file_path, FALSE);
+        PlatFree(md);
         return FALSE;
     }
-    memset(md->buffer, 0xAA, md->block_size);
+    FastRandSeed(&md->op_rng, (opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED) + 1);
 
     *data = md;
     return TRUE;
 }
 
-static BOOL Run_MixedRW(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_MixedRW(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct MixedRWData *md = (struct MixedRWData *)data;
     uint64 total_bytes = 0;
@@ -83,37 +114,55 @@ static BOOL Run_MixedRW(void *data, uint32 *bytes_processed, uint32 *op_count)
         *op_count = 0;
         return FALSE;
     }
-    uint32 max_offset = md->file_size - md->block_size;
 
-    for (uint32 i = 0; i < md->num_ops; i++) {
-        uint32 offset = (uint32)rand() % max_offset;
-        /* Align to 512-byte boundary for realistic disk performance */
-        offset &= ~MIXED_SECTOR_ALIGN;
+    LatencyReset(&md->latency);
+    VerifyReset(&md->verify);
+
+    /* Fixed number of I/Os, or as many as fit before the deadline of a time-bounded pass */
+    uint32 done = 0;
+    for (; SamplerKeepRunning(md->sampler, done, md->num_ops); done++) {
+        /* Precomputed, 512-byte aligned offset from the job's access pattern */
+        uint64 offset = OffsetGenNext(&md->offsets, md->sampler);
 
         /* 70% reads, 30% writes */
-        BOOL is_read = ((rand() % 100) < MIXED_READ_RATIO);
+        BOOL is_read = (FastRandRange(&md->op_rng, 100) < MIXED_READ_RATIO);
+
+        uint64 bytes_before = total_bytes;
 
-        /* ChangeFilePosition returns the old position, not a success flag.
-         * A return of -1 indicates error; any other value (including 0) is valid. */
-        if (IDOS->ChangeFilePosition(md->file, offset, OFFSET_BEGINNING) != -1) {
+        /* Verify mode: a write carries the stamps for its offset, so later reads still check out */
+        uint8 *block = is_read ? md->buffer : DataPatternNext(&md->pattern, md->block_size);
+        if (!is_read && md->verify.enabled)
+            VerifyStamp(&md->verify, md->sampler, block, md->block_size, offset);
+
+        SamplerTraceIO(md->sampler, is_read ? TRACE_OP_READ : TRACE_OP_WRITE, offset, md->block_size);
+
+        /* Latency covers seek + read/write, i.e. one complete random I/O */
+        BenchTicks op_start = TimerNow();
+
+        int32 bytes_read = 0;
+        if (PlatSeek(md->file, offset)) {
             if (is_read) {
                 /* Read operation */
-                int32 bytes_read = IDOS->Read(md->file, md->buffer, md->block_size);
+                bytes_read = PlatRead(md->file, block, md->block_size);
                 if (bytes_read > 0) {
                     total_bytes += bytes_read;
                 }
             } else {
                 /* Write operation */
-                if (IDOS->Write(md->file, md->buffer, md->block_size) == md->block_size) {
+                if (PlatWrite(md->file, block, md->block_size) == md->block_size) {
                     total_bytes += md->block_size;
                 }
             }
         }
+
+        LatencyRecord(&md->latency, TimerOpMicros(op_start, TimerNow()));
+        if (md->verify.enabled && bytes_read > 0)
+            VerifyCheck(&md->verify, md->sampler, md->buffer, (uint32)bytes_read, offset);
+        SamplerUpdate(md->sampler, (uint32)(total_bytes - bytes_before), 1);
     }
 
-    /* Cap to uint32 max to avoid overflow — total_bytes can exceed 4GB with large block sizes */
-    *bytes_processed = (total_bytes > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32)total_bytes;
-    *op_count = md->num_ops;
+    *bytes_processed = total_bytes;
+    *op_count = done;
     return (total_bytes > 0);
 }
 
@@ -122,14 +171,50 @@ static void Cleanup_MixedRW(void *data)
     if (data) {
         struct MixedRWData *md = (struct MixedRWData *)data;
         if (md->file)
-            IDOS->Close(md->file);
+            PlatClose(md->file);
         if (md->buffer)
-            IExec->FreeVec(md->buffer);
-        IDOS->Delete(md->file_path);
-        IExec->FreeVec(md);
+            PlatFree(md->buffer);
+        /* Random write data changes the file; the fill and verify stamps leave it as acquired */
+        BOOL modified = (md->pattern.random_pct > 0 && !md->verify.enabled);
+        DataPatternFree(&md->pattern);
+        OffsetGenFree(&md->offsets);
+        FixtureRelease(md->file_path, modified);
+        PlatFree(md);
     }
 }
 
+static const LatencyHistogram *GetLatency_MixedRW(void *data)
+{
+    return &((struct MixedRWData *)data)->latency;
+}
+
+static void PreparePass_MixedRW(void *data)
+{
+    OffsetGenPrepare(&((struct MixedRWData *)data)->offsets);
+}
+
+static void SetSampler_MixedRW(void *data, BenchSampler *sampler)
+{
+    ((struct MixedRWData *)data)->sampler = sampler;
+}
+
+static BOOL SetFilesOpen_MixedRW(void *data, BOOL open)
+{
+    struct MixedRWData *md = (struct MixedRWData *)data;
+    if (open && !md->file)
+        md->file = PlatOpen(md->file_path, PLAT_OPEN_READWRITE);
+    else if (!open && md->file) {
+        PlatClose(md->file);
+        md->file = 0;
+    }
+    return (open == (md->file != 0));
+}
+
+static const VerifyState *GetVerify_MixedRW(void *data)
+{
+    return &((struct MixedRWData *)data)->verify;
+}
+
 static void GetDefaultSettings_MixedRW(uint32 *block_size, uint32 *passes)
 {
     *block_size = MIXED_BLOCK_SIZE;
@@ -153,7 +238,9 @@ const BenchWorkload Workload_MixedRW = {
         "  Write ratio:    30%\n"
         "  Block size:     Configurable (default 4 KB)\n"
         "  Seek alignment: 512-byte sectors\n"
+        "  Access pattern: Uniform (or Zipf, hot/cold, strided)\n"
         "  Metric:         IOPS (I/O operations per second)\n"
+        "  Latency:        p50/p90/p99/p99.9/max per operation\n"
         "  Default passes: 3\n"
         "\n"
         "The 70/30 read-write split closely matches the I/O pattern\n"
@@ -166,4 +253,10 @@ const BenchWorkload Workload_MixedRW = {
     .Setup = Setup_MixedRW,
     .Run = Run_MixedRW,
     .Cleanup = Cleanup_MixedRW,
-    .GetDefaultSettings = GetDefaultSettings_MixedRW};
+    .GetDefaultSettings = GetDefaultSettings_MixedRW,
+    .GetLatency = GetLatency_MixedRW,
+    .SetSampler = SetSampler_MixedRW,
+    .PreparePass = PreparePass_MixedRW,
+    .SetFilesOpen = SetFilesOpen_MixedRW,
+    .GetVerify = GetVerify_MixedRW,
+    .flags = WORKLOAD_F_ACCESS_PATTERN | WORKLOAD_F_TRACEABLE | WORKLOAD_F_DATA_PATTERN};
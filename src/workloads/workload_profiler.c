@@ -11,12 +11,15 @@
 #define PROFILER_RAM_NUM_DIRS 20
 #define PROFILER_PATH_LEN 1024      /* compound dir/file paths */
 #define PROFILER_FILE_PATH_LEN 2048 /* full file paths */
+#define PROFILER_FILE_BYTES 20       /* Written into each file */
 
 struct ProfilerData
 {
     char base_path[MAX_PATH_LEN];
     uint32 num_dirs;
     uint32 files_per_dir;
+    MetaOpStats meta;
+    BenchSampler *sampler;
 };
 
 /**
@@ -25,9 +28,9 @@ struct ProfilerData
  * Prepares the metadata stress test by determining the target path
  * and scaling the number of operations based on the volume type (e.g. RAM:).
  */
-static BOOL Setup_Profiler(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Profiler(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct ProfilerData *pd = IExec->AllocVecTags(sizeof(struct ProfilerData), AVT_Type, MEMF_SHARED, TAG_DONE);
+    struct ProfilerData *pd = PlatAllocClear(sizeof(struct ProfilerData));
     if (!pd)
         return FALSE;
 
@@ -48,13 +51,16 @@ static BOOL Setup_Profiler(const char *path, uint32 block_size, void **data)
 /**
  * Run_Profiler
  *
- * Executes the metadata stress test:
- * 1. Creates a series of directories.
- * 2. Creates multiple files in each directory.
- * 3. Renames every 2nd file.
- * 4. Deletes all created files and directories.
+ * Executes the metadata stress test, timing each operation class on its own:
+ * 1. Creates a series of directories (MakeDir).
+ * 2. Creates and writes multiple files in each directory (Create).
+ * 3. Renames every 2nd file (Rename).
+ * 4. Deletes all created files (Delete) and directories (DeleteDir).
+ *
+ * Only operations that succeed are counted. The bytes reported are the bytes
+ * actually written; the score is the operation rate.
  */
-static BOOL Run_Profiler(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Profiler(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct ProfilerData *pd = (struct ProfilerData *)data;
     uint32 total_ops = 0;
@@ -62,59 +68,80 @@ static BOOL Run_Profiler(void *data, uint32 *bytes_processed, uint32 *op_count)
     char file_path[PROFILER_FILE_PATH_LEN];
     char rename_path[PROFILER_FILE_PATH_LEN];
 
-    /* 1. Directory & File Creation Loop */
-    for (uint32 d = 0; d < pd->num_dirs; d++) {
-        snprintf(dir_path, sizeof(dir_path), "%sprof_dir_%u/", pd->base_path, (unsigned int)d);
-        BPTR lock = IDOS->CreateDir(dir_path);
-        if (lock) {
-            IDOS->UnLock(lock);
-            total_ops++;
+    uint32 cycles = 0;
+
+    MetaOpsReset(&pd->meta);
+
+    /* One create/delete cycle per pass, or repeated cycles until the deadline of a time-bounded pass */
+    do {
+        /* 1. Directory & File Creation Loop */
+        for (uint32 d = 0; d < pd->num_dirs; d++) {
+            snprintf(dir_path, sizeof(dir_path), "%sprof_dir_%u/", pd->base_path, (unsigned int)d);
+            BenchTicks start = TimerNow();
+            if (!PlatCreateDir(dir_path))
+                continue;
+            MetaOpsRecord(&pd->meta, META_OP_MKDIR, 1, start);
+            SamplerUpdate(pd->sampler, 0, 1);
 
             for (uint32 f = 0; f < pd->files_per_dir; f++) {
                 snprintf(file_path, sizeof(file_path), "%sfile_%u.tmp", dir_path, (unsigned int)f);
-                BPTR fh = IDOS->Open(file_path, MODE_NEWFILE);
-                if (fh) {
-                    /* Write a small amount of metadata info */
-                    IDOS->Write(fh, "metadata stress test", 20);
-                    IDOS->Close(fh);
-                    total_ops++;
-
-                    /* Every 2nd file, perform a Rename operation */
-                    if (f % 2 == 0) {
-                        snprintf(rename_path, sizeof(rename_path), "%sfile_%u_renamed.tmp", dir_path, (unsigned int)f);
-                        if (IDOS->Rename(file_path, rename_path)) {
-                            total_ops++;
-                        }
+                start = TimerNow();
+                PlatFile fh = PlatOpen(file_path, PLAT_OPEN_NEW);
+                if (!fh)
+                    continue;
+                /* Write a small amount of metadata info */
+                PlatWrite(fh, "metadata stress test", PROFILER_FILE_BYTES);
+                PlatClose(fh);
+                MetaOpsRecord(&pd->meta, META_OP_CREATE, 1, start);
+                SamplerUpdate(pd->sampler, PROFILER_FILE_BYTES, 1);
+
+                /* Every 2nd file, perform a Rename operation */
+                if (f % 2 == 0) {
+                    snprintf(rename_path, sizeof(rename_path), "%sfile_%u_renamed.tmp", dir_path, (unsigned int)f);
+                    start = TimerNow();
+                    if (PlatRename(file_path, rename_path)) {
+                        MetaOpsRecord(&pd->meta, META_OP_RENAME, 1, start);
+                        SamplerUpdate(pd->sampler, 0, 1);
                     }
                 }
             }
         }
-    }
 
-    /* 2. Cleanup Loop: Delete everything created.
-     * We iterate again to ensure we don't skip directories even if some file
-     * operations failed earlier.
-     */
-    for (uint32 d = 0; d < pd->num_dirs; d++) {
-        snprintf(dir_path, sizeof(dir_path), "%sprof_dir_%u/", pd->base_path, (unsigned int)d);
-
-        /* AmigaOS Delete requires that a directory be empty */
-        for (uint32 f = 0; f < pd->files_per_dir; f++) {
-            /* Try deleting both the original (if rename failed) and renamed variants */
-            snprintf(file_path, sizeof(file_path), "%sfile_%u.tmp", dir_path, (unsigned int)f);
-            IDOS->Delete(file_path);
-
-            snprintf(rename_path, sizeof(rename_path), "%sfile_%u_renamed.tmp", dir_path, (unsigned int)f);
-            IDOS->Delete(rename_path);
-            total_ops++;
+        /* 2. Cleanup Loop: Delete everything created.
+         * We iterate again to ensure we don't skip directories even if some file
+         * operations failed earlier.
+         */
+        for (uint32 d = 0; d < pd->num_dirs; d++) {
+            snprintf(dir_path, sizeof(dir_path), "%sprof_dir_%u/", pd->base_path, (unsigned int)d);
+
+            /* AmigaOS Delete requires that a directory be empty */
+            for (uint32 f = 0; f < pd->files_per_dir; f++) {
+                /* Time the name the file should have; fall back to the other one if its rename failed */
+                snprintf(file_path, sizeof(file_path), "%sfile_%u.tmp", dir_path, (unsigned int)f);
+                snprintf(rename_path, sizeof(rename_path), "%sfile_%u_renamed.tmp", dir_path, (unsigned int)f);
+                const char *expected = (f % 2 == 0) ? rename_path : file_path;
+                BenchTicks start = TimerNow();
+                if (PlatDelete(expected)) {
+                    MetaOpsRecord(&pd->meta, META_OP_DELETE, 1, start);
+                    SamplerUpdate(pd->sampler, 0, 1);
+                } else {
+                    PlatDelete((f % 2 == 0) ? file_path : rename_path);
+                }
+            }
+            /* Finally remove the directory */
+            BenchTicks start = TimerNow();
+            if (PlatDelete(dir_path)) {
+                MetaOpsRecord(&pd->meta, META_OP_RMDIR, 1, start);
+                SamplerUpdate(pd->sampler, 0, 1);
+            }
         }
-        /* Finally remove the directory */
-        IDOS->Delete(dir_path);
-        total_ops++;
-    }
+        cycles++;
+    } while (SamplerKeepRunning(pd->sampler, cycles, 1));
+
+    for (uint32 op = 0; op < META_OP_COUNT; op++)
+        total_ops += pd->meta.count[op];
 
-    /* We return the total number of metadata operations as the primary metric */
-    *bytes_processed = total_ops * 20;
+    *bytes_processed = (uint64)pd->meta.count[META_OP_CREATE] * PROFILER_FILE_BYTES;
     *op_count = total_ops;
     return (total_ops > 0);
 }
@@ -127,10 +154,20 @@ static BOOL Run_Profiler(void *data, uint32 *bytes_processed, uint32 *op_count)
 static void Cleanup_Profiler(void *data)
 {
     if (data) {
-        IExec->FreeVec(data);
+        PlatFree(data);
     }
 }
 
+static void SetSampler_Profiler(void *data, BenchSampler *sampler)
+{
+    ((struct ProfilerData *)data)->sampler = sampler;
+}
+
+static const MetaOpStats *GetMetaOps_Profiler(void *data)
+{
+    return &((struct ProfilerData *)data)->meta;
+}
+
 static void GetDefaultSettings_Profiler(uint32 *block_size, uint32 *passes)
 {
     *block_size = 0; /* Not used */
@@ -152,7 +189,9 @@ const BenchWorkload Workload_Profiler = {
         "  Files per dir:  10\n"
         "  Total files:    500 (200 on RAM:)\n"
         "  Operations:     ~1500 metadata ops per pass\n"
-        "  Metric:         IOPS (operations per second)\n"
+        "  Metric:         IOPS overall, plus ops/sec and latency\n"
+        "                  per operation (MakeDir, Create, Rename,\n"
+        "                  Delete, DeleteDir)\n"
         "  Block size:     N/A (pure metadata test)\n"
         "  Default passes: 2\n"
         "\n"
@@ -167,4 +206,6 @@ const BenchWorkload Workload_Profiler = {
     .Setup = Setup_Profiler,
     .Run = Run_Profiler,
     .Cleanup = Cleanup_Profiler,
-    .GetDefaultSettings = GetDefaultSettings_Profiler};
+    .GetDefaultSettings = GetDefaultSettings_Profiler,
+    .SetSampler = SetSampler_Profiler,
+    .GetMetaOps = GetMetaOps_Profiler};
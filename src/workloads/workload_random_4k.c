@@ -4,12 +4,15 @@
  */
 
 #include "engine_internal.h"
+#include "engine_access.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
 #include "workload_interface.h"
 #include <stdlib.h>
 
 #define RAND_BLOCK_SIZE 4096
-#define RAND_FILE_SIZE (64 * 1024 * 1024)    /* 64MB data set */
-#define RAND_RAM_FILE_SIZE (8 * 1024 * 1024) /* 8MB for RAM: */
+#define RAND_FILE_SIZE (64ULL * 1024 * 1024)    /* 64MB data set */
+#define RAND_RAM_FILE_SIZE (8ULL * 1024 * 1024) /* 8MB for RAM: */
 #define RAND_NUM_IOS 4096
 #define RAND_RAM_NUM_IOS 1024
 #define RAND_FILL_CHUNK (128 * 1024) /* 128KB fill chunk */
@@ -19,17 +22,19 @@ struct RandomData
 {
     char path[MAX_PATH_LEN];
     char file_path[MAX_PATH_LEN * 2];
-    BPTR file;
-    uint8 *buffer;
-    uint32 file_size;
+    PlatFile file;
+    DataPattern pattern; /* Write data, generated in Setup */
+    uint64 file_size;
     uint32 num_ios;
     uint32 block_size;
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+    OffsetGenerator offsets;
 };
 
-static BOOL Setup_Random4K(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Random4K(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct RandomData *rd =
-        IExec->AllocVecTags(sizeof(struct RandomData), AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
+    struct RandomData *rd = PlatAllocClear(sizeof(struct RandomData));
     if (!rd)
         return FALSE;
 
@@ -44,35 +49,47 @@ static BOOL Setup_Random4K(const char *path, uint32 block_size, void **data)
         rd->num_ios = RAND_RAM_NUM_IOS;
     }
 
+    /* An explicit data-set size overrides the defaults above, including the RAM: cap */
+    if (opts->dataset_bytes > 0)
+        rd->file_size = opts->dataset_bytes;
+
     snprintf(rd->file_path, sizeof(rd->file_path), "%sbench_random.tmp", path);
 
-    /* Pre-allocate and fill file */
-    if (WriteDummyFile(rd->file_path, rd->file_size, RAND_FILL_CHUNK) == 0) {
-        IExec->FreeVec(rd);
+    /* Pre-allocate and fill file (kept between queued jobs; the content is never read) */
+    if (!FixtureAcquire(path, rd->file_path, rd->file_size, RAND_FILL_CHUNK, TRUE, opts)) {
+        PlatFree(rd);
         return FALSE;
     }
 
-    rd->file = IDOS->Open(rd->file_path, MODE_OLDFILE);
+    rd->file = PlatOpen(rd->file_path, PLAT_OPEN_EXISTING);
     if (!rd->file) {
-        IDOS->Delete(rd->file_path);
-        IExec->FreeVec(rd);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
         return FALSE;
     }
 
-    rd->buffer = IExec->AllocVecTags(rd->block_size, AVT_Type, MEMF_SHARED, TAG_DONE);
-    if (!rd->buffer) {
-        IDOS->Close(rd->file);
-        IDOS->Delete(rd->file_path);
-        IExec->FreeVec(rd);
+    if (!DataPatternInit(&rd->pattern, opts, rd->block_size, 0x55)) {
+        PlatClose(rd->file);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
+        return FALSE;
+    }
+
+    /* Offsets for each pass are precomputed in PreparePass, outside the timed loop */
+    uint32 batch = OffsetGenBatchSize(opts, rd->num_ios);
+    if (!OffsetGenInit(&rd->offsets, opts, rd->file_size, rd->block_size, RAND_SECTOR_ALIGN + 1, batch)) {
+        DataPatternFree(&rd->pattern);
+        PlatClose(rd->file);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
         return FALSE;
     }
-    memset(rd->buffer, 0x55, rd->block_size);
 
     *data = rd;
     return TRUE;
 }
 
-static BOOL Run_Random4K(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Random4K(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct RandomData *rd = (struct RandomData *)data;
     uint64 total_bytes = 0;
@@ -82,25 +99,35 @@ static BOOL Run_Random4K(void *data, uint32 *bytes_processed, uint32 *op_count)
         *op_count = 0;
         return FALSE;
     }
-    uint32 max_offset = rd->file_size - rd->block_size;
 
-    for (uint32 i = 0; i < rd->num_ios; i++) {
-        uint32 offset = (uint32)rand() % max_offset;
-        /* Align to 512-byte boundary for realistic disk performance */
-        offset &= ~RAND_SECTOR_ALIGN;
+    LatencyReset(&rd->latency);
+
+    /* Fixed number of I/Os, or as many as fit before the deadline of a time-bounded pass */
+    uint32 done = 0;
+    for (; SamplerKeepRunning(rd->sampler, done, rd->num_ios); done++) {
+        /* Precomputed, 512-byte aligned offset from the job's access pattern */
+        uint64 offset = OffsetGenNext(&rd->offsets, rd->sampler);
 
-        /* ChangeFilePosition returns the old position, not a success flag.
-         * A return of -1 indicates error; any other value (including 0) is valid. */
-        if (IDOS->ChangeFilePosition(rd->file, offset, OFFSET_BEGINNING) != -1) {
-            if (IDOS->Write(rd->file, rd->buffer, rd->block_size) == rd->block_size) {
+        uint64 bytes_before = total_bytes;
+        uint8 *block = DataPatternNext(&rd->pattern, rd->block_size);
+
+        SamplerTraceIO(rd->sampler, TRACE_OP_WRITE, offset, rd->block_size);
+
+        /* Latency covers seek + write, i.e. one complete random I/O */
+        BenchTicks op_start = TimerNow();
+
+        if (PlatSeek(rd->file, offset)) {
+            if (PlatWrite(rd->file, block, rd->block_size) == rd->block_size) {
                 total_bytes += rd->block_size;
             }
         }
+
+        LatencyRecord(&rd->latency, TimerOpMicros(op_start, TimerNow()));
+        SamplerUpdate(rd->sampler, (uint32)(total_bytes - bytes_before), 1);
     }
 
-    /* Cap to uint32 max to avoid overflow — total_bytes can exceed 4GB with large block sizes */
-    *bytes_processed = (total_bytes > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32)total_bytes;
-    *op_count = rd->num_ios;
+    *bytes_processed = total_bytes;
+    *op_count = done;
     return (total_bytes > 0);
 }
 
@@ -109,14 +136,29 @@ static void Cleanup_Random4K(void *data)
     if (data) {
         struct RandomData *rd = (struct RandomData *)data;
         if (rd->file)
-            IDOS->Close(rd->file);
-        if (rd->buffer)
-            IExec->FreeVec(rd->buffer);
-        IDOS->Delete(rd->file_path);
-        IExec->FreeVec(rd);
+            PlatClose(rd->file);
+        DataPatternFree(&rd->pattern);
+        OffsetGenFree(&rd->offsets);
+        FixtureRelease(rd->file_path, TRUE); /* Overwritten with the write pattern */
+        PlatFree(rd);
     }
 }
 
+static const LatencyHistogram *GetLatency_Random4K(void *data)
+{
+    return &((struct RandomData *)data)->latency;
+}
+
+static void PreparePass_Random4K(void *data)
+{
+    OffsetGenPrepare(&((struct RandomData *)data)->offsets);
+}
+
+static void SetSampler_Random4K(void *data, BenchSampler *sampler)
+{
+    ((struct RandomData *)data)->sampler = sampler;
+}
+
 static void GetDefaultSettings_Random4K(uint32 *block_size, uint32 *passes)
 {
     *block_size = RAND_BLOCK_SIZE;
@@ -137,7 +179,9 @@ const BenchWorkload Workload_Random4K = {
         "  Operations:     4096 random writes (1024 on RAM:)\n"
         "  Block size:     Configurable (default 4 KB)\n"
         "  Seek alignment: 512-byte sectors\n"
+        "  Access pattern: Uniform (or Zipf, hot/cold, strided)\n"
         "  Metric:         IOPS (I/O operations per second)\n"
+        "  Latency:        p50/p90/p99/p99.9/max per operation\n"
         "  Default passes: 3\n"
         "\n"
         "Random I/O is the most demanding workload for mechanical\n"
@@ -151,4 +195,9 @@ const BenchWorkload Workload_Random4K = {
     .Setup = Setup_Random4K,
     .Run = Run_Random4K,
     .Cleanup = Cleanup_Random4K,
-    .GetDefaultSettings = GetDefaultSettings_Random4K};
+    .GetDefaultSettings = GetDefaultSettings_Random4K,
+    .GetLatency = GetLatency_Random4K,
+    .SetSampler = SetSampler_Random4K,
+    .PreparePass = PreparePass_Random4K,
+    .flags = WORKLOAD_F_ACCESS_PATTERN | WORKLOAD_F_TRACEABLE | WORKLOAD_F_DATA_PATTERN |
+             WORKLOAD_F_BUFFER_PLACEMENT};
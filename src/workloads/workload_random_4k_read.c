@@ -4,12 +4,16 @@
  */
 
 #include "engine_internal.h"
+#include "engine_access.h"
+#include "engine_buffer.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
 #include "workload_interface.h"
 #include <stdlib.h>
 
 #define RAND_READ_BLOCK_SIZE 4096
-#define RAND_READ_FILE_SIZE (64 * 1024 * 1024)    /* 64MB data set */
-#define RAND_READ_RAM_FILE_SIZE (8 * 1024 * 1024) /* 8MB for RAM: */
+#define RAND_READ_FILE_SIZE (64ULL * 1024 * 1024)    /* 64MB data set */
+#define RAND_READ_RAM_FILE_SIZE (8ULL * 1024 * 1024) /* 8MB for RAM: */
 #define RAND_READ_NUM_IOS 4096
 #define RAND_READ_RAM_NUM_IOS 1024
 #define RAND_READ_FILL_CHUNK (128 * 1024) /* 128KB fill chunk */
@@ -19,17 +23,21 @@ struct RandomReadData
 {
     char path[MAX_PATH_LEN];
     char file_path[MAX_PATH_LEN * 2];
-    BPTR file;
-    uint8 *buffer;
-    uint32 file_size;
+    PlatFile file;
+    XferBuffer xfer; /* Read buffer, placed as the job asks */
+    uint8 *buffer;   /* xfer.data */
+    uint64 file_size;
     uint32 num_ios;
     uint32 block_size;
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+    OffsetGenerator offsets;
+    VerifyState verify;
 };
 
-static BOOL Setup_Random4KRead(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Random4KRead(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct RandomReadData *rd =
-        IExec->AllocVecTags(sizeof(struct RandomReadData), AVT_Type, MEMF_SHARED, AVT_ClearWithValue, 0, TAG_DONE);
+    struct RandomReadData *rd = PlatAllocClear(sizeof(struct RandomReadData));
     if (!rd)
         return FALSE;
 
@@ -44,26 +52,41 @@ static BOOL Setup_Random4KRead(const char *path, uint32 block_size, void **data)
         rd->num_ios = RAND_READ_RAM_NUM_IOS;
     }
 
+    /* An explicit data-set size overrides the defaults above, including the RAM: cap */
+    if (opts->dataset_bytes > 0)
+        rd->file_size = opts->dataset_bytes;
+
     snprintf(rd->file_path, sizeof(rd->file_path), "%sbench_random_read.tmp", path);
 
     /* Pre-allocate and fill file */
-    if (WriteDummyFile(rd->file_path, rd->file_size, RAND_READ_FILL_CHUNK) == 0) {
-        IExec->FreeVec(rd);
+    VerifyInit(&rd->verify, opts);
+    if (!FixtureAcquire(path, rd->file_path, rd->file_size, RAND_READ_FILL_CHUNK, FALSE, opts)) {
+        PlatFree(rd);
         return FALSE;
     }
 
-    rd->file = IDOS->Open(rd->file_path, MODE_OLDFILE);
+    rd->file = PlatOpen(rd->file_path, PLAT_OPEN_EXISTING);
     if (!rd->file) {
-        IDOS->Delete(rd->file_path);
-        IExec->FreeVec(rd);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
         return FALSE;
     }
 
-    rd->buffer = IExec->AllocVecTags(rd->block_size, AVT_Type, MEMF_SHARED, TAG_DONE);
-    if (!rd->buffer) {
-        IDOS->Close(rd->file);
-        IDOS->Delete(rd->file_path);
-        IExec->FreeVec(rd);
+    if (!XferBufferAlloc(&rd->xfer, rd->block_size, opts)) {
+        PlatClose(rd->file);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
+        return FALSE;
+    }
+    rd->buffer = rd->xfer.data;
+
+    /* Offsets for each pass are precomputed in PreparePass, outside the timed loop */
+    uint32 batch = OffsetGenBatchSize(opts, rd->num_ios);
+    if (!OffsetGenInit(&rd->offsets, opts, rd->file_size, rd->block_size, RAND_READ_SECTOR_ALIGN + 1, batch)) {
+        XferBufferFree(&rd->xfer);
+        PlatClose(rd->file);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
         return FALSE;
     }
 
@@ -71,7 +94,7 @@ static BOOL Setup_Random4KRead(const char *path, uint32 block_size, void **data)
     return TRUE;
 }
 
-static BOOL Run_Random4KRead(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Random4KRead(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct RandomReadData *rd = (struct RandomReadData *)data;
     uint64 total_bytes = 0;
@@ -81,26 +104,39 @@ static BOOL Run_Random4KRead(void *data, uint32 *bytes_processed, uint32 *op_cou
         *op_count = 0;
         return FALSE;
     }
-    uint32 max_offset = rd->file_size - rd->block_size;
 
-    for (uint32 i = 0; i < rd->num_ios; i++) {
-        uint32 offset = (uint32)rand() % max_offset;
-        /* Align to 512-byte boundary for realistic disk performance */
-        offset &= ~RAND_READ_SECTOR_ALIGN;
+    LatencyReset(&rd->latency);
+    VerifyReset(&rd->verify);
+
+    /* Fixed number of I/Os, or as many as fit before the deadline of a time-bounded pass */
+    uint32 done = 0;
+    for (; SamplerKeepRunning(rd->sampler, done, rd->num_ios); done++) {
+        /* Precomputed, 512-byte aligned offset from the job's access pattern */
+        uint64 offset = OffsetGenNext(&rd->offsets, rd->sampler);
+
+        uint64 bytes_before = total_bytes;
+
+        SamplerTraceIO(rd->sampler, TRACE_OP_READ, offset, rd->block_size);
+
+        /* Latency covers seek + read, i.e. one complete random I/O */
+        BenchTicks op_start = TimerNow();
 
-        /* ChangeFilePosition returns the old position, not a success flag.
-         * A return of -1 indicates error; any other value (including 0) is valid. */
-        if (IDOS->ChangeFilePosition(rd->file, offset, OFFSET_BEGINNING) != -1) {
-            int32 bytes_read = IDOS->Read(rd->file, rd->buffer, rd->block_size);
+        int32 bytes_read = 0;
+        if (PlatSeek(rd->file, offset)) {
+            bytes_read = PlatRead(rd->file, rd->buffer, rd->block_size);
             if (bytes_read > 0) {
                 total_bytes += bytes_read;
             }
         }
+
+        LatencyRecord(&rd->latency, TimerOpMicros(op_start, TimerNow()));
+        if (rd->verify.enabled && bytes_read > 0)
+            VerifyCheck(&rd->verify, rd->sampler, rd->buffer, (uint32)bytes_read, offset);
+        SamplerUpdate(rd->sampler, (uint32)(total_bytes - bytes_before), 1);
     }
 
-    /* Cap to uint32 max to avoid overflow — total_bytes can exceed 4GB with large block sizes */
-    *bytes_processed = (total_bytes > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32)total_bytes;
-    *op_count = rd->num_ios;
+    *bytes_processed = total_bytes;
+    *op_count = done;
     return (total_bytes > 0);
 }
 
@@ -109,14 +145,46 @@ static void Cleanup_Random4KRead(void *data)
     if (data) {
         struct RandomReadData *rd = (struct RandomReadData *)data;
         if (rd->file)
-            IDOS->Close(rd->file);
-        if (rd->buffer)
-            IExec->FreeVec(rd->buffer);
-        IDOS->Delete(rd->file_path);
-        IExec->FreeVec(rd);
+            PlatClose(rd->file);
+        XferBufferFree(&rd->xfer);
+        OffsetGenFree(&rd->offsets);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
     }
 }
 
+static const LatencyHistogram *GetLatency_Random4KRead(void *data)
+{
+    return &((struct RandomReadData *)data)->latency;
+}
+
+static void PreparePass_Random4KRead(void *data)
+{
+    OffsetGenPrepare(&((struct RandomReadData *)data)->offsets);
+}
+
+static void SetSampler_Random4KRead(void *data, BenchSampler *sampler)
+{
+    ((struct RandomReadData *)data)->sampler = sampler;
+}
+
+static BOOL SetFilesOpen_Random4KRead(void *data, BOOL open)
+{
+    struct RandomReadData *rd = (struct RandomReadData *)data;
+    if (open && !rd->file)
+        rd->file = PlatOpen(rd->file_path, PLAT_OPEN_EXISTING);
+    else if (!open && rd->file) {
+        PlatClose(rd->file);
+        rd->file = 0;
+    }
+    return (open == (rd->file != 0));
+}
+
+static const VerifyState *GetVerify_Random4KRead(void *data)
+{
+    return &((struct RandomReadData *)data)->verify;
+}
+
 static void GetDefaultSettings_Random4KRead(uint32 *block_size, uint32 *passes)
 {
     *block_size = RAND_READ_BLOCK_SIZE;
@@ -137,7 +205,9 @@ const BenchWorkload Workload_Random4KRead = {
         "  Operations:     4096 random reads (1024 on RAM:)\n"
         "  Block size:     Configurable (default 4 KB)\n"
         "  Seek alignment: 512-byte sectors\n"
+        "  Access pattern: Uniform (or Zipf, hot/cold, strided)\n"
         "  Metric:         IOPS (I/O operations per second)\n"
+        "  Latency:        p50/p90/p99/p99.9/max per operation\n"
         "  Default passes: 3\n"
         "\n"
         "Random reads are the bread and butter of application loading\n"
@@ -151,4 +221,10 @@ const BenchWorkload Workload_Random4KRead = {
     .Setup = Setup_Random4KRead,
     .Run = Run_Random4KRead,
     .Cleanup = Cleanup_Random4KRead,
-    .GetDefaultSettings = GetDefaultSettings_Random4KRead};
+    .GetDefaultSettings = GetDefaultSettings_Random4KRead,
+    .GetLatency = GetLatency_Random4KRead,
+    .SetSampler = SetSampler_Random4KRead,
+    .PreparePass = PreparePass_Random4KRead,
+    .SetFilesOpen = SetFilesOpen_Random4KRead,
+    .GetVerify = GetVerify_Random4KRead,
+    .flags = WORKLOAD_F_ACCESS_PATTERN | WORKLOAD_F_TRACEABLE | WORKLOAD_F_BUFFER_PLACEMENT};
@@ -0,0 +1,806 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ */
+
+#include "engine_internal.h"
+#include "engine_access.h"
+#include "engine_blockdev.h"
+#include "workload_interface.h"
+
+#define RAW_SEQ_DEFAULT_BLOCK (1024 * 1024)        /* 1MB, as Sequential Read */
+#define RAW_SEQ_PASS_BYTES (256ULL * 1024 * 1024)  /* 256MB per pass, as Sequential Read */
+#define RAW_RAND_DEFAULT_BLOCK 4096
+#define RAW_RAND_NUM_IOS 4096
+#define RAW_ZONE_DEFAULT_BLOCK (1024 * 1024)
+#define RAW_ZONE_PASS_BYTES (512ULL * 1024 * 1024) /* Split over the zones of a pass */
+#define RAW_SEEK_DEFAULT_BLOCK 4096
+#define RAW_SEEK_ROUNDS 32                         /* Pairs per distance per pass */
+#define RAW_QUEUE_DEFAULT_BLOCK 4096
+#define RAW_QUEUE_NUM_IOS 4096                     /* Completed requests per pass, whatever the depth */
+
+/* Requests in flight of a sweep: from one at a time up to a full NCQ queue */
+static const uint32 queue_depth_levels[] = {1, 2, 4, 8, 16, 32};
+#define QUEUE_NUM_LEVELS (sizeof(queue_depth_levels) / sizeof(queue_depth_levels[0]))
+
+struct RawReadData
+{
+    BlockDevice dev;
+    RawSchedule schedule;
+    uint8 *buffer;
+    uint32 num_ios; /* Per fixed-work pass */
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+};
+
+struct ZoneScanData
+{
+    BlockDevice dev;
+    ZoneStats zones;
+    uint8 *buffer;
+    uint32 io_bytes;
+    BenchSampler *sampler;
+};
+
+struct SeekProfileData
+{
+    BlockDevice dev;
+    SeekStats seeks;
+    FastRand rng;
+    uint8 *buffer;
+    uint32 io_bytes;
+    LatencyHistogram latency; /* All timed reads, whatever their distance */
+    BenchSampler *sampler;
+};
+
+struct QueueDepthData
+{
+    BlockDevice dev;
+    RawSchedule schedule;
+    uint8 *buffer;                          /* One io_bytes slice per slot */
+    uint32 depth;
+    BenchTicks issued[BLOCKDEV_MAX_QUEUE];  /* Submit time of each slot's request */
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+};
+
+uint32 GetQueueDepthLevels(uint32 *levels, uint32 max_levels)
+{
+    uint32 count = 0;
+    for (uint32 i = 0; i < QUEUE_NUM_LEVELS && count < max_levels; i++)
+        levels[count++] = queue_depth_levels[i];
+    return count;
+}
+
+uint32 GetQueueDepthSaturation(const uint32 *depths, const float *iops, uint32 count)
+{
+    if (count == 0)
+        return 0;
+    for (uint32 i = 0; i + 1 < count; i++) {
+        if (iops[i + 1] < iops[i] * (100 + QUEUE_SATURATION_GAIN_PCT) / 100.0f)
+            return depths[i];
+    }
+    return depths[count - 1];
+}
+
+/*
+ * Open the device behind the target volume, or the RawImagePath stand-in.
+ * Nothing is ever written: both backends only implement Read.
+ */
+static BOOL OpenRawDevice(BlockDevice *dev, const char *path, const BenchOptions *opts, const char *label)
+{
+    BOOL opened;
+    if (opts->raw_image_path[0]) {
+        opened = BlockDevOpenFile(dev, opts->raw_image_path, 0);
+        if (!opened)
+            LogUser("%s: cannot open image %s", label, opts->raw_image_path);
+    } else {
+        char device[64];
+        uint32 unit = 0;
+        opened = GetDeviceFromVolume(path, device, sizeof(device), &unit);
+        if (!opened)
+            LogUser("%s: %s is not backed by a block device", label, path);
+        else if (!(opened = BlockDevOpenExec(dev, device, unit)))
+            LogUser("%s: cannot read %s unit %u with 64-bit commands", label, device, (unsigned int)unit);
+    }
+    return opened;
+}
+
+static BOOL Setup_RawRead(const char *path, uint32 block_size, const BenchOptions *opts, RawOrder order,
+                          void **data)
+{
+    struct RawReadData *rd = PlatAllocClear(sizeof(struct RawReadData));
+    if (!rd)
+        return FALSE;
+
+    if (!OpenRawDevice(&rd->dev, path, opts, "Raw Read")) {
+        PlatFree(rd);
+        return FALSE;
+    }
+
+    uint32 io_bytes = BlockDevIOSize(&rd->dev, block_size);
+    uint64 seed = opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED;
+    if (!RawScheduleInit(&rd->schedule, &rd->dev, order, io_bytes, seed)) {
+        LogUser("Raw Read: %s is smaller than one %u-byte request", rd->dev.name, (unsigned int)io_bytes);
+        BlockDevClose(&rd->dev);
+        PlatFree(rd);
+        return FALSE;
+    }
+
+    if (order == RAW_ORDER_RANDOM) {
+        rd->num_ios = RAW_RAND_NUM_IOS;
+    } else {
+        uint64 pass_bytes = opts->dataset_bytes ? opts->dataset_bytes : RAW_SEQ_PASS_BYTES;
+        if (pass_bytes > rd->dev.capacity_bytes)
+            pass_bytes = rd->dev.capacity_bytes;
+        uint64 ios = pass_bytes / io_bytes;
+        rd->num_ios = (uint32)((ios == 0) ? 1 : (ios > 0xFFFFFFFFULL ? 0xFFFFFFFFULL : ios));
+    }
+
+    rd->buffer = PlatAlloc(io_bytes);
+    if (!rd->buffer) {
+        BlockDevClose(&rd->dev);
+        PlatFree(rd);
+        return FALSE;
+    }
+
+    LOG_DEBUG("RawRead: %s, %llu bytes, %u-byte %s requests", rd->dev.name,
+              (unsigned long long)rd->dev.capacity_bytes, (unsigned int)io_bytes,
+              order == RAW_ORDER_RANDOM ? "random" : "sequential");
+
+    *data = rd;
+    return TRUE;
+}
+
+static BOOL Setup_RawSeqRead(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    return Setup_RawRead(path, block_size, opts, RAW_ORDER_SEQUENTIAL, data);
+}
+
+static BOOL Setup_RawRandomRead(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    return Setup_RawRead(path, block_size, opts, RAW_ORDER_RANDOM, data);
+}
+
+static BOOL Run_RawRead(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct RawReadData *rd = (struct RawReadData *)data;
+    uint32 io_bytes = rd->schedule.io_bytes;
+    uint64 total_bytes = 0;
+    uint32 errors_before = rd->dev.errors;
+
+    LatencyReset(&rd->latency);
+
+    uint32 done = 0;
+    for (; SamplerKeepRunning(rd->sampler, done, rd->num_ios); done++) {
+        uint64 offset = RawScheduleNext(&rd->schedule);
+        uint32 got = 0;
+
+        BenchTicks op_start = TimerNow();
+        if (BlockDevRead(&rd->dev, offset, rd->buffer, io_bytes))
+            got = io_bytes;
+
+        total_bytes += got;
+        LatencyRecord(&rd->latency, TimerOpMicros(op_start, TimerNow()));
+        SamplerUpdate(rd->sampler, got, 1);
+    }
+
+    if (rd->dev.errors != errors_before)
+        LogUser("Raw Read: %u of %u requests failed on %s", (unsigned int)(rd->dev.errors - errors_before),
+                (unsigned int)done, rd->dev.name);
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (total_bytes > 0);
+}
+
+static void Cleanup_RawRead(void *data)
+{
+    if (data) {
+        struct RawReadData *rd = (struct RawReadData *)data;
+        LOG_DEBUG("RawRead: %s closed after %u requests, %llu bytes, %u errors", rd->dev.name,
+                  (unsigned int)rd->dev.reads, (unsigned long long)rd->dev.bytes_read, (unsigned int)rd->dev.errors);
+        if (rd->buffer)
+            PlatFree(rd->buffer);
+        BlockDevClose(&rd->dev);
+        PlatFree(rd);
+    }
+}
+
+static const LatencyHistogram *GetLatency_RawRead(void *data)
+{
+    return &((struct RawReadData *)data)->latency;
+}
+
+static void SetSampler_RawRead(void *data, BenchSampler *sampler)
+{
+    ((struct RawReadData *)data)->sampler = sampler;
+}
+
+/**
+ * Setup_RawZoneScan
+ *
+ * Lays the zones out over the whole LBA range: the pass's bytes (DataSetMB,
+ * default 512 MB) are split evenly between them, shrunk to fit a small device
+ * or image.
+ */
+static BOOL Setup_RawZoneScan(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    struct ZoneScanData *zd = PlatAllocClear(sizeof(struct ZoneScanData));
+    if (!zd)
+        return FALSE;
+
+    if (!OpenRawDevice(&zd->dev, path, opts, "Raw Zone Scan")) {
+        PlatFree(zd);
+        return FALSE;
+    }
+
+    uint32 zones = opts->zone_count ? opts->zone_count : ZONE_MAP_MAX;
+    if (zones < 2)
+        zones = 2;
+    if (zones > ZONE_MAP_MAX)
+        zones = ZONE_MAP_MAX;
+    zd->io_bytes = BlockDevIOSize(&zd->dev, block_size);
+
+    uint64 pass_bytes = opts->dataset_bytes ? opts->dataset_bytes : RAW_ZONE_PASS_BYTES;
+    uint64 span = pass_bytes / zones;
+    if (span > zd->dev.capacity_bytes / zones)
+        span = zd->dev.capacity_bytes / zones;
+    span = span / zd->io_bytes * zd->io_bytes;
+    if (span < zd->io_bytes)
+        span = zd->io_bytes; /* A data set smaller than one request per zone still reads one */
+    if (!ZoneStatsInit(&zd->zones, zd->dev.capacity_bytes, zd->dev.block_bytes, zones, span)) {
+        LogUser("Raw Zone Scan: %s is too small for %u zones of one %u-byte request", zd->dev.name,
+                (unsigned int)zones, (unsigned int)zd->io_bytes);
+        BlockDevClose(&zd->dev);
+        PlatFree(zd);
+        return FALSE;
+    }
+
+    zd->buffer = PlatAlloc(zd->io_bytes);
+    if (!zd->buffer) {
+        BlockDevClose(&zd->dev);
+        PlatFree(zd);
+        return FALSE;
+    }
+
+    LOG_DEBUG("RawZoneScan: %s, %llu bytes, %u zones of %llu bytes", zd->dev.name,
+              (unsigned long long)zd->dev.capacity_bytes, (unsigned int)zones, (unsigned long long)span);
+
+    *data = zd;
+    return TRUE;
+}
+
+/**
+ * Run_RawZoneScan
+ *
+ * Reads the span of every zone in turn, outermost first. The first request of
+ * a zone carries the seek from the previous one, so it is read but not timed
+ * (unless it is the zone's only request).
+ */
+static BOOL Run_RawZoneScan(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct ZoneScanData *zd = (struct ZoneScanData *)data;
+    uint64 total_bytes = 0;
+    uint32 done = 0;
+    uint32 cycles = 0;
+    uint32 errors_before = zd->dev.errors;
+
+    ZoneStatsReset(&zd->zones);
+
+    /* One scan per pass, or repeated scans until the deadline of a time-bounded pass */
+    do {
+        for (uint32 z = 0; z < zd->zones.zones; z++) {
+            uint64 offset = zd->zones.offset[z];
+            uint64 end = offset + zd->zones.span_bytes;
+            BOOL positioned = (zd->zones.span_bytes == zd->io_bytes);
+            if (!positioned && BlockDevRead(&zd->dev, offset, zd->buffer, zd->io_bytes)) {
+                offset += zd->io_bytes;
+                total_bytes += zd->io_bytes;
+                SamplerUpdate(zd->sampler, zd->io_bytes, 1);
+                done++;
+            }
+
+            BenchTicks start = TimerNow();
+            uint64 zone_bytes = 0;
+            for (; offset < end; offset += zd->io_bytes) {
+                uint32 got = BlockDevRead(&zd->dev, offset, zd->buffer, zd->io_bytes) ? zd->io_bytes : 0;
+                zone_bytes += got;
+                SamplerUpdate(zd->sampler, got, 1);
+                done++;
+            }
+            ZoneStatsRecord(&zd->zones, z, zone_bytes, start);
+            total_bytes += zone_bytes;
+        }
+        cycles++;
+    } while (SamplerKeepRunning(zd->sampler, cycles, 1));
+
+    if (zd->dev.errors != errors_before)
+        LogUser("Raw Zone Scan: %u of %u requests failed on %s", (unsigned int)(zd->dev.errors - errors_before),
+                (unsigned int)done, zd->dev.name);
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (total_bytes > 0 && zd->dev.errors == errors_before);
+}
+
+static void Cleanup_RawZoneScan(void *data)
+{
+    if (data) {
+        struct ZoneScanData *zd = (struct ZoneScanData *)data;
+        if (zd->buffer)
+            PlatFree(zd->buffer);
+        BlockDevClose(&zd->dev);
+        PlatFree(zd);
+    }
+}
+
+static const ZoneStats *GetZones_RawZoneScan(void *data)
+{
+    return &((struct ZoneScanData *)data)->zones;
+}
+
+static void SetSampler_RawZoneScan(void *data, BenchSampler *sampler)
+{
+    ((struct ZoneScanData *)data)->sampler = sampler;
+}
+
+/**
+ * Setup_RawSeekProfile
+ *
+ * Lays out the distances from one request (adjacent blocks) doubling up to
+ * the first-to-last-block full stroke of the device or image.
+ */
+static BOOL Setup_RawSeekProfile(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    struct SeekProfileData *sd = PlatAllocClear(sizeof(struct SeekProfileData));
+    if (!sd)
+        return FALSE;
+
+    if (!OpenRawDevice(&sd->dev, path, opts, "Raw Seek Profile")) {
+        PlatFree(sd);
+        return FALSE;
+    }
+
+    sd->io_bytes = BlockDevIOSize(&sd->dev, block_size);
+    if (!SeekStatsInit(&sd->seeks, sd->dev.capacity_bytes, sd->io_bytes)) {
+        LogUser("Raw Seek Profile: %s is too small for seeks between %u-byte requests", sd->dev.name,
+                (unsigned int)sd->io_bytes);
+        BlockDevClose(&sd->dev);
+        PlatFree(sd);
+        return FALSE;
+    }
+    FastRandSeed(&sd->rng, opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED);
+
+    sd->buffer = PlatAlloc(sd->io_bytes);
+    if (!sd->buffer) {
+        BlockDevClose(&sd->dev);
+        PlatFree(sd);
+        return FALSE;
+    }
+
+    LOG_DEBUG("RawSeekProfile: %s, %llu bytes, %u distances of %u-byte requests", sd->dev.name,
+              (unsigned long long)sd->dev.capacity_bytes, (unsigned int)sd->seeks.levels, (unsigned int)sd->io_bytes);
+
+    *data = sd;
+    return TRUE;
+}
+
+/**
+ * Run_RawSeekProfile
+ *
+ * Reads pairs of requests a set distance apart from a random start: the
+ * first read (untimed) puts the head in place, the second is timed and
+ * carries the seek. Every round visits each distance once, so a disturbance
+ * mid-pass is spread over the curve rather than landing on one distance;
+ * alternate pairs seek backwards.
+ */
+static BOOL Run_RawSeekProfile(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct SeekProfileData *sd = (struct SeekProfileData *)data;
+    uint64 total_bytes = 0;
+    uint32 done = 0;
+    uint32 rounds = 0;
+    uint32 errors_before = sd->dev.errors;
+
+    SeekStatsReset(&sd->seeks);
+    LatencyReset(&sd->latency);
+
+    /* Fixed number of rounds, or as many as fit before the deadline of a time-bounded pass */
+    while (SamplerKeepRunning(sd->sampler, rounds, RAW_SEEK_ROUNDS)) {
+        for (uint32 level = 0; level < sd->seeks.levels; level++) {
+            uint64 distance = sd->seeks.distance[level];
+            uint64 starts = (sd->dev.capacity_bytes - distance) / sd->io_bytes; /* Pairs that fit */
+            uint64 near = FastRandRange(&sd->rng, starts) * sd->io_bytes;
+            uint64 from = near, to = near + distance;
+            if ((rounds + level) & 1) {
+                from = to;
+                to = near;
+            }
+
+            uint32 got = BlockDevRead(&sd->dev, from, sd->buffer, sd->io_bytes) ? sd->io_bytes : 0;
+            BenchTicks start = TimerNow();
+            if (BlockDevRead(&sd->dev, to, sd->buffer, sd->io_bytes)) {
+                uint32 micros = TimerOpMicros(start, TimerNow());
+                SeekStatsRecord(&sd->seeks, level, micros);
+                LatencyRecord(&sd->latency, micros);
+                got += sd->io_bytes;
+            }
+            total_bytes += got;
+            done += 2;
+            SamplerUpdate(sd->sampler, got, 2);
+        }
+        rounds++;
+    }
+
+    if (sd->dev.errors != errors_before)
+        LogUser("Raw Seek Profile: %u of %u requests failed on %s", (unsigned int)(sd->dev.errors - errors_before),
+                (unsigned int)done, sd->dev.name);
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (total_bytes > 0 && sd->dev.errors == errors_before);
+}
+
+static void Cleanup_RawSeekProfile(void *data)
+{
+    if (data) {
+        struct SeekProfileData *sd = (struct SeekProfileData *)data;
+        if (sd->buffer)
+            PlatFree(sd->buffer);
+        BlockDevClose(&sd->dev);
+        PlatFree(sd);
+    }
+}
+
+static const LatencyHistogram *GetLatency_RawSeekProfile(void *data)
+{
+    return &((struct SeekProfileData *)data)->latency;
+}
+
+static void SetSampler_RawSeekProfile(void *data, BenchSampler *sampler)
+{
+    ((struct SeekProfileData *)data)->sampler = sampler;
+}
+
+static const SeekStats *GetSeeks_RawSeekProfile(void *data)
+{
+    return &((struct SeekProfileData *)data)->seeks;
+}
+
+/**
+ * Setup_RawQueueDepth
+ *
+ * Opens the device with one request slot (and buffer) per request to keep in
+ * flight. Offsets are uniformly random over the whole device, as in Raw
+ * Random Read, so the drive has room to reorder them.
+ */
+static BOOL Setup_RawQueueDepth(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    struct QueueDepthData *qd = PlatAllocClear(sizeof(struct QueueDepthData));
+    if (!qd)
+        return FALSE;
+
+    if (!OpenRawDevice(&qd->dev, path, opts, "Raw Queue Depth")) {
+        PlatFree(qd);
+        return FALSE;
+    }
+
+    qd->depth = opts->queue_depth ? opts->queue_depth : 1;
+    if (qd->depth > BLOCKDEV_MAX_QUEUE)
+        qd->depth = BLOCKDEV_MAX_QUEUE;
+    if (!BlockDevQueueInit(&qd->dev, qd->depth)) {
+        LogUser("Raw Queue Depth: cannot set up %u requests on %s", (unsigned int)qd->depth, qd->dev.name);
+        BlockDevClose(&qd->dev);
+        PlatFree(qd);
+        return FALSE;
+    }
+
+    uint32 io_bytes = BlockDevIOSize(&qd->dev, block_size);
+    uint64 seed = opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED;
+    if (!RawScheduleInit(&qd->schedule, &qd->dev, RAW_ORDER_RANDOM, io_bytes, seed)) {
+        LogUser("Raw Queue Depth: %s is smaller than one %u-byte request", qd->dev.name, (unsigned int)io_bytes);
+        BlockDevClose(&qd->dev);
+        PlatFree(qd);
+        return FALSE;
+    }
+
+    qd->buffer = PlatAlloc(io_bytes * qd->depth);
+    if (!qd->buffer) {
+        BlockDevClose(&qd->dev);
+        PlatFree(qd);
+        return FALSE;
+    }
+
+    LOG_DEBUG("RawQueueDepth: %s, %llu bytes, %u-byte random requests, %u in flight", qd->dev.name,
+              (unsigned long long)qd->dev.capacity_bytes, (unsigned int)io_bytes, (unsigned int)qd->depth);
+
+    *data = qd;
+    return TRUE;
+}
+
+/* Start the next scheduled request in a free slot */
+static void SubmitNext(struct QueueDepthData *qd, uint32 slot)
+{
+    uint32 io_bytes = qd->schedule.io_bytes;
+    qd->issued[slot] = TimerNow();
+    BlockDevSubmit(&qd->dev, slot, RawScheduleNext(&qd->schedule), qd->buffer + slot * io_bytes, io_bytes);
+}
+
+/**
+ * Run_RawQueueDepth
+ *
+ * Fills every slot, then refills each slot as soon as its request completes,
+ * so the device always has depth requests queued. The latency of a request
+ * runs from its submission to its completion, waiting in the queue included.
+ */
+static BOOL Run_RawQueueDepth(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct QueueDepthData *qd = (struct QueueDepthData *)data;
+    uint32 io_bytes = qd->schedule.io_bytes;
+    uint64 total_bytes = 0;
+    uint32 submitted = 0;
+    uint32 done = 0;
+    uint32 errors_before = qd->dev.errors;
+
+    LatencyReset(&qd->latency);
+
+    /* Fixed number of requests, or as many as complete before the deadline of a time-bounded pass */
+    for (uint32 slot = 0; slot < qd->depth; slot++) {
+        if (!SamplerKeepRunning(qd->sampler, submitted, RAW_QUEUE_NUM_IOS))
+            break;
+        SubmitNext(qd, slot);
+        submitted++;
+    }
+
+    BOOL ok;
+    int32 slot;
+    while ((slot = BlockDevWaitAny(&qd->dev, &ok)) >= 0) {
+        LatencyRecord(&qd->latency, TimerOpMicros(qd->issued[slot], TimerNow()));
+        uint32 got = ok ? io_bytes : 0;
+        total_bytes += got;
+        done++;
+        SamplerUpdate(qd->sampler, got, 1);
+
+        if (SamplerKeepRunning(qd->sampler, submitted, RAW_QUEUE_NUM_IOS)) {
+            SubmitNext(qd, (uint32)slot);
+            submitted++;
+        }
+    }
+
+    if (qd->dev.errors != errors_before)
+        LogUser("Raw Queue Depth: %u of %u requests failed on %s", (unsigned int)(qd->dev.errors - errors_before),
+                (unsigned int)submitted, qd->dev.name);
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (total_bytes > 0);
+}
+
+static void Cleanup_RawQueueDepth(void *data)
+{
+    if (data) {
+        struct QueueDepthData *qd = (struct QueueDepthData *)data;
+        BlockDevClose(&qd->dev); /* Waits for the requests still reading into the buffer */
+        if (qd->buffer)
+            PlatFree(qd->buffer);
+        PlatFree(qd);
+    }
+}
+
+static const LatencyHistogram *GetLatency_RawQueueDepth(void *data)
+{
+    return &((struct QueueDepthData *)data)->latency;
+}
+
+static void SetSampler_RawQueueDepth(void *data, BenchSampler *sampler)
+{
+    ((struct QueueDepthData *)data)->sampler = sampler;
+}
+
+static void GetDefaultSettings_RawSeqRead(uint32 *block_size, uint32 *passes)
+{
+    *block_size = RAW_SEQ_DEFAULT_BLOCK;
+    *passes = 3;
+}
+
+static void GetDefaultSettings_RawRandomRead(uint32 *block_size, uint32 *passes)
+{
+    *block_size = RAW_RAND_DEFAULT_BLOCK;
+    *passes = 3;
+}
+
+static void GetDefaultSettings_RawZoneScan(uint32 *block_size, uint32 *passes)
+{
+    *block_size = RAW_ZONE_DEFAULT_BLOCK;
+    *passes = 2;
+}
+
+static void GetDefaultSettings_RawSeekProfile(uint32 *block_size, uint32 *passes)
+{
+    *block_size = RAW_SEEK_DEFAULT_BLOCK;
+    *passes = 2;
+}
+
+static void GetDefaultSettings_RawQueueDepth(uint32 *block_size, uint32 *passes)
+{
+    *block_size = RAW_QUEUE_DEFAULT_BLOCK;
+    *passes = 3;
+}
+
+const BenchWorkload Workload_RawSeqRead = {
+    .type = TEST_RAW_SEQ_READ,
+    .name = "Raw Sequential Read",
+    .description = "Device throughput: Sequential reads, no filesystem",
+    .detailed_info =
+        "Raw Sequential Read\n"
+        "\n"
+        "Reads the block device behind the target volume directly\n"
+        "with 64-bit trackdisk commands (NSCMD_TD_READ64, or\n"
+        "TD_READ64 on older drivers), bypassing the filesystem.\n"
+        "Read-only: nothing on the disk is modified.\n"
+        "\n"
+        "  Range:          Whole device, from LBA 0\n"
+        "  Per pass:       256 MB (DataSetMB), continuing where the\n"
+        "                  previous pass stopped and wrapping at the end\n"
+        "  Block size:     Configurable (default 1 MB, whole sectors)\n"
+        "  Metric:         MB/s\n"
+        "  Latency:        p50/p90/p99/p99.9/max per request\n"
+        "  Default passes: 3\n"
+        "\n"
+        "Compare with Sequential Read on the same volume: the gap\n"
+        "is the filesystem's overhead, the raw figure is what the\n"
+        "driver and drive deliver. RawImagePath in prefs reads an\n"
+        "image file instead of the device.\n"
+        "\n"
+        "Good for: Separating driver throughput from filesystem cost.\n"
+        "Simulates: Disk imaging, surface scans.\n",
+    .Setup = Setup_RawSeqRead,
+    .Run = Run_RawRead,
+    .Cleanup = Cleanup_RawRead,
+    .GetDefaultSettings = GetDefaultSettings_RawSeqRead,
+    .GetLatency = GetLatency_RawRead,
+    .SetSampler = SetSampler_RawRead};
+
+const BenchWorkload Workload_RawRandomRead = {
+    .type = TEST_RAW_RANDOM_READ,
+    .name = "Raw Random Read",
+    .description = "Device seek performance: Random reads, no filesystem",
+    .detailed_info =
+        "Raw Random Read\n"
+        "\n"
+        "Reads uniformly random blocks across the whole block device\n"
+        "behind the target volume with 64-bit trackdisk commands,\n"
+        "bypassing the filesystem. Read-only: nothing on the disk is\n"
+        "modified.\n"
+        "\n"
+        "  Range:          Whole device (every LBA is a candidate)\n"
+        "  Operations:     4096 random reads\n"
+        "  Block size:     Configurable (default 4 KB, whole sectors)\n"
+        "  Seed:           AccessSeed in prefs (fixed by default)\n"
+        "  Metric:         IOPS (I/O operations per second)\n"
+        "  Latency:        p50/p90/p99/p99.9/max per request\n"
+        "  Default passes: 3\n"
+        "\n"
+        "Unlike Random Read I/O, whose 64 MB file keeps seeks short,\n"
+        "this spans the full stroke of a hard disk, so it shows the\n"
+        "drive's true average access time. RawImagePath in prefs\n"
+        "reads an image file instead of the device.\n"
+        "\n"
+        "Good for: Full-stroke access time, driver overhead per request.\n"
+        "Simulates: Scattered access over a full disk.\n",
+    .Setup = Setup_RawRandomRead,
+    .Run = Run_RawRead,
+    .Cleanup = Cleanup_RawRead,
+    .GetDefaultSettings = GetDefaultSettings_RawRandomRead,
+    .GetLatency = GetLatency_RawRead,
+    .SetSampler = SetSampler_RawRead};
+
+const BenchWorkload Workload_RawZoneScan = {
+    .type = TEST_RAW_ZONE_SCAN,
+    .name = "Raw Zone Scan",
+    .description = "Device zones: Throughput from the first to the last LBA",
+    .detailed_info =
+        "Raw Zone Scan\n"
+        "\n"
+        "Reads the same amount at evenly spaced positions from the\n"
+        "first to the last LBA of the block device behind the target\n"
+        "volume, bypassing the filesystem. Read-only: nothing on the\n"
+        "disk is modified.\n"
+        "\n"
+        "  Zones:          32 positions, outer (LBA 0) to inner\n"
+        "  Per pass:       512 MB (DataSetMB), split between the zones\n"
+        "  Block size:     Configurable (default 1 MB, whole sectors)\n"
+        "  Metric:         MB/s overall, plus MB/s per zone\n"
+        "  Default passes: 2\n"
+        "\n"
+        "A hard disk packs more sectors into its outer tracks, so it\n"
+        "typically loses 40-50% of its throughput towards the last\n"
+        "LBA, while an SSD stays flat. Zones well below that trend\n"
+        "are flagged as possible weak areas (remapped sectors, a\n"
+        "struggling head). The details window charts the map.\n"
+        "RawImagePath in prefs reads an image file instead.\n"
+        "\n"
+        "Good for: Zoned-recording falloff, finding slow areas.\n"
+        "Simulates: Surface scans, placing partitions on fast zones.\n",
+    .Setup = Setup_RawZoneScan,
+    .Run = Run_RawZoneScan,
+    .Cleanup = Cleanup_RawZoneScan,
+    .GetDefaultSettings = GetDefaultSettings_RawZoneScan,
+    .SetSampler = SetSampler_RawZoneScan,
+    .GetZones = GetZones_RawZoneScan};
+
+const BenchWorkload Workload_RawSeekProfile = {
+    .type = TEST_RAW_SEEK_PROFILE,
+    .name = "Raw Seek Profile",
+    .description = "Device mechanics: Read latency against seek distance",
+    .detailed_info =
+        "Raw Seek Profile\n"
+        "\n"
+        "Reads pairs of blocks a known distance apart on the block\n"
+        "device behind the target volume, bypassing the filesystem,\n"
+        "and times the second read of each pair. Read-only: nothing\n"
+        "on the disk is modified.\n"
+        "\n"
+        "  Distances:      Adjacent, doubling up to the full stroke\n"
+        "                  (first to last block)\n"
+        "  Pairs:          32 per distance per pass, random start,\n"
+        "                  alternating direction\n"
+        "  Block size:     Configurable (default 4 KB, whole sectors)\n"
+        "  Metric:         Mean latency per distance\n"
+        "  Default passes: 2\n"
+        "\n"
+        "From the curve the test estimates the drive's rotational\n"
+        "latency (from the spread of the long seeks, with the RPM\n"
+        "it implies), its track-to-track seek and its full-stroke\n"
+        "seek. An SSD or a cached image shows a flat curve and no\n"
+        "rotation. The details window charts the curve.\n"
+        "RawImagePath in prefs reads an image file instead.\n"
+        "\n"
+        "Good for: Drive mechanics, comparing drives and adapters.\n"
+        "Simulates: Seek-bound access, partition placement.\n",
+    .Setup = Setup_RawSeekProfile,
+    .Run = Run_RawSeekProfile,
+    .Cleanup = Cleanup_RawSeekProfile,
+    .GetDefaultSettings = GetDefaultSettings_RawSeekProfile,
+    .GetLatency = GetLatency_RawSeekProfile,
+    .SetSampler = SetSampler_RawSeekProfile,
+    .GetSeeks = GetSeeks_RawSeekProfile};
+
+const BenchWorkload Workload_RawQueueDepth = {
+    .type = TEST_RAW_QUEUE_DEPTH,
+    .name = "Raw Queue Depth",
+    .description = "Device queueing: Random reads with several requests in flight",
+    .detailed_info =
+        "Raw Queue Depth\n"
+        "\n"
+        "Reads uniformly random blocks across the block device behind\n"
+        "the target volume, keeping several requests in flight with\n"
+        "SendIO instead of waiting for each one, bypassing the\n"
+        "filesystem. Read-only: nothing on the disk is modified.\n"
+        "\n"
+        "  Queue depth:    1, 2, 4, 8, 16 and 32 requests in flight,\n"
+        "                  one queued job per depth\n"
+        "  Operations:     4096 random reads per pass\n"
+        "  Block size:     Configurable (default 4 KB, whole sectors)\n"
+        "  Metric:         IOPS, latency from submit to completion\n"
+        "  Default passes: 3\n"
+        "\n"
+        "Every other test waits for one request before issuing the\n"
+        "next, so an NCQ SATA or NVMe drive never sees more than\n"
+        "one. Here IOPS climb with the depth until the drive or its\n"
+        "driver saturates; past that point only latency grows. The\n"
+        "log names the saturation depth at the end of the sweep;\n"
+        "plot the curve with the Queue Depth profile. A driver that\n"
+        "serialises requests shows flat IOPS from depth 1.\n"
+        "RawImagePath in prefs reads an image file instead (its\n"
+        "requests complete one at a time).\n"
+        "\n"
+        "Good for: Sizing queue depth, checking NCQ and driver queueing.\n"
+        "Simulates: Several programs or threads reading at once.\n",
+    .Setup = Setup_RawQueueDepth,
+    .Run = Run_RawQueueDepth,
+    .Cleanup = Cleanup_RawQueueDepth,
+    .GetDefaultSettings = GetDefaultSettings_RawQueueDepth,
+    .GetLatency = GetLatency_RawQueueDepth,
+    .SetSampler = SetSampler_RawQueueDepth};
@@ -0,0 +1,251 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ */
+
+#include "engine_internal.h"
+#include "engine_access.h"
+#include "engine_fixture.h"
+#include "workload_interface.h"
+
+#define STRIDE_BLOCK_SIZE 4096
+#define STRIDE_FILE_SIZE (256ULL * 1024 * 1024)    /* Room for several passes of fresh regions */
+#define STRIDE_RAM_FILE_SIZE (16ULL * 1024 * 1024) /* RAM: has no read-ahead to find */
+#define STRIDE_FILL_CHUNK (128 * 1024)
+#define STRIDE_MAX_GAP (512 * 1024) /* Widest gap probed */
+#define STRIDE_READS 32             /* Timed reads per gap and direction */
+#define STRIDE_RANDOM_READS 64      /* Uncached reference reads per pass */
+
+struct ReadAheadData
+{
+    char file_path[MAX_PATH_LEN * 2];
+    PlatFile file;
+    uint8 *buffer;
+    uint64 file_size;
+    uint32 block_size;
+    uint64 cursor; /* Start of the next unread region, carried over between passes */
+    FastRand rng;
+    StrideStats strides;
+    BenchSampler *sampler;
+};
+
+/**
+ * Setup_ReadAhead
+ *
+ * Creates the data file and the gap levels. A data set too small for the
+ * widest gap narrows the probe to the gaps that fit.
+ */
+static BOOL Setup_ReadAhead(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    struct ReadAheadData *rd = PlatAllocClear(sizeof(struct ReadAheadData));
+    if (!rd)
+        return FALSE;
+
+    rd->block_size = block_size ? block_size : STRIDE_BLOCK_SIZE;
+    rd->file_size = (strncasecmp(path, "RAM:", 4) == 0) ? STRIDE_RAM_FILE_SIZE : STRIDE_FILE_SIZE;
+    if (opts->dataset_bytes > 0)
+        rd->file_size = opts->dataset_bytes;
+    rd->file_size = rd->file_size / rd->block_size * rd->block_size;
+
+    /* One region per gap and direction must fit in the file */
+    uint64 max_gap = rd->file_size / (STRIDE_READS + 1);
+    max_gap = (max_gap > rd->block_size) ? max_gap - rd->block_size : 0;
+    if (max_gap > STRIDE_MAX_GAP)
+        max_gap = STRIDE_MAX_GAP;
+    if (!StrideStatsInit(&rd->strides, rd->block_size, (uint32)max_gap)) {
+        LogUser("Read-Ahead: a %u KB data set is too small for strided %u-byte reads",
+                (unsigned int)(rd->file_size / 1024), (unsigned int)rd->block_size);
+        PlatFree(rd);
+        return FALSE;
+    }
+    FastRandSeed(&rd->rng, opts->access_seed ? opts->access_seed : ACCESS_DEFAULT_SEED);
+
+    snprintf(rd->file_path, sizeof(rd->file_path), "%sbench_stride.tmp", path);
+    if (!FixtureAcquire(path, rd->file_path, rd->file_size, STRIDE_FILL_CHUNK, FALSE, opts)) {
+        PlatFree(rd);
+        return FALSE;
+    }
+
+    rd->file = PlatOpen(rd->file_path, PLAT_OPEN_EXISTING);
+    rd->buffer = PlatAlloc(rd->block_size);
+    if (!rd->file || !rd->buffer) {
+        if (rd->file)
+            PlatClose(rd->file);
+        if (rd->buffer)
+            PlatFree(rd->buffer);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
+        return FALSE;
+    }
+
+    *data = rd;
+    return TRUE;
+}
+
+/* Read one block; returns its latency in us, or 0 if the read failed */
+static uint32 ReadBlock(struct ReadAheadData *rd, uint64 offset, uint64 *total_bytes)
+{
+    BenchTicks start = TimerNow();
+    if (!PlatSeek(rd->file, offset) || PlatRead(rd->file, rd->buffer, rd->block_size) != (int32)rd->block_size)
+        return 0;
+    uint32 micros = TimerOpMicros(start, TimerNow());
+    *total_bytes += rd->block_size;
+    SamplerUpdate(rd->sampler, rd->block_size, 1);
+    return micros ? micros : 1;
+}
+
+/**
+ * Run_ReadAhead
+ *
+ * For every gap, forwards and then backwards, reads one block, skips the gap
+ * and repeats through a region of the file no earlier level has touched. The
+ * first read of a region only positions the scan and is not timed. Random
+ * reads in a fresh region close the pass as the uncached reference: one per
+ * slot as wide as the widest gap, slots taken in random order, so no read
+ * lands in what the strided reads or an earlier random read prefetched.
+ */
+static BOOL Run_ReadAhead(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct ReadAheadData *rd = (struct ReadAheadData *)data;
+    uint64 total_bytes = 0;
+    uint32 done = 0;
+    uint32 failed = 0;
+    uint32 cycles = 0;
+
+    StrideStatsReset(&rd->strides);
+    if (!rd->file)
+        return FALSE;
+
+    /* One probe per pass, or repeated probes until the deadline of a time-bounded pass */
+    do {
+        for (uint32 level = 0; level < rd->strides.levels; level++) {
+            uint64 step = rd->block_size + rd->strides.gap_bytes[level];
+            uint64 span = STRIDE_READS * step + rd->block_size;
+            for (uint32 backward = 0; backward < 2; backward++) {
+                if (rd->cursor + span > rd->file_size)
+                    rd->cursor = 0;
+                for (uint32 i = 0; i <= STRIDE_READS; i++) {
+                    uint64 offset = backward ? rd->cursor + span - rd->block_size - i * step : rd->cursor + i * step;
+                    uint32 micros = ReadBlock(rd, offset, &total_bytes);
+                    if (micros == 0)
+                        failed++;
+                    else if (i > 0)
+                        StrideStatsRecord(&rd->strides, level, (BOOL)backward, micros);
+                    done++;
+                }
+                rd->cursor += span;
+            }
+        }
+
+        uint64 slot = rd->block_size + rd->strides.gap_bytes[rd->strides.levels - 1];
+        uint32 slots = (rd->file_size / slot < STRIDE_RANDOM_READS) ? (uint32)(rd->file_size / slot)
+                                                                      : STRIDE_RANDOM_READS;
+        uint32 order[STRIDE_RANDOM_READS];
+        for (uint32 i = 0; i < slots; i++)
+            order[i] = i;
+        for (uint32 i = slots; i > 1; i--) {
+            uint32 j = (uint32)FastRandRange(&rd->rng, i);
+            uint32 t = order[i - 1];
+            order[i - 1] = order[j];
+            order[j] = t;
+        }
+        if (rd->cursor + slots * slot > rd->file_size)
+            rd->cursor = 0;
+        for (uint32 i = 0; i < slots; i++) {
+            uint32 micros = ReadBlock(rd, rd->cursor + order[i] * slot, &total_bytes);
+            if (micros == 0)
+                failed++;
+            else
+                StrideStatsRecordRandom(&rd->strides, micros);
+            done++;
+        }
+        rd->cursor += slots * slot;
+        cycles++;
+    } while (SamplerKeepRunning(rd->sampler, cycles, 1));
+
+    if (failed > 0)
+        LogUser("Read-Ahead: %u of %u reads failed on %s", (unsigned int)failed, (unsigned int)done, rd->file_path);
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (total_bytes > 0 && failed == 0);
+}
+
+static void Cleanup_ReadAhead(void *data)
+{
+    if (data) {
+        struct ReadAheadData *rd = (struct ReadAheadData *)data;
+        if (rd->file)
+            PlatClose(rd->file);
+        if (rd->buffer)
+            PlatFree(rd->buffer);
+        FixtureRelease(rd->file_path, FALSE);
+        PlatFree(rd);
+    }
+}
+
+static void SetSampler_ReadAhead(void *data, BenchSampler *sampler)
+{
+    ((struct ReadAheadData *)data)->sampler = sampler;
+}
+
+static BOOL SetFilesOpen_ReadAhead(void *data, BOOL open)
+{
+    struct ReadAheadData *rd = (struct ReadAheadData *)data;
+    if (open && !rd->file)
+        rd->file = PlatOpen(rd->file_path, PLAT_OPEN_EXISTING);
+    else if (!open && rd->file) {
+        PlatClose(rd->file);
+        rd->file = 0;
+    }
+    return (open == (rd->file != 0));
+}
+
+static const StrideStats *GetStrides_ReadAhead(void *data)
+{
+    return &((struct ReadAheadData *)data)->strides;
+}
+
+static void GetDefaultSettings_ReadAhead(uint32 *block_size, uint32 *passes)
+{
+    *block_size = STRIDE_BLOCK_SIZE;
+    *passes = 3;
+}
+
+const BenchWorkload Workload_ReadAhead = {
+    .type = TEST_READ_AHEAD,
+    .name = "Read-Ahead Probe",
+    .description = "Prefetch: Strided reads revealing the read-ahead window",
+    .detailed_info =
+        "Read-Ahead Probe\n"
+        "\n"
+        "Reads one block, skips a gap, and repeats, with gaps\n"
+        "doubling from none (plain sequential) to 512 KB, both\n"
+        "forwards and backwards (reverse sequential at gap 0).\n"
+        "Random reads in a part of the file the probe has not\n"
+        "touched are the uncached reference.\n"
+        "\n"
+        "  File size:      256 MB (DataSetMB; 16 MB on RAM:)\n"
+        "  Reads:          32 per gap and direction, each gap in a\n"
+        "                  part of the file not read before\n"
+        "  Block size:     Configurable (default 4 KB)\n"
+        "  Metric:         Mean latency per gap, forward and back\n"
+        "  Default passes: 3\n"
+        "\n"
+        "While the gap fits inside what the filesystem, driver or\n"
+        "drive prefetched, reads cost a memory copy; past it they\n"
+        "cost as much as a random read. Where the curve climbs\n"
+        "gives the read-ahead size (and read-behind, backwards),\n"
+        "shown in the details window and stored with the result.\n"
+        "Run it in cold-cache mode so earlier jobs' data is not\n"
+        "already cached.\n"
+        "\n"
+        "Good for: Tuning filesystem buffers and read-ahead settings.\n"
+        "Simulates: Scanning records, reading file headers, seeking media.\n",
+    .Setup = Setup_ReadAhead,
+    .Run = Run_ReadAhead,
+    .Cleanup = Cleanup_ReadAhead,
+    .GetDefaultSettings = GetDefaultSettings_ReadAhead,
+    .SetSampler = SetSampler_ReadAhead,
+    .SetFilesOpen = SetFilesOpen_ReadAhead,
+    .GetStrides = GetStrides_ReadAhead};
@@ -4,22 +4,26 @@
  */
 
 #include "engine_internal.h"
+#include "engine_fixture.h"
 #include "workload_interface.h"
 
 #define SEQ_DEFAULT_BLOCK (1024 * 1024)      /* 1MB default block */
-#define SEQ_FILE_SIZE (256 * 1024 * 1024)    /* 256MB standard */
-#define SEQ_RAM_FILE_SIZE (32 * 1024 * 1024) /* 32MB for RAM: */
+#define SEQ_FILE_SIZE (256ULL * 1024 * 1024)    /* 256MB standard */
+#define SEQ_RAM_FILE_SIZE (32ULL * 1024 * 1024) /* 32MB for RAM: */
 
 struct SequentialData
 {
     char path[MAX_PATH_LEN];
     uint32 block_size;
-    uint32 file_size;
+    uint64 file_size;
+    BenchSampler *sampler;
+    VerifyState verify;
+    DataPattern pattern; /* Write data, generated in Setup */
 };
 
-static BOOL Setup_Sequential(const char *path, uint32 block_size, void **data)
+static BOOL Setup_Sequential(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct SequentialData *sd = IExec->AllocVecTags(sizeof(struct SequentialData), AVT_Type, MEMF_SHARED, TAG_DONE);
+    struct SequentialData *sd = PlatAllocClear(sizeof(struct SequentialData));
     if (!sd)
         return FALSE;
 
@@ -32,32 +36,67 @@ static BOOL Setup_Sequential(const char *path, uint32 block_size, void **data)
         sd->file_size = SEQ_RAM_FILE_SIZE;
     }
 
+    /* An explicit data-set size overrides the defaults above, including the RAM: cap */
+    if (opts->dataset_bytes > 0)
+        sd->file_size = opts->dataset_bytes;
+
+    VerifyInit(&sd->verify, opts);
+    if (!DataPatternInit(&sd->pattern, opts, sd->block_size, FIXTURE_FILL_BYTE)) {
+        PlatFree(sd);
+        return FALSE;
+    }
+
     *data = sd;
     return TRUE;
 }
 
-static BOOL Run_Sequential(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_Sequential(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct SequentialData *sd = (struct SequentialData *)data;
     char temp_file[512];
-    uint32 total_bytes = 0;
+    uint64 total_bytes = 0;
+    uint32 files = 0;
 
     snprintf(temp_file, sizeof(temp_file), "%sbench_seq.tmp", sd->path);
-    total_bytes = WriteDummyFile(temp_file, sd->file_size, sd->block_size);
-    IDOS->Delete(temp_file);
+    VerifyReset(&sd->verify);
+
+    /* One file per pass, or back-to-back files until the deadline of a time-bounded pass */
+    do {
+        uint64 written = WriteDummyFile(temp_file, sd->file_size, sd->block_size, sd->sampler, &sd->pattern,
+                                        &sd->verify);
+        /* Verify mode: read the file back from the medium before it goes; the sampler leaves this time out */
+        if (written > 0 && sd->verify.enabled)
+            VerifyFile(&sd->verify, sd->sampler, temp_file, sd->path, written, sd->block_size);
+        PlatDelete(temp_file);
+        if (written == 0)
+            break;
+        total_bytes += written;
+        files++;
+    } while (SamplerKeepRunning(sd->sampler, files, 1));
 
     *bytes_processed = total_bytes;
-    *op_count = (sd->block_size > 0) ? (total_bytes / sd->block_size) : 1;
+    *op_count = (sd->block_size > 0) ? (uint32)(total_bytes / sd->block_size) : 1;
     return (total_bytes > 0);
 }
 
 static void Cleanup_Sequential(void *data)
 {
     if (data) {
-        IExec->FreeVec(data);
+        DataPatternFree(&((struct SequentialData *)data)->pattern);
+        PlatFree(data);
     }
 }
 
+static void SetSampler_Sequential(void *data, BenchSampler *sampler)
+{
+    ((struct SequentialData *)data)->sampler = sampler;
+}
+
+static const VerifyState *GetVerify_Sequential(void *data)
+{
+    return &((struct SequentialData *)data)->verify;
+}
+
 static void GetDefaultSettings_Sequential(uint32 *block_size, uint32 *passes)
 {
     *block_size = SEQ_DEFAULT_BLOCK;
@@ -93,4 +132,7 @@ const BenchWorkload Workload_Sequential = {
     .Setup = Setup_Sequential,
     .Run = Run_Sequential,
     .Cleanup = Cleanup_Sequential,
-    .GetDefaultSettings = GetDefaultSettings_Sequential};
+    .GetDefaultSettings = GetDefaultSettings_Sequential,
+    .SetSampler = SetSampler_Sequential,
+    .GetVerify = GetVerify_Sequential,
+    .flags = WORKLOAD_F_TRACEABLE | WORKLOAD_F_DATA_PATTERN | WORKLOAD_F_BUFFER_PLACEMENT};
@@ -4,28 +4,31 @@
  */
 
 #include "engine_internal.h"
+#include "engine_buffer.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
 #include "workload_interface.h"
 
 #define SEQ_READ_DEFAULT_BLOCK (1024 * 1024)  /* 1MB default block */
-#define SEQ_READ_FILE_SIZE (256 * 1024 * 1024)    /* 256MB standard */
-#define SEQ_READ_RAM_FILE_SIZE (32 * 1024 * 1024) /* 32MB for RAM: */
+#define SEQ_READ_FILE_SIZE (256ULL * 1024 * 1024)    /* 256MB standard */
+#define SEQ_READ_RAM_FILE_SIZE (32ULL * 1024 * 1024) /* 32MB for RAM: */
 
 struct SequentialReadData
 {
     char path[MAX_PATH_LEN];
     char file_path[MAX_PATH_LEN * 2];
     uint32 block_size;
-    uint32 file_size;
-    BPTR file;
-    uint8 *buffer;
+    uint64 file_size;
+    PlatFile file;
+    XferBuffer xfer; /* Read buffer, placed as the job asks */
+    uint8 *buffer;   /* xfer.data */
+    BenchSampler *sampler;
+    VerifyState verify;
 };
 
-static BOOL Setup_SequentialRead(const char *path, uint32 block_size, void **data)
+static BOOL Setup_SequentialRead(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
 {
-    struct SequentialReadData *sd = IExec->AllocVecTags(sizeof(struct SequentialReadData),
-                                                         AVT_Type, MEMF_SHARED,
-                                                         AVT_ClearWithValue, 0,
-                                                         TAG_DONE);
+    struct SequentialReadData *sd = PlatAllocClear(sizeof(struct SequentialReadData));
     if (!sd)
         return FALSE;
 
@@ -38,58 +41,76 @@ static BOOL Setup_SequentialRead(const char *path, uint32 block_size, void **dat
         sd->file_size = SEQ_READ_RAM_FILE_SIZE;
     }
 
+    /* An explicit data-set size overrides the defaults above, including the RAM: cap */
+    if (opts->dataset_bytes > 0)
+        sd->file_size = opts->dataset_bytes;
+
     snprintf(sd->file_path, sizeof(sd->file_path), "%sbench_seq_read.tmp", path);
 
     /* Pre-create file with data to read */
-    if (WriteDummyFile(sd->file_path, sd->file_size, sd->block_size) == 0) {
-        IExec->FreeVec(sd);
+    VerifyInit(&sd->verify, opts);
+    if (!FixtureAcquire(path, sd->file_path, sd->file_size, sd->block_size, FALSE, opts)) {
+        PlatFree(sd);
         return FALSE;
     }
 
     /* Open file for reading */
-    sd->file = IDOS->Open(sd->file_path, MODE_OLDFILE);
+    sd->file = PlatOpen(sd->file_path, PLAT_OPEN_EXISTING);
     if (!sd->file) {
-        IDOS->Delete(sd->file_path);
-        IExec->FreeVec(sd);
+        FixtureRelease(sd->file_path, FALSE);
+        PlatFree(sd);
         return FALSE;
     }
 
     /* Allocate read buffer */
-    sd->buffer = IExec->AllocVecTags(sd->block_size, AVT_Type, MEMF_SHARED, TAG_DONE);
-    if (!sd->buffer) {
-        IDOS->Close(sd->file);
-        IDOS->Delete(sd->file_path);
-        IExec->FreeVec(sd);
+    if (!XferBufferAlloc(&sd->xfer, sd->block_size, opts)) {
+        PlatClose(sd->file);
+        FixtureRelease(sd->file_path, FALSE);
+        PlatFree(sd);
         return FALSE;
     }
 
+    sd->buffer = sd->xfer.data;
+
     *data = sd;
     return TRUE;
 }
 
-static BOOL Run_SequentialRead(void *data, uint32 *bytes_processed, uint32 *op_count)
+static BOOL Run_SequentialRead(void *data, uint64 *bytes_processed, uint32 *op_count)
 {
     struct SequentialReadData *sd = (struct SequentialReadData *)data;
-    uint32 total_bytes = 0;
-    uint32 remaining = sd->file_size;
+    uint64 total_bytes = 0;
+    uint64 remaining = sd->file_size;
 
-    /* Seek to beginning of file */
-    IDOS->ChangeFilePosition(sd->file, 0, OFFSET_BEGINNING);
+    VerifyReset(&sd->verify);
 
-    /* Sequential read through the entire file */
-    while (remaining > 0) {
-        uint32 to_read = (remaining < sd->block_size) ? remaining : sd->block_size;
-        int32 bytes_read = IDOS->Read(sd->file, sd->buffer, to_read);
+    /* Seek to beginning of file */
+    PlatSeek(sd->file, 0);
+
+    /* Sequential read through the entire file; time-bounded passes wrap around until the deadline */
+    while (SamplerKeepRunning(sd->sampler, sd->file_size - remaining, sd->file_size)) {
+        if (remaining == 0) {
+            if (!PlatSeek(sd->file, 0))
+                break;
+            remaining = sd->file_size;
+        }
+        uint32 to_read = (remaining < sd->block_size) ? (uint32)remaining : sd->block_size;
+        uint64 offset = sd->file_size - remaining;
+        SamplerTraceIO(sd->sampler, TRACE_OP_READ, offset, to_read);
+        int32 bytes_read = PlatRead(sd->file, sd->buffer, to_read);
 
         if (bytes_read <= 0)
             break;
+        if (sd->verify.enabled)
+            VerifyCheck(&sd->verify, sd->sampler, sd->buffer, (uint32)bytes_read, offset);
 
         total_bytes += bytes_read;
         remaining -= bytes_read;
+        SamplerUpdate(sd->sampler, bytes_read, 1);
     }
 
     *bytes_processed = total_bytes;
-    *op_count = (sd->block_size > 0) ? (total_bytes / sd->block_size) : 1;
+    *op_count = (sd->block_size > 0) ? (uint32)(total_bytes / sd->block_size) : 1;
     return (total_bytes > 0);
 }
 
@@ -98,12 +119,33 @@ static void Cleanup_SequentialRead(void *data)
     if (data) {
         struct SequentialReadData *sd = (struct SequentialReadData *)data;
         if (sd->file)
-            IDOS->Close(sd->file);
-        if (sd->buffer)
-            IExec->FreeVec(sd->buffer);
-        IDOS->Delete(sd->file_path);
-        IExec->FreeVec(sd);
+            PlatClose(sd->file);
+        XferBufferFree(&sd->xfer);
+        FixtureRelease(sd->file_path, FALSE);
+        PlatFree(sd);
+    }
+}
+
+static void SetSampler_SequentialRead(void *data, BenchSampler *sampler)
+{
+    ((struct SequentialReadData *)data)->sampler = sampler;
+}
+
+static BOOL SetFilesOpen_SequentialRead(void *data, BOOL open)
+{
+    struct SequentialReadData *sd = (struct SequentialReadData *)data;
+    if (open && !sd->file)
+        sd->file = PlatOpen(sd->file_path, PLAT_OPEN_EXISTING);
+    else if (!open && sd->file) {
+        PlatClose(sd->file);
+        sd->file = 0;
     }
+    return (open == (sd->file != 0));
+}
+
+static const VerifyState *GetVerify_SequentialRead(void *data)
+{
+    return &((struct SequentialReadData *)data)->verify;
 }
 
 static void GetDefaultSettings_SequentialRead(uint32 *block_size, uint32 *passes)
@@ -141,5 +183,8 @@ const BenchWorkload Workload_SequentialRead = {
     .Setup = Setup_SequentialRead,
     .Run = Run_SequentialRead,
     .Cleanup = Cleanup_SequentialRead,
-    .GetDefaultSettings = GetDefaultSettings_SequentialRead
-};
+    .GetDefaultSettings = GetDefaultSettings_SequentialRead,
+    .SetSampler = SetSampler_SequentialRead,
+    .SetFilesOpen = SetFilesOpen_SequentialRead,
+    .GetVerify = GetVerify_SequentialRead,
+    .flags = WORKLOAD_F_TRACEABLE | WORKLOAD_F_BUFFER_PLACEMENT};
@@ -0,0 +1,209 @@
+/*
+ * AmigaDiskBench - A modern benchmark for AmigaOS 4.x
+ * Copyright (c) 2026 Team Derfs. All rights reserved.
+ */
+
+#include "engine_internal.h"
+#include "engine_fixture.h"
+#include "engine_trace.h"
+#include "workload_interface.h"
+
+#define TRACE_NOMINAL_BLOCK 4096          /* Reported block size; the trace sets the real I/O sizes */
+#define TRACE_FILL_CHUNK (128 * 1024)     /* 128KB fill chunk */
+#define TRACE_TICK_US 20000               /* DOS Delay() granularity (1/50 s) */
+
+struct TraceReplayData
+{
+    char path[MAX_PATH_LEN];
+    char file_path[MAX_PATH_LEN * 2];
+    PlatFile file;
+    uint8 *buffer;
+    TraceData trace;
+    BOOL open_loop;
+    LatencyHistogram latency;
+    BenchSampler *sampler;
+};
+
+static BOOL Setup_TraceReplay(const char *path, uint32 block_size, const BenchOptions *opts, void **data)
+{
+    if (!opts->trace_path[0]) {
+        LogUser("Trace Replay: no trace file set (TracePath in prefs)");
+        return FALSE;
+    }
+
+    struct TraceReplayData *td = PlatAllocClear(sizeof(struct TraceReplayData));
+    if (!td)
+        return FALSE;
+
+    char err[80];
+    if (!TraceLoad(&td->trace, opts->trace_path, err, sizeof(err))) {
+        LogUser("Trace Replay: %s: %s", opts->trace_path, err);
+        PlatFree(td);
+        return FALSE;
+    }
+
+    snprintf(td->path, sizeof(td->path), "%s", path);
+    snprintf(td->file_path, sizeof(td->file_path), "%sbench_trace.tmp", path);
+    td->open_loop = opts->trace_open_loop;
+
+    /* Pre-create a file covering every offset in the trace so reads hit real data */
+    uint64 file_size = td->trace.span_bytes ? td->trace.span_bytes : TRACE_FILL_CHUNK;
+    if (!FixtureAcquire(path, td->file_path, file_size, TRACE_FILL_CHUNK, FALSE, opts)) {
+        TraceFree(&td->trace);
+        PlatFree(td);
+        return FALSE;
+    }
+
+    td->file = PlatOpen(td->file_path, PLAT_OPEN_EXISTING);
+    if (!td->file) {
+        FixtureRelease(td->file_path, FALSE);
+        TraceFree(&td->trace);
+        PlatFree(td);
+        return FALSE;
+    }
+
+    uint32 buffer_size = td->trace.max_length ? td->trace.max_length : TRACE_NOMINAL_BLOCK;
+    td->buffer = PlatAlloc(buffer_size);
+    if (!td->buffer) {
+        PlatClose(td->file);
+        FixtureRelease(td->file_path, FALSE);
+        TraceFree(&td->trace);
+        PlatFree(td);
+        return FALSE;
+    }
+    memset(td->buffer, 0xAA, buffer_size);
+
+    LOG_DEBUG("TraceReplay: %u records, span %llu bytes, %s-loop", (unsigned int)td->trace.count,
+              (unsigned long long)td->trace.span_bytes, td->open_loop ? "open" : "closed");
+
+    *data = td;
+    return TRUE;
+}
+
+/* Sleep while far from the target (whole ticks on AmigaOS), then spin for microsecond accuracy */
+static void WaitUntil(uint64 target_us)
+{
+    uint64 now = GetMicroTimestamp();
+    while (now < target_us) {
+        uint64 remaining = target_us - now;
+        if (remaining > 2 * TRACE_TICK_US)
+            PlatSleepMicros((remaining > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (uint32)(remaining - TRACE_TICK_US));
+        now = GetMicroTimestamp();
+    }
+}
+
+static BOOL Run_TraceReplay(void *data, uint64 *bytes_processed, uint32 *op_count)
+{
+    struct TraceReplayData *td = (struct TraceReplayData *)data;
+    uint64 total_bytes = 0;
+    TraceReplayer replay;
+
+    LatencyReset(&td->latency);
+    TraceReplayBegin(&replay, &td->trace, td->open_loop, GetMicroTimestamp());
+
+    /* One pass over the trace, or as many loops as fit before the deadline of a time-bounded pass */
+    uint32 done = 0;
+    for (; SamplerKeepRunning(td->sampler, done, td->trace.count); done++) {
+        uint64 wait_us;
+        const TraceRecord *rec = TraceReplayNext(&replay, GetMicroTimestamp(), &wait_us);
+        if (!rec)
+            break;
+        if (wait_us > 0)
+            WaitUntil(replay.due_us);
+
+        uint64 bytes_before = total_bytes;
+
+        BenchTicks op_start = TimerNow();
+
+        if (rec->op == TRACE_OP_FLUSH) {
+            PlatFlushVolume(td->path);
+        } else if (PlatSeek(td->file, rec->offset)) {
+            if (rec->op == TRACE_OP_READ) {
+                int32 bytes_read = PlatRead(td->file, td->buffer, rec->length);
+                if (bytes_read > 0)
+                    total_bytes += bytes_read;
+            } else if (PlatWrite(td->file, td->buffer, rec->length) == (int32)rec->length) {
+                total_bytes += rec->length;
+            }
+        }
+
+        LatencyRecord(&td->latency, TimerOpMicros(op_start, TimerNow()));
+        SamplerUpdate(td->sampler, (uint32)(total_bytes - bytes_before), 1);
+    }
+
+    if (td->open_loop && replay.late_ops > 0) {
+        LOG_DEBUG("TraceReplay: %u of %u ops late, mean lag %llu us, max %llu us", (unsigned int)replay.late_ops,
+                  (unsigned int)done, (unsigned long long)(replay.total_lag_us / replay.late_ops),
+                  (unsigned long long)replay.max_lag_us);
+    }
+
+    *bytes_processed = total_bytes;
+    *op_count = done;
+    return (done > 0);
+}
+
+static void Cleanup_TraceReplay(void *data)
+{
+    if (data) {
+        struct TraceReplayData *td = (struct TraceReplayData *)data;
+        if (td->file)
+            PlatClose(td->file);
+        if (td->buffer)
+            PlatFree(td->buffer);
+        FixtureRelease(td->file_path, FALSE);
+        TraceFree(&td->trace);
+        PlatFree(td);
+    }
+}
+
+static const LatencyHistogram *GetLatency_TraceReplay(void *data)
+{
+    return &((struct TraceReplayData *)data)->latency;
+}
+
+static void SetSampler_TraceReplay(void *data, BenchSampler *sampler)
+{
+    ((struct TraceReplayData *)data)->sampler = sampler;
+}
+
+static void GetDefaultSettings_TraceReplay(uint32 *block_size, uint32 *passes)
+{
+    *block_size = TRACE_NOMINAL_BLOCK;
+    *passes = 3;
+}
+
+const BenchWorkload Workload_TraceReplay = {
+    .type = TEST_TRACE_REPLAY,
+    .name = "Trace Replay",
+    .description = "Real-world pattern: Replay a recorded I/O trace",
+    .detailed_info =
+        "Trace Replay\n"
+        "\n"
+        "Replays a recorded I/O trace (reads, writes and flushes at\n"
+        "recorded offsets and sizes) against a file on the target\n"
+        "volume, so the same real-world pattern can be compared\n"
+        "across drives and filesystems.\n"
+        "\n"
+        "  Trace file:     TracePath in prefs (.adbt binary format)\n"
+        "  File size:      Highest offset touched by the trace\n"
+        "  Block size:     Taken from the trace (chooser ignored)\n"
+        "  Timing:         Closed-loop (back-to-back) or open-loop\n"
+        "                  (TraceOpenLoop=1, at the recorded times)\n"
+        "  Metric:         MB/s and IOPS\n"
+        "  Latency:        p50/p90/p99/p99.9/max per operation\n"
+        "  Default passes: 3\n"
+        "\n"
+        "Traces are captured with record mode (TraceRecord=1): the\n"
+        "first pass of a Sequential, Random or Mixed test is written\n"
+        "to TracePath. Open-loop replay shows how a device copes with\n"
+        "the original arrival rate; closed-loop replay measures how\n"
+        "fast the pattern can be completed.\n"
+        "\n"
+        "Good for: Benchmarking your own workload, not a synthetic one.\n"
+        "Simulates: Whatever was recorded (e.g. a build job).\n",
+    .Setup = Setup_TraceReplay,
+    .Run = Run_TraceReplay,
+    .Cleanup = Cleanup_TraceReplay,
+    .GetDefaultSettings = GetDefaultSettings_TraceReplay,
+    .GetLatency = GetLatency_TraceReplay,
+    .SetSampler = SetSampler_TraceReplay};